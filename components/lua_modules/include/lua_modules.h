@@ -5,7 +5,10 @@
 #ifndef LUA_MODULES_H
 #define LUA_MODULES_H
 
+#include "esp_err.h"
 #include "lua.h"
+#include "rgb_display.h"
+#include "rgb_image.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,7 +27,48 @@ int luaopen_i2c_module(lua_State *L);
 int luaopen_sys(lua_State *L);
 int luaopen_wifi(lua_State *L);
 int luaopen_http(lua_State *L);
+int luaopen_dns(lua_State *L);
 int luaopen_touch(lua_State *L);
+int luaopen_image(lua_State *L);
+int luaopen_jpeg(lua_State *L);
+int luaopen_scene(lua_State *L);
+
+// Push an image as a display.image userdata, which takes ownership of it
+void lua_display_push_image(lua_State *L, rgb_image_t *image);
+
+// Surface of the display.canvas at idx (raises an error otherwise)
+rgb_surface_t *lua_display_check_canvas(lua_State *L, int idx);
+
+// Image of the display.image at idx (raises an error otherwise)
+rgb_image_t *lua_display_check_image(lua_State *L, int idx);
+
+// True between display.begin_frame() and display.end_frame()
+bool lua_display_in_frame(void);
+
+// Consumer of a response body, called on the HTTP worker task with each
+// chunk as it arrives; returning false drops the rest of the body
+typedef bool (*lua_http_sink_t)(void *ctx, const char *data, int len);
+
+// GET url on the HTTP worker, streaming the body into sink, and wait for it
+// to finish (call from the Lua task). Returns the transport error, with the
+// HTTP status in *status on ESP_OK.
+esp_err_t lua_http_stream(const char *url, int timeout_ms, lua_http_sink_t sink, void *ctx,
+                          int *status);
+
+// Body of a GET on the HTTP worker, read by the Lua task as it arrives;
+// bodies over the response size limit fail
+typedef struct lua_http_body lua_http_body_t;
+
+// Start a GET of url; NULL when out of memory (call from the Lua task)
+lua_http_body_t *lua_http_open(const char *url, int timeout_ms);
+
+// Read len bytes (skip them with buf NULL), waiting for them to arrive;
+// fewer only at the end of the body or when the request failed
+size_t lua_http_read(lua_http_body_t *body, void *buf, size_t len);
+
+// Drop the rest of the body, wait for the request to finish and free it.
+// Returns the transport error, with the HTTP status in *status on ESP_OK.
+esp_err_t lua_http_close(lua_http_body_t *body, int *status);
 
 #ifdef __cplusplus
 }
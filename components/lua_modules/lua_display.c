@@ -11,11 +11,47 @@
  */
 
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
 #include "lua.h"
 #include "lauxlib.h"
 #include "lualib.h"
 #include "rgb_display.h"
 #include "fonts.h"
+#include "numerals.h"
+#include "rgb_cmdlist.h"
+#include "rgb_image.h"
+#include "rgb_stats.h"
+#include "esp_rom_sys.h"
+#include "lua_modules.h"
+
+// Frame recording (display.begin_frame/end_frame): while a frame is open,
+// draw calls append to one of two command lists instead of drawing, and
+// end_frame() draws only what differs from the other, previous, list.
+// Image strings are anchored per list until that list is recorded over.
+static rgb_cmdlist_t s_frames[2];
+static int s_frame_index = 0;               // List being recorded
+static bool s_frame_prev_valid = false;     // Screen shows the other list
+static rgb_cmdlist_t *s_recording = NULL;
+static const char s_frame_anchor_keys[2] = {0};
+
+static int frame_recorded(lua_State *L, bool ok)
+{
+    if (!ok) {
+        return luaL_error(L, "Out of memory for draw commands");
+    }
+    return 0;
+}
+
+// Keep a value alive for as long as the recording frame's list
+static void frame_anchor(lua_State *L, int idx)
+{
+    idx = lua_absindex(L, idx);
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &s_frame_anchor_keys[s_frame_index]);
+    lua_pushvalue(L, idx);
+    lua_rawseti(L, -2, lua_rawlen(L, -2) + 1);
+    lua_pop(L, 1);
+}
 
 // display.init()
 static int l_display_init(lua_State *L)
@@ -32,6 +68,7 @@ static int l_display_init(lua_State *L)
 static int l_display_clear(lua_State *L)
 {
     uint16_t color = (uint16_t)luaL_optinteger(L, 1, RGB565_BLACK);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_clear(s_recording, color));
     rgb_display_clear(color);
     return 0;
 }
@@ -42,6 +79,7 @@ static int l_display_pixel(lua_State *L)
     int x = luaL_checkinteger(L, 1);
     int y = luaL_checkinteger(L, 2);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 3);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_pixel(s_recording, x, y, color));
     rgb_display_draw_pixel(x, y, color);
     return 0;
 }
@@ -64,6 +102,7 @@ static int l_display_line(lua_State *L)
     int x1 = luaL_checkinteger(L, 3);
     int y1 = luaL_checkinteger(L, 4);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 5);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_line(s_recording, x0, y0, x1, y1, color));
     rgb_display_draw_line(x0, y0, x1, y1, color);
     return 0;
 }
@@ -75,6 +114,7 @@ static int l_display_hline(lua_State *L)
     int y = luaL_checkinteger(L, 2);
     int w = luaL_checkinteger(L, 3);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 4);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_hline(s_recording, x, y, w, color));
     rgb_display_draw_hline(x, y, w, color);
     return 0;
 }
@@ -86,6 +126,7 @@ static int l_display_vline(lua_State *L)
     int y = luaL_checkinteger(L, 2);
     int h = luaL_checkinteger(L, 3);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 4);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_vline(s_recording, x, y, h, color));
     rgb_display_draw_vline(x, y, h, color);
     return 0;
 }
@@ -99,6 +140,7 @@ static int l_display_rect(lua_State *L)
     int h = luaL_checkinteger(L, 4);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 5);
     bool filled = lua_toboolean(L, 6);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_rect(s_recording, x, y, w, h, color, filled));
     rgb_display_draw_rect(x, y, w, h, color, filled);
     return 0;
 }
@@ -111,6 +153,7 @@ static int l_display_circle(lua_State *L)
     int r = luaL_checkinteger(L, 3);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 4);
     bool filled = lua_toboolean(L, 5);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_circle(s_recording, cx, cy, r, color, filled));
     rgb_display_draw_circle(cx, cy, r, color, filled);
     return 0;
 }
@@ -123,6 +166,7 @@ static int l_display_fill_circle(lua_State *L)
     int cy = luaL_checkinteger(L, 2);
     int r = luaL_checkinteger(L, 3);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 4);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_circle(s_recording, cx, cy, r, color, true));
     rgb_display_draw_circle(cx, cy, r, color, true);
     return 0;
 }
@@ -138,10 +182,110 @@ static int l_display_triangle(lua_State *L)
     int y2 = luaL_checkinteger(L, 6);
     uint16_t color = (uint16_t)luaL_checkinteger(L, 7);
     bool filled = lua_toboolean(L, 8);
+    if (s_recording) {
+        return frame_recorded(L, rgb_cmdlist_triangle(s_recording, x0, y0, x1, y1, x2, y2, color, filled));
+    }
     rgb_display_draw_triangle(x0, y0, x1, y1, x2, y2, color, filled);
     return 0;
 }
 
+// Scratch for points converted from Lua, grown to the longest series seen
+static int16_t *s_points = NULL;
+static int s_points_capacity = 0;
+
+// Entry i of the coordinate array passed as argument arg, at idx on the
+// stack, floored and clamped to int16
+static int16_t to_coord(lua_State *L, int idx, int arg, int i)
+{
+    int isnum;
+    lua_Integer v = lua_tointegerx(L, idx, &isnum);
+    if (!isnum) {
+        lua_Number f = lua_tonumberx(L, idx, &isnum);
+        if (!isnum) {
+            luaL_argerror(L, arg, lua_pushfstring(L, "number expected at index %d, got %s",
+                                                  i, luaL_typename(L, idx)));
+        }
+        f = floor(f);
+        v = f >= INT16_MAX ? INT16_MAX : f >= INT16_MIN ? (lua_Integer)f : INT16_MIN;
+    }
+    return v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : (int16_t)v;
+}
+
+// Points at idx: either a packed string of int16 x, y pairs (little-endian,
+// e.g. from string.pack("<hh...")) or arrays of xs and ys at idx and
+// idx + 1 (numbers are floored; other entries are an error). Sets *count
+// and *next, the index of the argument after the points; the result is
+// valid until the next call.
+static const int16_t *check_points(lua_State *L, int idx, int *count, int *next)
+{
+    size_t len = 0;
+    int n;
+    if (lua_type(L, idx) == LUA_TSTRING) {
+        lua_tolstring(L, idx, &len);
+        if (len % (2 * sizeof(int16_t))) {
+            luaL_argerror(L, idx, "packed points must be 4 bytes each");
+        }
+        n = len / (2 * sizeof(int16_t));
+        *next = idx + 1;
+    } else {
+        luaL_checktype(L, idx, LUA_TTABLE);
+        luaL_checktype(L, idx + 1, LUA_TTABLE);
+        size_t nx = lua_rawlen(L, idx);
+        size_t ny = lua_rawlen(L, idx + 1);
+        n = nx < ny ? nx : ny;
+        *next = idx + 2;
+    }
+
+    if (n > s_points_capacity) {
+        int16_t *points = realloc(s_points, n * 2 * sizeof(int16_t));
+        if (!points) luaL_error(L, "Out of memory for %d points", n);
+        s_points = points;
+        s_points_capacity = n;
+    }
+
+    if (len) {
+        memcpy(s_points, lua_tostring(L, idx), n * 2 * sizeof(int16_t));
+    } else {
+        for (int i = 0; i < n; i++) {
+            lua_rawgeti(L, idx, i + 1);
+            lua_rawgeti(L, idx + 1, i + 1);
+            s_points[2 * i] = to_coord(L, -2, idx, i + 1);
+            s_points[2 * i + 1] = to_coord(L, -1, idx + 1, i + 1);
+            lua_pop(L, 2);
+        }
+    }
+    *count = n;
+    return s_points;
+}
+
+// display.polyline(xs, ys, color) or display.polyline(points, color)
+// Connected segments through all points in one call
+static int l_display_polyline(lua_State *L)
+{
+    int count, next;
+    const int16_t *points = check_points(L, 1, &count, &next);
+    uint16_t color = (uint16_t)luaL_checkinteger(L, next);
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_polyline(s_recording, points, count, color));
+    rgb_display_draw_polyline(points, count, color);
+    return 0;
+}
+
+// display.fill_under(xs, ys, baseline, color) or
+// display.fill_under(points, baseline, color)
+// Fills each column between the line through the points and y = baseline
+static int l_display_fill_under(lua_State *L)
+{
+    int count, next;
+    const int16_t *points = check_points(L, 1, &count, &next);
+    int baseline = luaL_checkinteger(L, next);
+    uint16_t color = (uint16_t)luaL_checkinteger(L, next + 1);
+    if (s_recording) {
+        return frame_recorded(L, rgb_cmdlist_fill_under(s_recording, points, count, baseline, color));
+    }
+    rgb_display_fill_under(points, count, baseline, color);
+    return 0;
+}
+
 // display.text(x, y, text, color [, bgcolor])
 static int l_display_text(lua_State *L)
 {
@@ -152,19 +296,27 @@ static int l_display_text(lua_State *L)
     
     if (lua_gettop(L) >= 5) {
         uint16_t bgcolor = (uint16_t)luaL_checkinteger(L, 5);
+        if (s_recording) return frame_recorded(L, rgb_cmdlist_text8(s_recording, x, y, text, color, true, bgcolor));
         rgb_display_draw_text_bg(x, y, text, color, bgcolor);
     } else {
+        if (s_recording) return frame_recorded(L, rgb_cmdlist_text8(s_recording, x, y, text, color, false, 0));
         rgb_display_draw_text(x, y, text, color);
     }
     return 0;
 }
 
+static int draw_image_object(lua_State *L);
+
 // display.image(x, y, w, h, data)
 // data is a Lua string containing raw RGB565 pixel data
+// display.image(x, y, img [, tint]) draws an image from display.new_image()
 static int l_display_image(lua_State *L)
 {
     int x = luaL_checkinteger(L, 1);
     int y = luaL_checkinteger(L, 2);
+    if (lua_type(L, 3) == LUA_TUSERDATA) {
+        return draw_image_object(L);
+    }
     int w = luaL_checkinteger(L, 3);
     int h = luaL_checkinteger(L, 4);
     
@@ -177,10 +329,33 @@ static int l_display_image(lua_State *L)
                           expected_len, len);
     }
     
+    if (s_recording) {
+        frame_anchor(L, 5);
+        return frame_recorded(L, rgb_cmdlist_image(s_recording, x, y, w, h, (const uint16_t *)data));
+    }
     rgb_display_draw_image(x, y, w, h, (const uint16_t *)data);
     return 0;
 }
 
+// display.clip(x, y, w, h)
+// Restrict drawing to a rectangle; display.clip() resets to the full screen
+static int l_display_clip(lua_State *L)
+{
+    if (s_recording) {
+        return luaL_error(L, "display.clip() inside a frame");
+    }
+    if (lua_isnoneornil(L, 1)) {
+        rgb_display_reset_clip();
+        return 0;
+    }
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    int w = luaL_checkinteger(L, 3);
+    int h = luaL_checkinteger(L, 4);
+    rgb_display_set_clip(x, y, w, h);
+    return 0;
+}
+
 // display.backlight(brightness)
 // brightness: 0-100
 static int l_display_backlight(lua_State *L)
@@ -223,8 +398,8 @@ static int l_display_rgb(lua_State *L)
 static int l_display_setfont(lua_State *L)
 {
     int font_id = luaL_checkinteger(L, 1);
-    if (font_id < 0 || font_id >= FONT_COUNT) {
-        return luaL_error(L, "Invalid font ID: %d (valid: 0-%d)", font_id, FONT_COUNT - 1);
+    if (!font_is_valid(font_id)) {
+        return luaL_error(L, "Invalid font ID: %d", font_id);
     }
     rgb_display_set_font((font_id_t)font_id);
     return 0;
@@ -248,14 +423,729 @@ static int l_display_text_font(lua_State *L)
     uint16_t color = (uint16_t)luaL_checkinteger(L, 4);
     int font_id = luaL_optinteger(L, 5, FONT_DEFAULT);
     
-    if (font_id < 0 || font_id >= FONT_COUNT) {
+    if (!font_is_valid(font_id)) {
         font_id = FONT_DEFAULT;
     }
     
+    if (s_recording) return frame_recorded(L, rgb_cmdlist_text(s_recording, x, y, text, color, font_id));
     rgb_display_draw_text_font(x, y, text, color, (font_id_t)font_id);
     return 0;
 }
 
+// font_id = display.load_font(name)
+// Maps a font pack from the asset partition; returns nil, err if unavailable
+static int l_display_load_font(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    int font_id = font_pack_load(name);
+    if (font_id < 0) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Font pack not found: %s", name);
+        return 2;
+    }
+    lua_pushinteger(L, font_id);
+    return 1;
+}
+
+// Measure cache: direct-mapped by string pointer and font ID. Lua strings
+// are immutable, and each cached string is anchored in a registry table
+// until its entry is replaced, so a pointer cannot be reused for different
+// text while its entry is live.
+#define MEASURE_CACHE_SIZE 64
+
+typedef struct {
+    const char *text;
+    int font_id;
+    font_metrics_t metrics;
+} measure_entry_t;
+
+static measure_entry_t s_measure_cache[MEASURE_CACHE_SIZE];
+static const char s_measure_anchors_key = 0;
+
+// width, height, lines = display.measure(text, font_id)
+static int l_display_measure(lua_State *L)
+{
+    const char *text = luaL_checkstring(L, 1);
+    int font_id = luaL_optinteger(L, 2, FONT_DEFAULT);
+    
+    if (!font_is_valid(font_id)) {
+        font_id = FONT_DEFAULT;
+    }
+    
+    uintptr_t hash = ((uintptr_t)text >> 3) ^ ((uintptr_t)text >> 11) ^ ((uintptr_t)font_id * 7);
+    int slot = hash & (MEASURE_CACHE_SIZE - 1);
+    measure_entry_t *entry = &s_measure_cache[slot];
+    
+    if (entry->text != text || entry->font_id != font_id) {
+        font_measure(font_get((font_id_t)font_id), text, &entry->metrics);
+        entry->text = text;
+        entry->font_id = font_id;
+        
+        lua_rawgetp(L, LUA_REGISTRYINDEX, &s_measure_anchors_key);
+        lua_pushvalue(L, 1);
+        lua_rawseti(L, -2, slot + 1);
+        lua_pop(L, 1);
+    }
+    
+    lua_pushinteger(L, entry->metrics.width);
+    lua_pushinteger(L, entry->metrics.height);
+    lua_pushinteger(L, entry->metrics.lines);
+    return 3;
+}
+
+// stats = display.atlas_stats([reset])
+// Glyph atlas occupancy and hit counters; reset clears the counters after reading
+static int l_display_atlas_stats(lua_State *L)
+{
+    font_atlas_stats_t stats;
+    font_atlas_get_stats(&stats);
+    if (lua_toboolean(L, 1)) {
+        font_atlas_reset_stats();
+    }
+    
+    lua_createtable(L, 0, 7);
+    lua_pushinteger(L, stats.pages);       lua_setfield(L, -2, "pages");
+    lua_pushinteger(L, stats.glyphs);      lua_setfield(L, -2, "glyphs");
+    lua_pushinteger(L, stats.spans_used);  lua_setfield(L, -2, "spans_used");
+    lua_pushinteger(L, stats.spans_total); lua_setfield(L, -2, "spans_total");
+    lua_pushinteger(L, stats.hits);        lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, stats.misses);      lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, stats.evictions);   lua_setfield(L, -2, "evictions");
+    return 1;
+}
+
+// Push {calls, pixels, glyphs, cycles, us} for one primitive (or the total)
+static void push_stats_entry(lua_State *L, const rgb_stats_entry_t *entry, uint32_t ticks_per_us)
+{
+    lua_createtable(L, 0, 5);
+    lua_pushinteger(L, entry->calls);                 lua_setfield(L, -2, "calls");
+    lua_pushinteger(L, entry->pixels);                lua_setfield(L, -2, "pixels");
+    lua_pushinteger(L, entry->glyphs);                lua_setfield(L, -2, "glyphs");
+    lua_pushinteger(L, entry->cycles);                lua_setfield(L, -2, "cycles");
+    lua_pushinteger(L, entry->cycles / ticks_per_us); lua_setfield(L, -2, "us");
+}
+
+// stats = display.stats([reset])
+// Render cost per primitive since the last reset: stats.rect, stats.text_font,
+// ... and stats.total, each {calls, pixels, glyphs, cycles, us}, plus
+// window_us (time since the reset) and enabled (false if compiled out)
+static int l_display_stats(lua_State *L)
+{
+    rgb_stats_entry_t entries[RGB_STATS_COUNT];
+    int64_t window_us;
+    rgb_stats_get(entries, &window_us);
+    if (lua_toboolean(L, 1)) {
+        rgb_stats_reset();
+    }
+    
+    uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+    if (ticks_per_us == 0) ticks_per_us = 1;
+    rgb_stats_entry_t total = {0};
+    
+    lua_createtable(L, 0, RGB_STATS_COUNT + 3);
+    for (int i = 0; i < RGB_STATS_COUNT; i++) {
+        total.calls += entries[i].calls;
+        total.pixels += entries[i].pixels;
+        total.glyphs += entries[i].glyphs;
+        total.cycles += entries[i].cycles;
+        push_stats_entry(L, &entries[i], ticks_per_us);
+        lua_setfield(L, -2, rgb_stats_name(i));
+    }
+    push_stats_entry(L, &total, ticks_per_us);
+    lua_setfield(L, -2, "total");
+    lua_pushinteger(L, window_us);
+    lua_setfield(L, -2, "window_us");
+    lua_pushboolean(L, RGB_DISPLAY_STATS);
+    lua_setfield(L, -2, "enabled");
+    return 1;
+}
+
+// display.stats_reset() - start a new counting window
+static int l_display_stats_reset(lua_State *L)
+{
+    (void)L;
+    rgb_stats_reset();
+    return 0;
+}
+
+// width, cells = display.numerals(x, y, text, size, color, bgcolor)
+// Large digits, : . , - $ £ € with a size-pixel cell height. Repeated calls
+// at the same x, y and size only redraw the cells that changed.
+static int l_display_numerals(lua_State *L)
+{
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    const char *text = luaL_checkstring(L, 3);
+    int size = luaL_checkinteger(L, 4);
+    uint16_t color = (uint16_t)luaL_checkinteger(L, 5);
+    uint16_t bgcolor = (uint16_t)luaL_optinteger(L, 6, RGB565_BLACK);
+    
+    if (size < NUMERALS_MIN_SIZE || size > NUMERALS_MAX_SIZE) {
+        return luaL_error(L, "Numeral size must be %d-%d", NUMERALS_MIN_SIZE, NUMERALS_MAX_SIZE);
+    }
+    
+    if (s_recording) {
+        frame_recorded(L, rgb_cmdlist_numerals(s_recording, x, y, text, size, color, bgcolor));
+        lua_pushinteger(L, numerals_width(text, size));
+        lua_pushinteger(L, 0);
+        return 2;
+    }
+    
+    int cells = 0;
+    int width = numerals_draw(x, y, text, size, color, bgcolor, &cells);
+    lua_pushinteger(L, width);
+    lua_pushinteger(L, cells);
+    return 2;
+}
+
+// width = display.numerals_width(text, size)
+static int l_display_numerals_width(lua_State *L)
+{
+    const char *text = luaL_checkstring(L, 1);
+    int size = luaL_checkinteger(L, 2);
+    lua_pushinteger(L, numerals_width(text, size));
+    return 1;
+}
+
+// display.numerals_reset()
+// Forces a full redraw of every readout on its next display.numerals() call
+static int l_display_numerals_reset(lua_State *L)
+{
+    (void)L;
+    numerals_reset();
+    return 0;
+}
+
+// ===================== Batched drawing =====================
+//
+// local b = display.batch()
+// b:rect(x, y, w, h, color, filled)    b:line(x0, y0, x1, y1, color)
+// b:hline(x, y, w, color)              b:vline(x, y, h, color)
+// b:circle(cx, cy, r, color, filled)   b:text(x, y, text, color, font_id)
+// b:image(x, y, w, h, data)            b:clear()
+// display.submit(b [, strip])
+//
+// A recorder keeps its commands until cleared, so static parts of a screen
+// can be recorded once and replayed by display.submit() with no per-call
+// binding cost. Recorder arguments are read with lua_tointeger
+// (non-numbers read as 0).
+
+#define BATCH_MT "display.batch"
+
+typedef struct {
+    rgb_cmdlist_t list;
+    int anchors;            // Image strings held in the uservalue table
+} batch_t;
+
+// Methods carry the batch metatable as upvalue 1, which is cheaper to
+// compare against than luaL_checkudata's registry lookup by name
+static batch_t *check_batch(lua_State *L, int idx)
+{
+    batch_t *b = (batch_t *)lua_touserdata(L, idx);
+    if (b && lua_getmetatable(L, idx)) {
+        bool ok = lua_rawequal(L, -1, lua_upvalueindex(1));
+        lua_pop(L, 1);
+        if (ok) return b;
+    }
+    luaL_typeerror(L, idx, BATCH_MT);
+    return NULL;
+}
+
+#define ARG(i) ((int)lua_tointeger(L, (i)))
+#define APPENDED(ok) ((ok) ? 0 : luaL_error(L, "Out of memory for draw commands"))
+
+// display.batch() -> recorder
+static int l_display_batch(lua_State *L)
+{
+    batch_t *b = (batch_t *)lua_newuserdatauv(L, sizeof(batch_t), 1);
+    rgb_cmdlist_init(&b->list);
+    b->anchors = 0;
+    lua_newtable(L);
+    lua_setiuservalue(L, -2, 1);
+    luaL_setmetatable(L, BATCH_MT);
+    return 1;
+}
+
+static int l_batch_rect(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    return APPENDED(rgb_cmdlist_rect(&b->list, ARG(2), ARG(3), ARG(4), ARG(5), ARG(6), lua_toboolean(L, 7)));
+}
+
+static int l_batch_line(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    return APPENDED(rgb_cmdlist_line(&b->list, ARG(2), ARG(3), ARG(4), ARG(5), ARG(6)));
+}
+
+static int l_batch_polyline(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    int count, next;
+    const int16_t *points = check_points(L, 2, &count, &next);
+    return APPENDED(rgb_cmdlist_polyline(&b->list, points, count, ARG(next)));
+}
+
+static int l_batch_fill_under(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    int count, next;
+    const int16_t *points = check_points(L, 2, &count, &next);
+    return APPENDED(rgb_cmdlist_fill_under(&b->list, points, count, ARG(next), ARG(next + 1)));
+}
+
+static int l_batch_hline(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    return APPENDED(rgb_cmdlist_hline(&b->list, ARG(2), ARG(3), ARG(4), ARG(5)));
+}
+
+static int l_batch_vline(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    return APPENDED(rgb_cmdlist_vline(&b->list, ARG(2), ARG(3), ARG(4), ARG(5)));
+}
+
+static int l_batch_circle(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    return APPENDED(rgb_cmdlist_circle(&b->list, ARG(2), ARG(3), ARG(4), ARG(5), lua_toboolean(L, 6)));
+}
+
+static int l_batch_text(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    const char *text = luaL_checkstring(L, 4);
+    int font_id = luaL_optinteger(L, 6, FONT_DEFAULT);
+    if (!font_is_valid(font_id)) {
+        font_id = FONT_DEFAULT;
+    }
+    return APPENDED(rgb_cmdlist_text(&b->list, ARG(2), ARG(3), text, ARG(5), font_id));
+}
+
+static int l_batch_image(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    int w = ARG(4);
+    int h = ARG(5);
+    size_t len;
+    const char *data = luaL_checklstring(L, 6, &len);
+    if (w < 0 || h < 0 || len < (size_t)w * h * 2) {
+        return luaL_error(L, "Image data too short: expected %d bytes, got %d", w * h * 2, (int)len);
+    }
+    
+    // The uservalue table keeps the string alive while the command exists
+    lua_getiuservalue(L, 1, 1);
+    lua_pushvalue(L, 6);
+    lua_rawseti(L, -2, ++b->anchors);
+    lua_pop(L, 1);
+    
+    return APPENDED(rgb_cmdlist_image(&b->list, ARG(2), ARG(3), w, h, (const uint16_t *)data));
+}
+
+// b:clear()
+static int l_batch_clear(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    rgb_cmdlist_reset(&b->list);
+    b->anchors = 0;
+    lua_newtable(L);
+    lua_setiuservalue(L, 1, 1);
+    return 0;
+}
+
+static int l_batch_len(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    lua_pushinteger(L, b->list.count);
+    return 1;
+}
+
+static int l_batch_gc(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    rgb_cmdlist_free(&b->list);
+    return 0;
+}
+
+// display.submit(batch [, strip])
+// strip: rows per band (true = RGB_CMDLIST_STRIP_HEIGHT); omitted or
+// false runs the commands in recording order. Inside a frame the commands
+// are added to the frame instead.
+static int l_display_submit(lua_State *L)
+{
+    batch_t *b = check_batch(L, 1);
+    if (s_recording) {
+        frame_anchor(L, 1);
+        return frame_recorded(L, rgb_cmdlist_append(s_recording, &b->list));
+    }
+    
+    int strip = 0;
+    if (lua_isinteger(L, 2)) {
+        strip = (int)lua_tointeger(L, 2);
+    } else if (lua_toboolean(L, 2)) {
+        strip = RGB_CMDLIST_STRIP_HEIGHT;
+    }
+    
+    rgb_cmdlist_execute(&b->list, strip);
+    return 0;
+}
+
+#undef ARG
+#undef APPENDED
+
+// ===================== Frames =====================
+
+bool lua_display_in_frame(void)
+{
+    return s_recording != NULL;
+}
+
+// display.begin_frame()
+// Record the draw calls that follow instead of drawing them; frames
+// don't nest
+static int l_display_begin_frame(lua_State *L)
+{
+    if (s_recording) {
+        return luaL_error(L, "display.begin_frame() inside a frame");
+    }
+    s_recording = &s_frames[s_frame_index];
+    rgb_cmdlist_reset(s_recording);
+    lua_newtable(L);
+    lua_rawsetp(L, LUA_REGISTRYINDEX, &s_frame_anchor_keys[s_frame_index]);
+    return 0;
+}
+
+// commands_run, dirty_pixels = display.end_frame()
+// Draw the recorded frame, repainting only the regions that differ from
+// the previous frame (everything after display.invalidate())
+static int l_display_end_frame(lua_State *L)
+{
+    if (!s_recording) {
+        return luaL_error(L, "display.end_frame() without begin_frame()");
+    }
+    
+    rgb_cmdlist_diff_t stats;
+    const rgb_cmdlist_t *prev = s_frame_prev_valid ? &s_frames[s_frame_index ^ 1] : NULL;
+    rgb_cmdlist_execute_diff(prev, s_recording, &stats);
+    
+    s_recording = NULL;
+    s_frame_prev_valid = true;
+    s_frame_index ^= 1;
+    
+    lua_pushinteger(L, stats.executed);
+    lua_pushinteger(L, stats.dirty_pixels);
+    return 2;
+}
+
+// display.invalidate()
+// Redraw the next frame in full (after drawing outside of frames)
+static int l_display_invalidate(lua_State *L)
+{
+    (void)L;
+    s_frame_prev_valid = false;
+    return 0;
+}
+
+// ===================== Canvases =====================
+
+#define CANVAS_MT "display.canvas"
+
+typedef struct {
+    rgb_surface_t *surface;
+} canvas_t;
+
+static rgb_surface_t *check_canvas(lua_State *L, int idx)
+{
+    canvas_t *c = (canvas_t *)luaL_checkudata(L, idx, CANVAS_MT);
+    return c->surface;
+}
+
+// Also used by modules that decode into canvases
+rgb_surface_t *lua_display_check_canvas(lua_State *L, int idx)
+{
+    return check_canvas(L, idx);
+}
+
+// display.canvas(w, h [, internal]) -> canvas, cleared to black
+// Offscreen RGB565 surface in PSRAM, or internal RAM when internal is true
+static int l_display_canvas(lua_State *L)
+{
+    int w = luaL_checkinteger(L, 1);
+    int h = luaL_checkinteger(L, 2);
+    bool internal = lua_toboolean(L, 3);
+    
+    canvas_t *c = (canvas_t *)lua_newuserdatauv(L, sizeof(canvas_t), 0);
+    c->surface = NULL;
+    luaL_setmetatable(L, CANVAS_MT);
+    
+    c->surface = rgb_surface_create(w, h, internal);
+    if (!c->surface) {
+        return luaL_error(L, "Failed to allocate %dx%d canvas", w, h);
+    }
+    memset(c->surface->pixels, 0, (size_t)w * h * sizeof(uint16_t));
+    return 1;
+}
+
+// display.blit(canvas, x, y)
+static int l_display_blit(lua_State *L)
+{
+    rgb_surface_t *src = check_canvas(L, 1);
+    int x = luaL_optinteger(L, 2, 0);
+    int y = luaL_optinteger(L, 3, 0);
+    
+    if (s_recording) {
+        frame_anchor(L, 1);
+        return frame_recorded(L, rgb_cmdlist_blit(s_recording, src, x, y));
+    }
+    rgb_display_blit(src, x, y);
+    return 0;
+}
+
+// canvas:rect(...), canvas:text_font(...), ...
+// Calls the display function held as upvalue 1 with the canvas as drawing
+// target, then returns drawing to the screen with its clip. Inside a frame
+// the canvas is still drawn immediately.
+static int l_canvas_draw(lua_State *L)
+{
+    rgb_surface_t *surface = check_canvas(L, 1);
+    int nargs = lua_gettop(L) - 1;
+    
+    rgb_display_clip_t clip = *rgb_display_get_clip();
+    rgb_cmdlist_t *recording = s_recording;
+    s_recording = NULL;
+    rgb_display_set_target(surface);
+    
+    // Argument errors must not leave the canvas as the target
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_rotate(L, 2, 1);
+    int status = lua_pcall(L, nargs, LUA_MULTRET, 0);
+    
+    rgb_display_set_target(NULL);
+    rgb_display_set_clip(clip.x0, clip.y0, clip.x1 - clip.x0, clip.y1 - clip.y0);
+    s_recording = recording;
+    
+    if (status != LUA_OK) {
+        return lua_error(L);
+    }
+    return lua_gettop(L) - 1;
+}
+
+// w, h = canvas:size()
+static int l_canvas_size(lua_State *L)
+{
+    rgb_surface_t *surface = check_canvas(L, 1);
+    lua_pushinteger(L, surface->width);
+    lua_pushinteger(L, surface->height);
+    return 2;
+}
+
+static int l_canvas_gc(lua_State *L)
+{
+    canvas_t *c = (canvas_t *)luaL_checkudata(L, 1, CANVAS_MT);
+    rgb_surface_free(c->surface);
+    c->surface = NULL;
+    return 0;
+}
+
+// ===================== Images =====================
+
+#define IMAGE_MT "display.image"
+
+typedef struct {
+    rgb_image_t *image;
+} image_ud_t;
+
+static rgb_image_t *check_image(lua_State *L, int idx)
+{
+    image_ud_t *ud = (image_ud_t *)luaL_checkudata(L, idx, IMAGE_MT);
+    return ud->image;
+}
+
+// Same check for display functions, which hold the image metatable as
+// upvalue 2 (like the batch metatable, cheaper than a lookup by name)
+static rgb_image_t *check_image_arg(lua_State *L, int idx)
+{
+    image_ud_t *ud = (image_ud_t *)lua_touserdata(L, idx);
+    if (ud && lua_getmetatable(L, idx)) {
+        bool ok = lua_rawequal(L, -1, lua_upvalueindex(2));
+        lua_pop(L, 1);
+        if (ok) return ud->image;
+    }
+    luaL_typeerror(L, idx, IMAGE_MT);
+    return NULL;
+}
+
+rgb_image_t *lua_display_check_image(lua_State *L, int idx)
+{
+    return check_image(L, idx);
+}
+
+// Also used by the image module for decoded images
+void lua_display_push_image(lua_State *L, rgb_image_t *image)
+{
+    image_ud_t *ud = (image_ud_t *)lua_newuserdatauv(L, sizeof(image_ud_t), 0);
+    ud->image = image;
+    luaL_setmetatable(L, IMAGE_MT);
+}
+
+// Read up to max colors from the array at idx; returns the count
+static int read_colors(lua_State *L, int idx, uint16_t *colors, int max)
+{
+    int count = (int)lua_rawlen(L, idx);
+    if (count > max) count = max;
+    for (int i = 0; i < count; i++) {
+        lua_rawgeti(L, idx, i + 1);
+        colors[i] = (uint16_t)lua_tointeger(L, -1);
+        lua_pop(L, 1);
+    }
+    return count;
+}
+
+// img = display.new_image(w, h, data [, format [, palette [, key]]])
+// data: rows of pixels in the given format (display.IMAGE_*, default
+// RGB565), copied once into PSRAM; palette: array of RGB565 colors for
+// indexed formats; key: palette index left transparent
+static int l_display_new_image(lua_State *L)
+{
+    int w = luaL_checkinteger(L, 1);
+    int h = luaL_checkinteger(L, 2);
+    size_t len;
+    const char *data = luaL_checklstring(L, 3, &len);
+    int format = luaL_optinteger(L, 4, RGB_IMAGE_RGB565);
+    int key = luaL_optinteger(L, 6, RGB_IMAGE_NO_KEY);
+    
+    if (format < 0 || format >= RGB_IMAGE_FORMAT_COUNT || w <= 0 || h <= 0 ||
+        w > UINT16_MAX || h > UINT16_MAX || rgb_image_stride(format, w) > UINT16_MAX) {
+        return luaL_error(L, "Invalid image format or size");
+    }
+    size_t expected_len = rgb_image_stride(format, w) * h;
+    if (len < expected_len) {
+        return luaL_error(L, "Image data too short: expected %d bytes, got %d", (int)expected_len, (int)len);
+    }
+    
+    uint16_t palette[256];
+    int palette_size = 0;
+    if (lua_istable(L, 5)) {
+        palette_size = read_colors(L, 5, palette, 256);
+    }
+    
+    rgb_image_t *image = rgb_image_create(format, w, h, data, palette_size ? palette : NULL, palette_size);
+    if (!image) {
+        return luaL_error(L, "Failed to allocate %dx%d image", w, h);
+    }
+    image->key = key;
+    lua_display_push_image(L, image);
+    return 1;
+}
+
+// img = display.map_image(name)
+// Image asset used in place from the asset partition
+static int l_display_map_image(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    rgb_image_t *image = rgb_image_map(name);
+    if (!image) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Image not found: %s", name);
+        return 2;
+    }
+    lua_display_push_image(L, image);
+    return 1;
+}
+
+// display.image(x, y, img [, tint]) for image objects
+// tint: a color (ink of A8 images, default white) or an array of colors
+// replacing the first palette entries for this draw only
+static int draw_image_object(lua_State *L)
+{
+    rgb_image_t *image = check_image_arg(L, 3);
+    int x = luaL_checkinteger(L, 1);
+    int y = luaL_checkinteger(L, 2);
+    uint16_t color = RGB565_WHITE;
+    uint16_t tint[256];
+    const uint16_t *palette = NULL;
+    
+    if (lua_istable(L, 4) && image->palette_size) {
+        memcpy(tint, image->palette, image->palette_size * sizeof(uint16_t));
+        read_colors(L, 4, tint, image->palette_size);
+        palette = tint;
+    } else if (!lua_isnoneornil(L, 4)) {
+        color = (uint16_t)luaL_checkinteger(L, 4);
+    }
+    
+    if (s_recording) {
+        frame_anchor(L, 3);
+        return frame_recorded(L, rgb_cmdlist_bitmap(s_recording, image, x, y, palette, color));
+    }
+    rgb_image_draw(image, x, y, palette, color);
+    return 0;
+}
+
+// w, h, format = img:size()
+static int l_image_size(lua_State *L)
+{
+    rgb_image_t *image = check_image(L, 1);
+    lua_pushinteger(L, image->width);
+    lua_pushinteger(L, image->height);
+    lua_pushinteger(L, image->format);
+    return 3;
+}
+
+// img:set_palette(colors [, first])
+// Replace palette entries from index first (0-based, default 0)
+static int l_image_set_palette(lua_State *L)
+{
+    rgb_image_t *image = check_image(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    int first = luaL_optinteger(L, 3, 0);
+    uint16_t colors[256];
+    int count = read_colors(L, 2, colors, 256);
+    rgb_image_set_palette(image, first, colors, count);
+    return 0;
+}
+
+static int l_image_gc(lua_State *L)
+{
+    image_ud_t *ud = (image_ud_t *)luaL_checkudata(L, 1, IMAGE_MT);
+    rgb_image_free(ud->image);
+    ud->image = NULL;
+    return 0;
+}
+
+static const luaL_Reg image_methods[] = {
+    {"size",        l_image_size},
+    {"set_palette", l_image_set_palette},
+    {NULL, NULL}
+};
+
+// display functions available as canvas methods
+static const char *const canvas_draw_methods[] = {
+    "clear", "pixel", "getpixel", "line", "hline", "vline", "rect", "circle",
+    "fill_circle", "triangle", "polyline", "fill_under", "text", "text_font",
+    "image", "blit", NULL
+};
+
+static const luaL_Reg batch_methods[] = {
+    {"rect",   l_batch_rect},
+    {"line",   l_batch_line},
+    {"hline",  l_batch_hline},
+    {"vline",  l_batch_vline},
+    {"circle", l_batch_circle},
+    {"text",   l_batch_text},
+    {"image",  l_batch_image},
+    {"polyline",   l_batch_polyline},
+    {"fill_under", l_batch_fill_under},
+    {"clear",  l_batch_clear},
+    {NULL, NULL}
+};
+
+static const luaL_Reg batch_meta[] = {
+    {"__len", l_batch_len},
+    {"__gc",  l_batch_gc},
+    {NULL, NULL}
+};
+
 // Module function table
 static const luaL_Reg display_lib[] = {
     {"init",      l_display_init},
@@ -269,10 +1159,30 @@ static const luaL_Reg display_lib[] = {
     {"circle",      l_display_circle},
     {"fill_circle", l_display_fill_circle},
     {"triangle",    l_display_triangle},
+    {"polyline",    l_display_polyline},
+    {"fill_under",  l_display_fill_under},
     {"text",      l_display_text},
     {"text_font", l_display_text_font},
     {"setfont",   l_display_setfont},
     {"getfont",   l_display_getfont},
+    {"load_font", l_display_load_font},
+    {"measure",   l_display_measure},
+    {"atlas_stats", l_display_atlas_stats},
+    {"stats",       l_display_stats},
+    {"stats_reset", l_display_stats_reset},
+    {"numerals",       l_display_numerals},
+    {"numerals_width", l_display_numerals_width},
+    {"numerals_reset", l_display_numerals_reset},
+    {"clip",      l_display_clip},
+    {"begin_frame", l_display_begin_frame},
+    {"end_frame",   l_display_end_frame},
+    {"invalidate",  l_display_invalidate},
+    {"batch",     l_display_batch},
+    {"submit",    l_display_submit},
+    {"canvas",    l_display_canvas},
+    {"new_image", l_display_new_image},
+    {"map_image", l_display_map_image},
+    {"blit",      l_display_blit},
     {"image",     l_display_image},
     {"backlight", l_display_backlight},
     {"size",      l_display_size},
@@ -282,7 +1192,54 @@ static const luaL_Reg display_lib[] = {
 
 int luaopen_display(lua_State *L)
 {
-    luaL_newlib(L, display_lib);
+    // Strings referenced by the measure cache (entries from a previous
+    // Lua state would point at freed strings)
+    memset(s_measure_cache, 0, sizeof(s_measure_cache));
+    lua_createtable(L, MEASURE_CACHE_SIZE, 0);
+    lua_rawsetp(L, LUA_REGISTRYINDEX, &s_measure_anchors_key);
+    
+    // Frame lists may reference images of a previous Lua state
+    s_recording = NULL;
+    s_frame_prev_valid = false;
+    
+    // Batch recorder metatable
+    luaL_newmetatable(L, BATCH_MT);
+    lua_pushvalue(L, -1);
+    luaL_setfuncs(L, batch_meta, 1);
+    luaL_newlibtable(L, batch_methods);
+    lua_pushvalue(L, -2);
+    luaL_setfuncs(L, batch_methods, 1);
+    lua_setfield(L, -2, "__index");
+    
+    // Image metatable
+    luaL_newmetatable(L, IMAGE_MT);
+    lua_pushcfunction(L, l_image_gc);
+    lua_setfield(L, -2, "__gc");
+    luaL_newlib(L, image_methods);
+    lua_setfield(L, -2, "__index");
+    
+    // display functions that take a batch or image get the metatables too
+    luaL_newlibtable(L, display_lib);
+    lua_pushvalue(L, -3);
+    lua_pushvalue(L, -3);
+    luaL_setfuncs(L, display_lib, 2);
+    lua_remove(L, -2);
+    lua_remove(L, -2);
+    
+    // Canvas metatable; draw methods wrap the display functions
+    luaL_newmetatable(L, CANVAS_MT);
+    lua_pushcfunction(L, l_canvas_gc);
+    lua_setfield(L, -2, "__gc");
+    lua_newtable(L);
+    for (const char *const *name = canvas_draw_methods; *name; name++) {
+        lua_getfield(L, -3, *name);
+        lua_pushcclosure(L, l_canvas_draw, 1);
+        lua_setfield(L, -2, *name);
+    }
+    lua_pushcfunction(L, l_canvas_size);
+    lua_setfield(L, -2, "size");
+    lua_setfield(L, -2, "__index");
+    lua_pop(L, 1);
     
     // Add color constants
     lua_pushinteger(L, RGB565_BLACK);     lua_setfield(L, -2, "BLACK");
@@ -309,5 +1266,11 @@ int luaopen_display(lua_State *L)
     lua_pushinteger(L, FONT_INTER_20);    lua_setfield(L, -2, "FONT_INTER_20");
     lua_pushinteger(L, FONT_GARAMOND_20); lua_setfield(L, -2, "FONT_GARAMOND_20");
     
+    // Add image formats
+    lua_pushinteger(L, RGB_IMAGE_RGB565);   lua_setfield(L, -2, "IMAGE_RGB565");
+    lua_pushinteger(L, RGB_IMAGE_INDEXED4); lua_setfield(L, -2, "IMAGE_INDEXED4");
+    lua_pushinteger(L, RGB_IMAGE_INDEXED8); lua_setfield(L, -2, "IMAGE_INDEXED8");
+    lua_pushinteger(L, RGB_IMAGE_A8);       lua_setfield(L, -2, "IMAGE_A8");
+    
     return 1;
 }
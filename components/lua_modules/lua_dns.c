@@ -0,0 +1,449 @@
+/*
+ * Lua DNS Module - resolver cache
+ *
+ * lwIP's netconn_gethostbyname(), and so getaddrinfo() and everything
+ * built on it (esp_http_client, plain sockets), asks
+ * lwip_hook_netconn_external_resolve() first. This module answers that
+ * hook from a small cache of A records, each kept for its TTL clamped to
+ * [min_ttl, max_ttl]. A miss sends the query itself, over UDP to the DNS
+ * servers lwIP was given, since lwIP keeps the TTLs it sees to itself.
+ *
+ * Names that don't exist are cached for negative_ttl. When no server
+ * answers, an expired record is still served for up to stale_ttl past its
+ * expiry, so refreshes keep working through short outages. Anything the
+ * cache doesn't handle (IP literals, .local names, IPv6 lookups, no answer
+ * and nothing stale) falls through to lwIP's own resolver.
+ *
+ * Needs CONFIG_LWIP_HOOK_NETCONN_EXT_RESOLVE_CUSTOM.
+ */
+
+#include <string.h>
+#include <strings.h>
+#include <stdatomic.h>
+#include "lua.h"
+#include "lauxlib.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "lwip/api.h"
+#include "lwip/dns.h"
+#include "lwip/ip_addr.h"
+#include "lwip/sockets.h"
+
+static const char *TAG = "lua_dns";
+
+#define DNS_CACHE_ENTRIES 24
+#define DNS_HOST_LEN 64
+#define DNS_PORT 53
+#define DNS_QUERY_TIMEOUT_MS 2000
+#define DNS_PACKET_MAX 512
+
+// Seconds, until changed with dns.config()
+#define DNS_MIN_TTL 60
+#define DNS_MAX_TTL 3600
+#define DNS_NEGATIVE_TTL 30
+#define DNS_STALE_TTL 600
+
+#define DNS_TYPE_A 1
+#define DNS_CLASS_IN 1
+#define DNS_RCODE_NXDOMAIN 3
+
+typedef enum {
+    LOOKUP_FOUND,
+    LOOKUP_MISSING,                 // No such name, or no A record for it
+    LOOKUP_FAILED,                  // No usable answer
+} lookup_t;
+
+typedef struct {
+    char host[DNS_HOST_LEN];        // "" = free
+    uint32_t addr;                  // Network order; 0 for a missing name
+    int64_t expires;
+    int64_t last_used;
+} dns_entry_t;
+
+// Entries are guarded by s_lock, which is never held over the network
+static dns_entry_t s_cache[DNS_CACHE_ENTRIES];
+static SemaphoreHandle_t s_lock = NULL;
+static StaticSemaphore_t s_lock_buffer;
+
+static atomic_uint s_min_ttl = DNS_MIN_TTL;
+static atomic_uint s_max_ttl = DNS_MAX_TTL;
+static atomic_uint s_negative_ttl = DNS_NEGATIVE_TTL;
+static atomic_uint s_stale_ttl = DNS_STALE_TTL;
+
+static atomic_uint s_hits = 0;
+static atomic_uint s_negative = 0;
+static atomic_uint s_misses = 0;
+static atomic_uint s_stale = 0;
+static atomic_uint s_failures = 0;
+static atomic_uint s_answered = 0;
+static _Atomic int64_t s_query_us = 0;
+
+// Write a query for the A record of host; its length, 0 if host isn't a
+// valid name
+static int build_query(uint8_t *buf, uint16_t id, const char *host)
+{
+    uint8_t *p = buf;
+    *p++ = id >> 8;
+    *p++ = id & 0xFF;
+    *p++ = 0x01;                    // Recursion desired
+    *p++ = 0x00;
+    *p++ = 0;
+    *p++ = 1;                       // One question
+    memset(p, 0, 6);
+    p += 6;
+
+    while (*host) {
+        size_t len = strcspn(host, ".");
+        if (len == 0 || len > 63) return 0;
+        *p++ = len;
+        memcpy(p, host, len);
+        p += len;
+        host += len;
+        if (*host == '.') host++;
+    }
+    *p++ = 0;
+    *p++ = 0;
+    *p++ = DNS_TYPE_A;
+    *p++ = 0;
+    *p++ = DNS_CLASS_IN;
+    return p - buf;
+}
+
+// Offset just past the name at off, -1 if it runs off the packet
+static int skip_name(const uint8_t *pkt, int len, int off)
+{
+    while (off < len) {
+        uint8_t b = pkt[off];
+        if ((b & 0xC0) == 0xC0) return off + 2 <= len ? off + 2 : -1;
+        if (b == 0) return off + 1;
+        off += b + 1;
+    }
+    return -1;
+}
+
+static inline uint32_t read16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+// The first A record in the reply to query id, with the smallest TTL of
+// the records leading to it (CNAMEs included)
+static lookup_t parse_reply(const uint8_t *pkt, int len, uint16_t id,
+                            uint32_t *addr, uint32_t *ttl)
+{
+    if (len < 12 || read16(pkt) != id || !(pkt[2] & 0x80)) return LOOKUP_FAILED;
+
+    int rcode = pkt[3] & 0x0F;
+    if (rcode == DNS_RCODE_NXDOMAIN) return LOOKUP_MISSING;
+    if (rcode != 0) return LOOKUP_FAILED;
+
+    int questions = read16(&pkt[4]);
+    int answers = read16(&pkt[6]);
+    int off = 12;
+    while (questions-- > 0) {
+        off = skip_name(pkt, len, off);
+        if (off < 0 || off + 4 > len) return LOOKUP_FAILED;
+        off += 4;
+    }
+
+    *ttl = UINT32_MAX;
+    while (answers-- > 0) {
+        off = skip_name(pkt, len, off);
+        if (off < 0 || off + 10 > len) return LOOKUP_FAILED;
+        uint32_t type = read16(&pkt[off]);
+        uint32_t class = read16(&pkt[off + 2]);
+        uint32_t rr_ttl = (read16(&pkt[off + 4]) << 16) | read16(&pkt[off + 6]);
+        int rdlen = read16(&pkt[off + 8]);
+        off += 10;
+        if (off + rdlen > len) return LOOKUP_FAILED;
+
+        if (class == DNS_CLASS_IN) {
+            if (rr_ttl < *ttl) *ttl = rr_ttl;
+            if (type == DNS_TYPE_A && rdlen == 4) {
+                memcpy(addr, &pkt[off], 4);
+                return LOOKUP_FOUND;
+            }
+        }
+        off += rdlen;
+    }
+    // The name exists, but without an A record
+    return LOOKUP_MISSING;
+}
+
+// Ask each DNS server in turn until one gives an answer
+static lookup_t dns_query(const char *host, uint32_t *addr, uint32_t *ttl)
+{
+    uint8_t query[DNS_PACKET_MAX];
+    uint8_t reply[DNS_PACKET_MAX];
+    uint16_t id = esp_random() & 0xFFFF;
+    int query_len = build_query(query, id, host);
+    if (query_len == 0) return LOOKUP_FAILED;
+
+    for (int i = 0; i < DNS_MAX_SERVERS; i++) {
+        const ip_addr_t *server = dns_getserver(i);
+        if (!server || !IP_IS_V4(server) || ip_addr_isany(server)) continue;
+
+        int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (sock < 0) return LOOKUP_FAILED;
+
+        struct timeval tv = {
+            .tv_sec = DNS_QUERY_TIMEOUT_MS / 1000,
+            .tv_usec = (DNS_QUERY_TIMEOUT_MS % 1000) * 1000,
+        };
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+        struct sockaddr_in to = {
+            .sin_family = AF_INET,
+            .sin_port = htons(DNS_PORT),
+            .sin_addr.s_addr = ip4_addr_get_u32(ip_2_ip4(server)),
+        };
+        lookup_t result = LOOKUP_FAILED;
+        // Connected, so only this server's replies come back
+        if (connect(sock, (struct sockaddr *)&to, sizeof(to)) == 0 &&
+            send(sock, query, query_len, 0) == query_len) {
+            int len = recv(sock, reply, sizeof(reply), 0);
+            if (len > 0) {
+                result = parse_reply(reply, len, id, addr, ttl);
+            }
+        }
+        close(sock);
+
+        if (result != LOOKUP_FAILED) return result;
+        ESP_LOGW(TAG, "No answer for %s from DNS server %d", host, i);
+    }
+    return LOOKUP_FAILED;
+}
+
+static dns_entry_t *cache_find(const char *host)
+{
+    for (int i = 0; i < DNS_CACHE_ENTRIES; i++) {
+        if (strcasecmp(s_cache[i].host, host) == 0) return &s_cache[i];
+    }
+    return NULL;
+}
+
+// Keep addr for host for ttl seconds, in its old entry, a free one or the
+// least recently used
+static void cache_put(const char *host, uint32_t addr, uint32_t ttl, int64_t now)
+{
+    dns_entry_t *entry = cache_find(host);
+    for (int i = 0; !entry && i < DNS_CACHE_ENTRIES; i++) {
+        if (!s_cache[i].host[0]) entry = &s_cache[i];
+    }
+    if (!entry) {
+        entry = &s_cache[0];
+        for (int i = 1; i < DNS_CACHE_ENTRIES; i++) {
+            if (s_cache[i].last_used < entry->last_used) entry = &s_cache[i];
+        }
+    }
+    strcpy(entry->host, host);
+    entry->addr = addr;
+    entry->expires = now + (int64_t)ttl * 1000000;
+    entry->last_used = now;
+}
+
+// Resolve host through the cache; LOOKUP_FAILED leaves it to lwIP
+static lookup_t dns_resolve(const char *host, uint32_t *addr)
+{
+    if (!s_lock || strlen(host) >= DNS_HOST_LEN) return LOOKUP_FAILED;
+
+    int64_t now = esp_timer_get_time();
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    dns_entry_t *entry = cache_find(host);
+    if (entry && now < entry->expires) {
+        entry->last_used = now;
+        *addr = entry->addr;
+        xSemaphoreGive(s_lock);
+        if (*addr) {
+            s_hits++;
+            return LOOKUP_FOUND;
+        }
+        s_negative++;
+        return LOOKUP_MISSING;
+    }
+    xSemaphoreGive(s_lock);
+
+    s_misses++;
+    uint32_t ttl = 0;
+    lookup_t result = dns_query(host, addr, &ttl);
+    int64_t done = esp_timer_get_time();
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (result != LOOKUP_FAILED) {
+        s_answered++;
+        s_query_us += done - now;
+        if (result == LOOKUP_FOUND) {
+            uint32_t min_ttl = s_min_ttl;
+            uint32_t max_ttl = s_max_ttl;
+            cache_put(host, *addr, ttl < min_ttl ? min_ttl : ttl > max_ttl ? max_ttl : ttl, done);
+        } else {
+            cache_put(host, 0, s_negative_ttl, done);
+        }
+    } else {
+        entry = cache_find(host);
+        if (entry && entry->addr && done < entry->expires + (int64_t)s_stale_ttl * 1000000) {
+            ESP_LOGW(TAG, "DNS unavailable, using the expired address of %s", host);
+            entry->last_used = done;
+            *addr = entry->addr;
+            result = LOOKUP_FOUND;
+            s_stale++;
+        } else {
+            s_failures++;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return result;
+}
+
+// Called by lwIP before it resolves name itself; 1 with *err set if the
+// cache answered
+int lwip_hook_netconn_external_resolve(const char *name, ip_addr_t *addr, u8_t addrtype,
+                                       err_t *err)
+{
+#if LWIP_IPV4 && LWIP_IPV6
+    if (addrtype == NETCONN_DNS_IPV6) return 0;
+#else
+    (void)addrtype;
+#endif
+
+    ip4_addr_t literal;
+    size_t len = strlen(name);
+    if (ip4addr_aton(name, &literal) || !strchr(name, '.') ||
+        (len > 6 && strcasecmp(name + len - 6, ".local") == 0)) {
+        return 0;
+    }
+
+    uint32_t found;
+    switch (dns_resolve(name, &found)) {
+        case LOOKUP_FOUND:
+            ip_addr_set_ip4_u32(addr, found);
+            *err = ERR_OK;
+            return 1;
+        case LOOKUP_MISSING:
+            *err = ERR_VAL;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// addr, err = dns.resolve(host)
+// The address host resolves to, as getaddrinfo() would see it (blocks)
+static int lua_dns_resolve(lua_State *L)
+{
+    const char *host = luaL_checkstring(L, 1);
+    ip_addr_t addr;
+    char text[IPADDR_STRLEN_MAX];
+
+    if (netconn_gethostbyname(host, &addr) != ERR_OK) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Cannot resolve %s", host);
+        return 2;
+    }
+    lua_pushstring(L, ipaddr_ntoa_r(&addr, text, sizeof(text)));
+    return 1;
+}
+
+// stats = dns.stats([reset])
+// Cache entries and lookup counters; reset clears the counters after reading
+static int lua_dns_stats(lua_State *L)
+{
+    bool reset = lua_toboolean(L, 1);
+    int entries = 0;
+    int64_t now = esp_timer_get_time();
+
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        for (int i = 0; i < DNS_CACHE_ENTRIES; i++) {
+            if (s_cache[i].host[0] && now < s_cache[i].expires) entries++;
+        }
+        xSemaphoreGive(s_lock);
+    }
+
+    uint32_t answered = s_answered;
+    lua_createtable(L, 0, 7);
+    lua_pushinteger(L, entries);    lua_setfield(L, -2, "entries");
+    lua_pushinteger(L, s_hits);     lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, s_negative); lua_setfield(L, -2, "negative");
+    lua_pushinteger(L, s_misses);   lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, s_stale);    lua_setfield(L, -2, "stale");
+    lua_pushinteger(L, s_failures); lua_setfield(L, -2, "failures");
+    lua_pushinteger(L, answered ? s_query_us / answered / 1000 : 0);
+    lua_setfield(L, -2, "lookup_ms");
+
+    if (reset) {
+        s_hits = 0;
+        s_negative = 0;
+        s_misses = 0;
+        s_stale = 0;
+        s_failures = 0;
+        s_answered = 0;
+        s_query_us = 0;
+    }
+    return 1;
+}
+
+static void opt_ttl(lua_State *L, const char *key, atomic_uint *ttl)
+{
+    if (lua_getfield(L, 1, key) != LUA_TNIL) {
+        lua_Integer value = luaL_checkinteger(L, -1);
+        if (value < 0) luaL_error(L, "%s must not be negative", key);
+        *ttl = (uint32_t)value;
+    }
+    lua_pop(L, 1);
+}
+
+// settings = dns.config([{min_ttl, max_ttl, negative_ttl, stale_ttl}])
+// Change the given TTL bounds (seconds); returns them all
+static int lua_dns_config(lua_State *L)
+{
+    if (!lua_isnoneornil(L, 1)) {
+        luaL_checktype(L, 1, LUA_TTABLE);
+        opt_ttl(L, "min_ttl", &s_min_ttl);
+        opt_ttl(L, "max_ttl", &s_max_ttl);
+        opt_ttl(L, "negative_ttl", &s_negative_ttl);
+        opt_ttl(L, "stale_ttl", &s_stale_ttl);
+        if (s_max_ttl < s_min_ttl) s_max_ttl = (uint32_t)s_min_ttl;
+    }
+
+    lua_createtable(L, 0, 4);
+    lua_pushinteger(L, s_min_ttl);      lua_setfield(L, -2, "min_ttl");
+    lua_pushinteger(L, s_max_ttl);      lua_setfield(L, -2, "max_ttl");
+    lua_pushinteger(L, s_negative_ttl); lua_setfield(L, -2, "negative_ttl");
+    lua_pushinteger(L, s_stale_ttl);    lua_setfield(L, -2, "stale_ttl");
+    return 1;
+}
+
+// dns.flush()
+// Forget every cached name, e.g. after moving to another network
+static int lua_dns_flush(lua_State *L)
+{
+    (void)L;
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        memset(s_cache, 0, sizeof(s_cache));
+        xSemaphoreGive(s_lock);
+    }
+    return 0;
+}
+
+static const luaL_Reg dns_funcs[] = {
+    {"resolve", lua_dns_resolve},
+    {"stats", lua_dns_stats},
+    {"config", lua_dns_config},
+    {"flush", lua_dns_flush},
+    {NULL, NULL}
+};
+
+int luaopen_dns(lua_State *L)
+{
+    // Opened at boot, before anything touches the network
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutexStatic(&s_lock_buffer);
+    }
+    luaL_newlib(L, dns_funcs);
+    return 1;
+}
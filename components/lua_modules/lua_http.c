@@ -1,122 +1,1561 @@
 /*
  * Lua HTTP Module for ESP32
+ *
+ * Clients are kept in a small pool per scheme://host:port once a request
+ * completes, so the next request to the same host reuses the open
+ * keep-alive connection and skips the TCP connect and TLS handshake.
+ * Idle clients are closed after HTTP_POOL_IDLE_US; when the pool is full
+ * the least recently used idle one makes room.
+ *
+ * Requests run on HTTP_WORKERS worker tasks sharing one queue, so that
+ * many can be in flight at once; the pool and the cache each have a mutex,
+ * held only while a client or entry is picked or updated, never over the
+ * network. The Lua task queues requests and the workers push each
+ * finished one onto a lock-free completion list that the Lua task drains
+ * when it polls or waits, so http.request_async() never blocks the VM.
+ * http.get and http.post wait for their request, yielding instead when
+ * called from a coroutine.
+ *
+ * The body goes to a sink as each chunk arrives: a PSRAM buffer by
+ * default (presized from Content-Length when the server sends it, else
+ * doubled as it fills, and recycled between requests), or for an
+ * on_chunk request a small stream buffer that the Lua task empties into
+ * the callback as it polls, so large bodies stream through at constant
+ * memory. C code can supply its own sink with lua_http_stream(), or read
+ * a body from the stream buffer with lua_http_open() and lua_http_read(),
+ * as image.fetch and jpeg.fetch do; those bodies are held to the size
+ * limit of buffered ones.
+ *
+ * Buffered GETs go through a validation cache kept per URL in PSRAM. A
+ * response still within its Cache-Control max-age is served without a
+ * request; otherwise the stored ETag / Last-Modified go out as
+ * If-None-Match / If-Modified-Since and a 304 is answered from the cache.
+ * Requests made with cache = "persist" also keep small entries in NVS, so
+ * they revalidate instead of downloading again after a restart.
+ *
+ * gzip and deflate are accepted. Compressed bodies are inflated with the
+ * ROM tinfl through a wrapping 32KB window as they arrive, so sinks (and
+ * the cache) only ever see the decoded body.
  */
 
+#include <stdio.h>
 #include <string.h>
+#include <strings.h>
 #include <stdlib.h>
+#include <stdatomic.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/stream_buffer.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "esp_http_client.h"
 #include "esp_tls.h"
 #include "esp_crt_bundle.h"
+#include "nvs.h"
+#include "miniz.h"
+#include "esp_rom_crc.h"
 
 #include "lua.h"
 #include "lauxlib.h"
 #include "lualib.h"
+#include "lua_modules.h"
 
 static const char *TAG = "lua_http";
 
-#define HTTP_MAX_RESPONSE_SIZE (16 * 1024)
+// Bodies of unknown length start in HTTP_BUFFER_INITIAL and double up to
+// HTTP_MAX_RESPONSE_SIZE; up to HTTP_BUFFER_SPARES buffers no larger than
+// HTTP_BUFFER_KEEP wait for the next request
+#define HTTP_MAX_RESPONSE_SIZE (512 * 1024)
+#define HTTP_BUFFER_INITIAL (4 * 1024)
+#define HTTP_BUFFER_KEEP (64 * 1024)
+#define HTTP_BUFFER_SPARES 2
+#define HTTP_USER_AGENT "MoonshotDashboard/1.0 ESP32"
+
+// Each idle TLS client holds its mbedTLS buffers, so the pool stays small
+#define HTTP_POOL_SIZE 3
+#define HTTP_POOL_IDLE_US (60 * 1000000LL)
+#define HTTP_POOL_KEY_LEN 96
+
+// Requests in flight at once; no more than the pool holds, so each worker
+// can keep its connection
+#define HTTP_WORKERS 3
+
+// TLS handshakes need most of the stack
+#define HTTP_WORKER_STACK 8192
+#define HTTP_WORKER_PRIORITY 5
+#define HTTP_QUEUE_LEN 16
+
+// on_chunk requests: bytes in flight between the worker and the Lua task,
+// and the most passed to on_chunk at once
+#define HTTP_STREAM_BUFFER 4096
+#define HTTP_STREAM_CHUNK 1024
+#define HTTP_STREAM_POLL_MS 20
+
+// Validation cache: entries and bytes held in PSRAM, the largest body
+// cached, and the largest kept in NVS (whose partition is 24KB)
+#define HTTP_CACHE_ENTRIES 16
+#define HTTP_CACHE_MAX_BYTES (256 * 1024)
+#define HTTP_CACHE_MAX_ENTRY (64 * 1024)
+#define HTTP_CACHE_PERSIST_MAX (4 * 1024)
+#define HTTP_CACHE_NAMESPACE "http_cache"
+#define HTTP_VALIDATOR_LEN 96
+
+#define GZIP_FHCRC    0x02
+#define GZIP_FEXTRA   0x04
+#define GZIP_FNAME    0x08
+#define GZIP_FCOMMENT 0x10
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+#define REQUEST_MT "http.request"
+
+typedef struct {
+    size_t size;                    // Bytes allocated for data
+    char data[];
+} http_buffer_t;
 
 typedef struct {
-    char *buffer;
-    int buffer_len;
-    int buffer_size;
+    http_buffer_t *buffer;          // NULL until the first chunk
+    size_t len;
+    size_t content_length;          // From the headers, 0 if not sent
+    esp_err_t err;                  // Why the body was cut short
 } http_response_t;
 
-static esp_err_t http_event_handler(esp_http_client_event_t *evt)
+enum {
+    REQ_QUEUED,
+    REQ_RUNNING,
+    REQ_CANCELLED,
+};
+
+// How a request uses the cache
+enum {
+    CACHE_OFF,
+    CACHE_MEMORY,
+    CACHE_PERSIST,      // Also in NVS
+};
+
+// Content-Encoding of a response
+enum {
+    ENC_IDENTITY,
+    ENC_GZIP,
+    ENC_DEFLATE,
+};
+
+// Inflate stages, from the gzip header fields (each skipped if its flag
+// isn't set) or the zlib/raw check of deflate, to the data
+typedef enum {
+    GZIP_FIXED,         // 10 byte header
+    GZIP_EXTRA_LEN,
+    GZIP_EXTRA,
+    GZIP_NAME,
+    GZIP_COMMENT,
+    GZIP_HCRC,
+    DEFLATE_CHECK,      // First two bytes: zlib header or not
+    INFLATE_DATA,
+    GZIP_TRAILER,       // CRC-32 and size of the data
+    INFLATE_DONE,
+} inflate_stage_t;
+
+typedef struct {
+    tinfl_decompressor inflator;
+    inflate_stage_t stage;
+    int flags;                      // Extra tinfl flags
+    uint8_t hold[10];
+    size_t held;
+    size_t skip;                    // gzip extra field bytes left
+    uint8_t gzip_flags;
+    uint32_t crc;
+    size_t window_pos;
+    size_t inflated;
+    uint8_t window[TINFL_LZ_DICT_SIZE];
+} http_inflate_t;
+
+// Where a response came from
+enum {
+    FROM_NETWORK,
+    FROM_CACHE,         // Still fresh, no request made
+    FROM_REVALIDATED,   // 304 Not Modified
+};
+
+// Response headers the cache goes by
+typedef struct {
+    char etag[HTTP_VALIDATOR_LEN];
+    char last_modified[HTTP_VALIDATOR_LEN];
+    int max_age;                    // -1 if not given
+    int age;
+    bool no_store;
+    bool no_cache;
+} http_cache_headers_t;
+
+typedef struct {
+    uint32_t hash;
+    int64_t fresh_until;            // esp_timer time; 0 = revalidate first
+    int64_t last_used;
+    const char *url;
+    const char *etag;               // NULL if the server sent none
+    const char *last_modified;
+    const char *body;
+    size_t len;
+    size_t size;                    // Bytes allocated, counted in the budget
+    bool persisted;                 // Same validators and body are in NVS
+} http_cache_entry_t;
+
+// NVS blob: this header, then the URL, ETag and Last-Modified (without
+// terminators) and the body
+typedef struct {
+    uint16_t url_len;
+    uint16_t etag_len;
+    uint16_t last_modified_len;
+    uint16_t reserved;
+    uint32_t body_len;
+} http_cache_blob_t;
+
+typedef struct http_req {
+    struct http_req *next;          // Completion list link
+    const char *url;
+    const char *body;               // NULL for a GET
+    const char *content_type;
+    esp_http_client_method_t method;
+    int timeout_ms;
+    int cache;
+    atomic_int state;
+    atomic_bool aborted;            // Stop passing the body to the sink
+    size_t max_size;                // Body limit for a streamed body, 0 for none
+
+    // Body consumer, called on the worker; NULL fills response
+    lua_http_sink_t sink;
+    void *sink_ctx;
+    StreamBufferHandle_t stream;    // on_chunk requests only
+
+    // Set by the worker before completion
+    esp_err_t err;
+    const char *error;              // Static message, NULL on a response
+    int status;
+    bool reused;
+    size_t received;                // Body bytes passed to the sink
+    http_response_t response;
+    http_cache_headers_t headers;
+    // Validators of the cached entry, sent to revalidate it
+    char if_none_match[HTTP_VALIDATOR_LEN];
+    char if_modified_since[HTTP_VALIDATOR_LEN];
+    int encoding;
+    http_inflate_t *inflate;        // Allocated at the first encoded byte
+    int from;
+
+    // Lua task only
+    bool done;                      // Taken off the completion list
+    bool orphaned;                  // Handle collected while in flight
+} http_req_t;
+
+typedef struct {
+    esp_http_client_handle_t client;    // NULL = free slot
+    char key[HTTP_POOL_KEY_LEN];        // scheme://host:port
+    int64_t last_used;
+    bool in_use;
+} http_pool_entry_t;
+
+static http_pool_entry_t s_pool[HTTP_POOL_SIZE];
+
+// Slots are guarded by s_pool_lock; counters are written by the workers
+// and read by pool_stats()
+static atomic_int s_pool_open = 0;
+static atomic_int s_pool_busy = 0;
+static atomic_uint s_pool_hits = 0;
+static atomic_uint s_pool_misses = 0;
+static atomic_uint s_pool_evictions = 0;
+static atomic_uint s_pool_retries = 0;
+
+static QueueHandle_t s_queue = NULL;
+static SemaphoreHandle_t s_completed_sem = NULL;
+static _Atomic(http_req_t *) s_completed = NULL;
+static atomic_bool s_close_idle = false;
+static SemaphoreHandle_t s_pool_lock = NULL;
+static SemaphoreHandle_t s_cache_lock = NULL;
+
+// Taken by the workers, given back by the Lua task
+static _Atomic(http_buffer_t *) s_spares[HTTP_BUFFER_SPARES];
+
+// Entries are guarded by s_cache_lock
+static http_cache_entry_t *s_cache[HTTP_CACHE_ENTRIES];
+static atomic_int s_cache_count = 0;
+static atomic_uint s_cache_bytes = 0;
+static atomic_uint s_cache_hits = 0;
+static atomic_uint s_cache_revalidated = 0;
+static atomic_uint s_cache_misses = 0;
+static atomic_uint s_cache_evictions = 0;
+static atomic_uint s_cache_loads = 0;
+static atomic_uint s_cache_saves = 0;
+static atomic_int s_cache_clear = CACHE_OFF;    // What to clear: CACHE_MEMORY or CACHE_PERSIST too
+
+static http_buffer_t *spare_take(void)
+{
+    for (int i = 0; i < HTTP_BUFFER_SPARES; i++) {
+        http_buffer_t *buffer = atomic_exchange(&s_spares[i], NULL);
+        if (buffer) return buffer;
+    }
+    return NULL;
+}
+
+// Done with a response body: keep its buffer for the next one if there is
+// room, else free it
+static void response_release(http_response_t *response)
+{
+    http_buffer_t *buffer = response->buffer;
+    response->buffer = NULL;
+    response->len = 0;
+    if (!buffer) return;
+
+    if (buffer->size <= HTTP_BUFFER_KEEP) {
+        for (int i = 0; i < HTTP_BUFFER_SPARES; i++) {
+            http_buffer_t *empty = NULL;
+            if (atomic_compare_exchange_strong(&s_spares[i], &empty, buffer)) return;
+        }
+    }
+    free(buffer);
+}
+
+// Room for need bytes: all of Content-Length at once when it is known,
+// else twice the current size (or more). A Content-Length over the limit
+// fails before anything is allocated for it.
+static bool response_reserve(http_response_t *response, size_t need)
+{
+    size_t size = response->buffer ? response->buffer->size : 0;
+    if (need <= size) return true;
+
+    if (need > HTTP_MAX_RESPONSE_SIZE || response->content_length > HTTP_MAX_RESPONSE_SIZE) {
+        response->err = ESP_ERR_INVALID_SIZE;
+        return false;
+    }
+    if (response->content_length >= need) {
+        size = response->content_length;
+    } else {
+        size = size ? size : HTTP_BUFFER_INITIAL;
+        while (size < need) size *= 2;
+        if (size > HTTP_MAX_RESPONSE_SIZE) size = HTTP_MAX_RESPONSE_SIZE;
+    }
+
+    http_buffer_t *buffer = heap_caps_realloc(response->buffer, sizeof(http_buffer_t) + size,
+                                              MALLOC_CAP_SPIRAM);
+    if (!buffer) {
+        ESP_LOGE(TAG, "Failed to grow response buffer to %u bytes", (unsigned)size);
+        response->err = ESP_ERR_NO_MEM;
+        return false;
+    }
+    buffer->size = size;
+    response->buffer = buffer;
+    return true;
+}
+
+// Default sink: collect the body in the response buffer
+static bool response_write(void *ctx, const char *data, int len)
+{
+    http_response_t *response = (http_response_t *)ctx;
+    if (!response_reserve(response, response->len + len)) return false;
+    memcpy(response->buffer->data + response->len, data, len);
+    response->len += len;
+    return true;
+}
+
+static void req_fail(http_req_t *req, esp_err_t err, const char *error)
+{
+    req->err = err;
+    req->error = error;
+}
+
+// Sink of an on_chunk request: hand chunks to the Lua task through the
+// stream buffer, waiting while it is full. Gives up if the Lua side stops
+// reading for the request timeout.
+static bool stream_write(void *ctx, const char *data, int len)
+{
+    http_req_t *req = (http_req_t *)ctx;
+    TickType_t stalled = 0;
+
+    while (len > 0) {
+        if (atomic_load(&req->aborted)) return false;
+        size_t sent = xStreamBufferSend(req->stream, data, len, pdMS_TO_TICKS(HTTP_STREAM_POLL_MS));
+        if (sent == 0) {
+            stalled += pdMS_TO_TICKS(HTTP_STREAM_POLL_MS);
+            if (stalled >= pdMS_TO_TICKS(req->timeout_ms)) {
+                ESP_LOGW(TAG, "Stream of %s not read, dropping the rest", req->url);
+                req->err = ESP_ERR_TIMEOUT;
+                req->error = "Stream not read";
+                return false;
+            }
+            continue;
+        }
+        stalled = 0;
+        data += sent;
+        len -= sent;
+    }
+    return true;
+}
+
+static void copy_validator(char *dst, const char *value)
+{
+    // One cut short would never match, so keep none instead
+    size_t len = strlen(value);
+    if (len < HTTP_VALIDATOR_LEN) {
+        memcpy(dst, value, len + 1);
+    }
+}
+
+static void cache_header(http_cache_headers_t *headers, const char *key, const char *value)
+{
+    if (strcasecmp(key, "ETag") == 0) {
+        copy_validator(headers->etag, value);
+    } else if (strcasecmp(key, "Last-Modified") == 0) {
+        copy_validator(headers->last_modified, value);
+    } else if (strcasecmp(key, "Age") == 0) {
+        headers->age = atoi(value);
+    } else if (strcasecmp(key, "Cache-Control") == 0) {
+        const char *p = value;
+        while (*p) {
+            p += strspn(p, " \t,");
+            size_t len = strcspn(p, ",");
+            if (strncasecmp(p, "no-store", 8) == 0) {
+                headers->no_store = true;
+            } else if (strncasecmp(p, "no-cache", 8) == 0) {
+                headers->no_cache = true;
+            } else if (strncasecmp(p, "max-age=", 8) == 0) {
+                headers->max_age = atoi(p + 8);
+            }
+            p += len;
+        }
+    }
+}
+
+static bool inflate_fail(http_req_t *req)
+{
+    ESP_LOGW(TAG, "Invalid compressed body from %s", req->url);
+    req_fail(req, ESP_ERR_INVALID_RESPONSE, "Invalid compressed body");
+    return false;
+}
+
+// Inflate deflate data into the window, passing each run of output on to
+// the sink before the window wraps over it. Consumes input up to the end
+// of the deflate stream.
+static bool inflate_data(http_req_t *req, const uint8_t **p, size_t *len)
+{
+    http_inflate_t *inf = req->inflate;
+
+    while (inf->stage == INFLATE_DATA) {
+        size_t in_bytes = *len;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - inf->window_pos;
+        uint8_t *out = inf->window + inf->window_pos;
+        tinfl_status status = tinfl_decompress(&inf->inflator, *p, &in_bytes, inf->window,
+                                               out, &out_bytes,
+                                               inf->flags | TINFL_FLAG_HAS_MORE_INPUT);
+        *p += in_bytes;
+        *len -= in_bytes;
+
+        if (out_bytes > 0) {
+            inf->inflated += out_bytes;
+            if (req->encoding == ENC_GZIP) {
+                inf->crc = esp_rom_crc32_le(inf->crc, out, out_bytes);
+            }
+            if (!req->sink(req->sink_ctx, (const char *)out, out_bytes)) return false;
+            inf->window_pos = (inf->window_pos + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+
+        if (status < TINFL_STATUS_DONE) return inflate_fail(req);
+        if (status == TINFL_STATUS_DONE) {
+            // zlib's Adler-32 was checked by tinfl; gzip's CRC follows
+            inf->stage = req->encoding == ENC_GZIP ? GZIP_TRAILER : INFLATE_DONE;
+            inf->held = 0;
+        }
+        if (status == TINFL_STATUS_NEEDS_MORE_INPUT && *len == 0) break;
+    }
+    return true;
+}
+
+static bool gzip_field_present(const http_inflate_t *inf)
+{
+    switch (inf->stage) {
+        case GZIP_EXTRA_LEN: return inf->gzip_flags & GZIP_FEXTRA;
+        case GZIP_EXTRA:     return (inf->gzip_flags & GZIP_FEXTRA) && inf->skip > 0;
+        case GZIP_NAME:      return inf->gzip_flags & GZIP_FNAME;
+        case GZIP_COMMENT:   return inf->gzip_flags & GZIP_FCOMMENT;
+        case GZIP_HCRC:      return inf->gzip_flags & GZIP_FHCRC;
+        default:             return true;
+    }
+}
+
+static void gzip_next_field(http_inflate_t *inf)
+{
+    inf->held = 0;
+    do {
+        inf->stage = inf->stage == GZIP_HCRC ? INFLATE_DATA : inf->stage + 1;
+    } while (inf->stage < INFLATE_DATA && !gzip_field_present(inf));
+}
+
+// Decode an encoded body for the sink. The header is parsed byte by byte,
+// as a chunk may end anywhere in it.
+static bool inflate_write(http_req_t *req, const uint8_t *p, size_t len)
+{
+    http_inflate_t *inf = req->inflate;
+    if (!inf) {
+        inf = heap_caps_malloc(sizeof(http_inflate_t), MALLOC_CAP_SPIRAM);
+        if (!inf) {
+            req_fail(req, ESP_ERR_NO_MEM, "Memory allocation failed");
+            return false;
+        }
+        tinfl_init(&inf->inflator);
+        inf->stage = req->encoding == ENC_GZIP ? GZIP_FIXED : DEFLATE_CHECK;
+        inf->flags = 0;
+        inf->held = 0;
+        inf->crc = 0;
+        inf->window_pos = 0;
+        inf->inflated = 0;
+        req->inflate = inf;
+        // Content-Length counts the compressed bytes, no use for presizing
+        req->response.content_length = 0;
+    }
+
+    while (len > 0 && inf->stage != INFLATE_DONE) {
+        if (inf->stage == INFLATE_DATA) {
+            if (!inflate_data(req, &p, &len)) return false;
+            continue;
+        }
+
+        uint8_t c = *p++;
+        len--;
+        switch (inf->stage) {
+            case GZIP_FIXED:
+                inf->hold[inf->held++] = c;
+                if (inf->held < 10) break;
+                if (inf->hold[0] != 0x1F || inf->hold[1] != 0x8B || inf->hold[2] != 8) {
+                    return inflate_fail(req);
+                }
+                inf->gzip_flags = inf->hold[3];
+                gzip_next_field(inf);
+                break;
+            case GZIP_EXTRA_LEN:
+                inf->hold[inf->held++] = c;
+                if (inf->held < 2) break;
+                inf->skip = inf->hold[0] | (inf->hold[1] << 8);
+                gzip_next_field(inf);
+                break;
+            case GZIP_EXTRA:
+                if (--inf->skip == 0) gzip_next_field(inf);
+                break;
+            case GZIP_NAME:
+            case GZIP_COMMENT:
+                if (c == 0) gzip_next_field(inf);
+                break;
+            case GZIP_HCRC:
+                if (++inf->held == 2) gzip_next_field(inf);
+                break;
+            case DEFLATE_CHECK: {
+                inf->hold[inf->held++] = c;
+                if (inf->held < 2) break;
+                // deflate should come in a zlib wrapper, but some servers
+                // send it raw
+                if ((inf->hold[0] & 0x0F) == 8 && ((inf->hold[0] << 8) | inf->hold[1]) % 31 == 0) {
+                    inf->flags = TINFL_FLAG_PARSE_ZLIB_HEADER;
+                }
+                inf->stage = INFLATE_DATA;
+                const uint8_t *held = inf->hold;
+                size_t held_len = 2;
+                if (!inflate_data(req, &held, &held_len)) return false;
+                break;
+            }
+            case GZIP_TRAILER: {
+                inf->hold[inf->held++] = c;
+                if (inf->held < 8) break;
+                uint32_t crc = inf->hold[0] | inf->hold[1] << 8 | inf->hold[2] << 16 |
+                               (uint32_t)inf->hold[3] << 24;
+                uint32_t size = inf->hold[4] | inf->hold[5] << 8 | inf->hold[6] << 16 |
+                                (uint32_t)inf->hold[7] << 24;
+                if (crc != inf->crc || size != (uint32_t)inf->inflated) return inflate_fail(req);
+                inf->stage = INFLATE_DONE;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+static esp_err_t http_event_handler(esp_http_client_event_t *evt)
+{
+    http_req_t *req = (http_req_t *)evt->user_data;
+
+    switch (evt->event_id) {
+        case HTTP_EVENT_ON_HEADER:
+            if (!req) break;
+            if (strcasecmp(evt->header_key, "Content-Length") == 0) {
+                req->response.content_length = strtoul(evt->header_value, NULL, 10);
+            } else if (strcasecmp(evt->header_key, "Content-Encoding") == 0) {
+                if (strcasecmp(evt->header_value, "gzip") == 0) {
+                    req->encoding = ENC_GZIP;
+                } else if (strcasecmp(evt->header_value, "deflate") == 0) {
+                    req->encoding = ENC_DEFLATE;
+                }
+            } else {
+                cache_header(&req->headers, evt->header_key, evt->header_value);
+            }
+            break;
+        case HTTP_EVENT_ON_DATA:
+            if (req && evt->data_len > 0 && !atomic_load(&req->aborted)) {
+                if (req->max_size && (req->received + evt->data_len > req->max_size ||
+                                      req->response.content_length > req->max_size)) {
+                    req->response.err = ESP_ERR_INVALID_SIZE;
+                    atomic_store(&req->aborted, true);
+                    break;
+                }
+                req->received += evt->data_len;
+                bool ok = req->encoding == ENC_IDENTITY ?
+                          req->sink(req->sink_ctx, evt->data, evt->data_len) :
+                          inflate_write(req, evt->data, evt->data_len);
+                if (!ok) {
+                    atomic_store(&req->aborted, true);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    return ESP_OK;
+}
+
+// The scheme://host[:port] part of a URL, which a connection is bound to;
+// false if there is none or it doesn't fit
+static bool pool_key(const char *url, char *key, size_t size)
+{
+    const char *host = strstr(url, "://");
+    if (!host) return false;
+    host += 3;
+
+    size_t len = (host - url) + strcspn(host, "/?#");
+    if (len >= size) return false;
+    memcpy(key, url, len);
+    key[len] = '\0';
+    return true;
+}
+
+static esp_http_client_handle_t new_client(const char *url, int timeout_ms)
+{
+    esp_http_client_config_t config = {
+        .url = url,
+        .event_handler = http_event_handler,
+        .timeout_ms = timeout_ms,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+        // TCP keep-alive probes notice a dropped idle connection
+        .keep_alive_enable = true,
+    };
+    return esp_http_client_init(&config);
+}
+
+static void pool_drop(http_pool_entry_t *entry)
+{
+    esp_http_client_cleanup(entry->client);
+    entry->client = NULL;
+    if (entry->in_use) s_pool_busy--;
+    s_pool_open--;
+    entry->in_use = false;
+}
+
+// Close clients idle for longer than servers usually keep a connection
+static void pool_expire(int64_t now)
+{
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        http_pool_entry_t *entry = &s_pool[i];
+        if (entry->client && !entry->in_use && now - entry->last_used > HTTP_POOL_IDLE_US) {
+            ESP_LOGD(TAG, "Closing idle connection to %s", entry->key);
+            pool_drop(entry);
+        }
+    }
+}
+
+// A client for url: an idle pooled one for the same host if there is one,
+// else a new one in a free slot or the least recently used idle one.
+// *entry is NULL when the new client couldn't be pooled; *reused is set
+// when the client may carry a connection from an earlier request.
+static esp_http_client_handle_t pool_take(const char *url, int timeout_ms,
+                                          http_pool_entry_t **entry, bool *reused)
+{
+    char key[HTTP_POOL_KEY_LEN];
+
+    *entry = NULL;
+    *reused = false;
+    pool_expire(esp_timer_get_time());
+
+    if (!pool_key(url, key, sizeof(key))) {
+        return new_client(url, timeout_ms);
+    }
+
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        http_pool_entry_t *e = &s_pool[i];
+        if (!e->client || e->in_use || strcmp(e->key, key) != 0) continue;
+        if (esp_http_client_set_url(e->client, url) != ESP_OK) {
+            pool_drop(e);
+            continue;
+        }
+        esp_http_client_set_timeout_ms(e->client, timeout_ms);
+        e->in_use = true;
+        s_pool_busy++;
+        s_pool_hits++;
+        *entry = e;
+        *reused = true;
+        return e->client;
+    }
+
+    http_pool_entry_t *slot = NULL;
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        http_pool_entry_t *e = &s_pool[i];
+        if (!e->client) {
+            slot = e;
+            break;
+        }
+        if (!e->in_use && (!slot || e->last_used < slot->last_used)) {
+            slot = e;
+        }
+    }
+
+    s_pool_misses++;
+    esp_http_client_handle_t client = new_client(url, timeout_ms);
+    if (!client || !slot) return client;
+
+    if (slot->client) {
+        ESP_LOGD(TAG, "Evicting connection to %s", slot->key);
+        pool_drop(slot);
+        s_pool_evictions++;
+    }
+    slot->client = client;
+    strcpy(slot->key, key);
+    slot->in_use = true;
+    s_pool_open++;
+    s_pool_busy++;
+    *entry = slot;
+    return client;
+}
+
+static esp_http_client_handle_t pool_acquire(const char *url, int timeout_ms,
+                                             http_pool_entry_t **entry, bool *reused)
+{
+    xSemaphoreTake(s_pool_lock, portMAX_DELAY);
+    esp_http_client_handle_t client = pool_take(url, timeout_ms, entry, reused);
+    xSemaphoreGive(s_pool_lock);
+    return client;
+}
+
+// Hand a client back after a request. A pooled client goes back idle with
+// its connection open, unless the request failed and left it in an
+// unknown state.
+static void pool_release(esp_http_client_handle_t client, http_pool_entry_t *entry, bool ok)
+{
+    if (!entry) {
+        esp_http_client_cleanup(client);
+        return;
+    }
+
+    xSemaphoreTake(s_pool_lock, portMAX_DELAY);
+    if (!ok) {
+        pool_drop(entry);
+    } else {
+        esp_http_client_set_user_data(client, NULL);
+        entry->in_use = false;
+        entry->last_used = esp_timer_get_time();
+        s_pool_busy--;
+    }
+    xSemaphoreGive(s_pool_lock);
+}
+
+static esp_err_t http_perform(esp_http_client_handle_t client, http_req_t *req)
+{
+    memset(&req->headers, 0, sizeof(req->headers));
+    req->headers.max_age = -1;
+    req->response.content_length = 0;
+    req->encoding = ENC_IDENTITY;
+    free(req->inflate);
+    req->inflate = NULL;
+
+    esp_http_client_set_user_data(client, req);
+    esp_http_client_set_method(client, req->method);
+    esp_http_client_set_header(client, "User-Agent", HTTP_USER_AGENT);
+    esp_http_client_set_header(client, "Accept-Encoding", "gzip, deflate");
+
+    // A reused client keeps the headers and body of its last request
+    if (req->body) {
+        esp_http_client_set_header(client, "Content-Type", req->content_type);
+        esp_http_client_set_post_field(client, req->body, strlen(req->body));
+    } else {
+        esp_http_client_delete_header(client, "Content-Type");
+        esp_http_client_set_post_field(client, NULL, 0);
+    }
+
+    if (req->if_none_match[0]) {
+        esp_http_client_set_header(client, "If-None-Match", req->if_none_match);
+    } else {
+        esp_http_client_delete_header(client, "If-None-Match");
+    }
+    if (req->if_modified_since[0]) {
+        esp_http_client_set_header(client, "If-Modified-Since", req->if_modified_since);
+    } else {
+        esp_http_client_delete_header(client, "If-Modified-Since");
+    }
+
+    return esp_http_client_perform(client);
+}
+
+static uint32_t url_hash(const char *url)
+{
+    uint32_t h = FNV_OFFSET;
+    for (const uint8_t *p = (const uint8_t *)url; *p; p++) {
+        h = (h ^ *p) * FNV_PRIME;
+    }
+    return h;
+}
+
+static void cache_key(uint32_t hash, char *key)
+{
+    snprintf(key, 16, "u%08lx", (unsigned long)hash);
+}
+
+static void cache_remove(int index)
+{
+    s_cache_bytes -= s_cache[index]->size;
+    s_cache_count--;
+    free(s_cache[index]);
+    s_cache[index] = NULL;
+}
+
+static void cache_clear(bool persisted)
+{
+    for (int i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+        if (s_cache[i]) cache_remove(i);
+    }
+
+    nvs_handle_t nvs;
+    if (persisted && nvs_open(HTTP_CACHE_NAMESPACE, NVS_READWRITE, &nvs) == ESP_OK) {
+        nvs_erase_all(nvs);
+        nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+}
+
+// Add an entry, evicting the least recently used ones to make room.
+// Validators may be empty strings for none.
+static http_cache_entry_t *cache_insert(const char *url, uint32_t hash, const char *etag,
+                                        const char *last_modified, const char *body, size_t len)
+{
+    size_t url_len = strlen(url) + 1;
+    size_t etag_len = *etag ? strlen(etag) + 1 : 0;
+    size_t modified_len = *last_modified ? strlen(last_modified) + 1 : 0;
+    size_t size = sizeof(http_cache_entry_t) + url_len + etag_len + modified_len + len;
+
+    int slot = -1;
+    for (;;) {
+        int lru = -1;
+        slot = -1;
+        for (int i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+            if (!s_cache[i]) {
+                if (slot < 0) slot = i;
+            } else if (lru < 0 || s_cache[i]->last_used < s_cache[lru]->last_used) {
+                lru = i;
+            }
+        }
+        if (slot >= 0 && s_cache_bytes + size <= HTTP_CACHE_MAX_BYTES) break;
+        if (lru < 0) return NULL;
+        cache_remove(lru);
+        s_cache_evictions++;
+    }
+
+    http_cache_entry_t *entry = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (!entry) return NULL;
+
+    char *p = (char *)(entry + 1);
+    entry->hash = hash;
+    entry->fresh_until = 0;
+    entry->last_used = esp_timer_get_time();
+    entry->url = memcpy(p, url, url_len);
+    p += url_len;
+    entry->etag = etag_len ? memcpy(p, etag, etag_len) : NULL;
+    p += etag_len;
+    entry->last_modified = modified_len ? memcpy(p, last_modified, modified_len) : NULL;
+    p += modified_len;
+    entry->body = memcpy(p, body, len);
+    entry->len = len;
+    entry->size = size;
+    entry->persisted = false;
+
+    s_cache[slot] = entry;
+    s_cache_bytes += size;
+    s_cache_count++;
+    return entry;
+}
+
+// Copy an entry back out of NVS, if one was saved for url
+static http_cache_entry_t *cache_load(const char *url, uint32_t hash)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(HTTP_CACHE_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) return NULL;
+
+    char key[16];
+    size_t size = 0;
+    http_cache_entry_t *entry = NULL;
+    cache_key(hash, key);
+
+    if (nvs_get_blob(nvs, key, NULL, &size) == ESP_OK && size > sizeof(http_cache_blob_t)) {
+        char *data = malloc(size);
+        http_cache_blob_t blob;
+        if (data && nvs_get_blob(nvs, key, data, &size) == ESP_OK) {
+            memcpy(&blob, data, sizeof(blob));
+            const char *p = data + sizeof(blob);
+            bool valid = sizeof(blob) + blob.url_len + blob.etag_len + blob.last_modified_len +
+                         blob.body_len == size &&
+                         blob.etag_len < HTTP_VALIDATOR_LEN &&
+                         blob.last_modified_len < HTTP_VALIDATOR_LEN &&
+                         blob.url_len == strlen(url) && memcmp(p, url, blob.url_len) == 0;
+            if (valid) {
+                char etag[HTTP_VALIDATOR_LEN];
+                char last_modified[HTTP_VALIDATOR_LEN];
+                p += blob.url_len;
+                memcpy(etag, p, blob.etag_len);
+                etag[blob.etag_len] = '\0';
+                p += blob.etag_len;
+                memcpy(last_modified, p, blob.last_modified_len);
+                last_modified[blob.last_modified_len] = '\0';
+                p += blob.last_modified_len;
+
+                entry = cache_insert(url, hash, etag, last_modified, p, blob.body_len);
+                if (entry) {
+                    entry->persisted = true;
+                    s_cache_loads++;
+                }
+            }
+        }
+        free(data);
+    }
+    nvs_close(nvs);
+    return entry;
+}
+
+static void cache_save(http_cache_entry_t *entry)
+{
+    http_cache_blob_t blob = {
+        .url_len = strlen(entry->url),
+        .etag_len = entry->etag ? strlen(entry->etag) : 0,
+        .last_modified_len = entry->last_modified ? strlen(entry->last_modified) : 0,
+        .body_len = entry->len,
+    };
+    size_t size = sizeof(blob) + blob.url_len + blob.etag_len + blob.last_modified_len + blob.body_len;
+    char *data = malloc(size);
+    if (!data) return;
+
+    char *p = data;
+    memcpy(p, &blob, sizeof(blob));
+    p += sizeof(blob);
+    memcpy(p, entry->url, blob.url_len);
+    p += blob.url_len;
+    if (entry->etag) memcpy(p, entry->etag, blob.etag_len);
+    p += blob.etag_len;
+    if (entry->last_modified) memcpy(p, entry->last_modified, blob.last_modified_len);
+    p += blob.last_modified_len;
+    memcpy(p, entry->body, blob.body_len);
+
+    char key[16];
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(HTTP_CACHE_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        cache_key(entry->hash, key);
+        err = nvs_set_blob(nvs, key, data, size);
+        if (err == ESP_OK) err = nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+    free(data);
+
+    if (err == ESP_OK) {
+        entry->persisted = true;
+        s_cache_saves++;
+    } else {
+        ESP_LOGW(TAG, "Failed to save %s to NVS: %s", entry->url, esp_err_to_name(err));
+    }
+}
+
+// The entry for url, from memory or (for mode CACHE_PERSIST) NVS. Only
+// valid while s_cache_lock is held.
+static http_cache_entry_t *cache_find(const char *url, int mode)
+{
+    uint32_t hash = url_hash(url);
+    for (int i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+        http_cache_entry_t *entry = s_cache[i];
+        if (entry && entry->hash == hash && strcmp(entry->url, url) == 0) {
+            entry->last_used = esp_timer_get_time();
+            return entry;
+        }
+    }
+    return mode == CACHE_PERSIST ? cache_load(url, hash) : NULL;
+}
+
+// Answer req with a cached body
+static void cache_serve(http_req_t *req, const http_cache_entry_t *entry, int from)
+{
+    http_response_t *response = &req->response;
+    response->len = 0;
+    response->content_length = entry->len;
+    if (entry->len && !response_reserve(response, entry->len)) {
+        req_fail(req, ESP_ERR_NO_MEM, "Memory allocation failed");
+        return;
+    }
+    if (entry->len) {
+        memcpy(response->buffer->data, entry->body, entry->len);
+    }
+    response->len = entry->len;
+    req->status = 200;
+    req->from = from;
+}
+
+// Until when a response can be reused without asking the server
+static int64_t cache_fresh_until(const http_cache_headers_t *headers)
+{
+    if (headers->no_cache || headers->max_age <= headers->age) return 0;
+    return esp_timer_get_time() + (int64_t)(headers->max_age - headers->age) * 1000000;
+}
+
+static bool validator_equal(const char *value, const char *sent)
+{
+    return strcmp(value ? value : "", sent) == 0;
+}
+
+// Answer req from the cache if its entry is still fresh; otherwise copy
+// the entry's validators into req to revalidate it with
+static bool cache_lookup(http_req_t *req)
+{
+    bool served = false;
+
+    xSemaphoreTake(s_cache_lock, portMAX_DELAY);
+    http_cache_entry_t *cached = cache_find(req->url, req->cache);
+    if (cached && esp_timer_get_time() < cached->fresh_until) {
+        s_cache_hits++;
+        cache_serve(req, cached, FROM_CACHE);
+        served = true;
+    } else if (cached) {
+        strcpy(req->if_none_match, cached->etag ? cached->etag : "");
+        strcpy(req->if_modified_since, cached->last_modified ? cached->last_modified : "");
+    }
+    xSemaphoreGive(s_cache_lock);
+    return served;
+}
+
+// Bring the cache in line with the response to req: answer a 304 from the
+// entry that was validated, and store a 200 worth keeping. False if a 304
+// came for an entry another worker has since dropped or replaced.
+static bool cache_store(http_req_t *req)
+{
+    const http_cache_headers_t *headers = &req->headers;
+    http_cache_entry_t *cached = cache_find(req->url, CACHE_MEMORY);
+
+    if (req->status == 304) {
+        if (!cached || !validator_equal(cached->etag, req->if_none_match) ||
+            !validator_equal(cached->last_modified, req->if_modified_since)) {
+            return false;
+        }
+        cached->fresh_until = cache_fresh_until(headers);
+        s_cache_revalidated++;
+        cache_serve(req, cached, FROM_REVALIDATED);
+        return true;
+    }
+    if (req->status != 200) return true;
+    s_cache_misses++;
+
+    const http_response_t *response = &req->response;
+    const char *body = response->buffer ? response->buffer->data : "";
+    int64_t fresh_until = cache_fresh_until(headers);
+    bool validators = headers->etag[0] || headers->last_modified[0];
+
+    // Unchanged from what NVS holds, so no need to write it again
+    bool saved = cached && cached->persisted && cached->len == response->len &&
+                 validator_equal(cached->etag, headers->etag) &&
+                 validator_equal(cached->last_modified, headers->last_modified) &&
+                 memcmp(cached->body, body, response->len) == 0;
+
+    if (cached) {
+        for (int i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+            if (s_cache[i] == cached) cache_remove(i);
+        }
+    }
+
+    // Nothing to revalidate with and no time to reuse it for
+    if (headers->no_store || (!validators && fresh_until == 0) || response->len > HTTP_CACHE_MAX_ENTRY) {
+        return true;
+    }
+
+    http_cache_entry_t *entry = cache_insert(req->url, url_hash(req->url), headers->etag,
+                                             headers->last_modified, body, response->len);
+    if (!entry) return true;
+    entry->fresh_until = fresh_until;
+
+    if (req->cache == CACHE_PERSIST && validators && response->len <= HTTP_CACHE_PERSIST_MAX) {
+        if (saved) {
+            entry->persisted = true;
+        } else {
+            cache_save(entry);
+        }
+    }
+    return true;
+}
+
+static bool cache_update(http_req_t *req)
+{
+    xSemaphoreTake(s_cache_lock, portMAX_DELAY);
+    bool ok = cache_store(req);
+    xSemaphoreGive(s_cache_lock);
+    return ok;
+}
+
+// Send a request over a pooled connection; false if it failed, with the
+// error left in req
+static bool http_fetch(http_req_t *req)
 {
-    http_response_t *response = (http_response_t *)evt->user_data;
+    const char *name = req->method == HTTP_METHOD_POST ? "POST" : "GET";
+    http_pool_entry_t *entry;
+    esp_http_client_handle_t client = pool_acquire(req->url, req->timeout_ms, &entry, &req->reused);
+    if (!client) {
+        req_fail(req, ESP_FAIL, "Failed to init HTTP client");
+        return false;
+    }
 
-    switch (evt->event_id) {
-        case HTTP_EVENT_ON_DATA:
-            if (response && evt->data_len > 0) {
-                int new_len = response->buffer_len + evt->data_len;
-                if (new_len < response->buffer_size) {
-                    memcpy(response->buffer + response->buffer_len, evt->data, evt->data_len);
-                    response->buffer_len = new_len;
-                    response->buffer[new_len] = '\0';
+    esp_err_t err = http_perform(client, req);
+
+    // The server may have closed a pooled connection while it sat idle;
+    // GETs are safe to send again on a fresh one, if none of the body
+    // reached the sink yet
+    if (err != ESP_OK && req->reused && req->method == HTTP_METHOD_GET && req->received == 0) {
+        ESP_LOGW(TAG, "HTTP %s on reused connection failed (%s), retrying",
+                 name, esp_err_to_name(err));
+        pool_release(client, entry, false);
+        s_pool_retries++;
+
+        client = pool_acquire(req->url, req->timeout_ms, &entry, &req->reused);
+        if (!client) {
+            req_fail(req, ESP_FAIL, "Failed to init HTTP client");
+            return false;
+        }
+        err = http_perform(client, req);
+    }
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "HTTP %s failed: %s", name, esp_err_to_name(err));
+        pool_release(client, entry, false);
+        req_fail(req, err, esp_err_to_name(err));
+        return false;
+    }
+
+    if (req->response.err != ESP_OK) {
+        // Cut short, but the rest was read off the connection
+        pool_release(client, entry, true);
+        req_fail(req, req->response.err, req->response.err == ESP_ERR_NO_MEM ?
+                 "Memory allocation failed" : "Response too large");
+        return false;
+    }
+    if (req->error) {
+        // The sink or inflate gave up part way
+        pool_release(client, entry, true);
+        return false;
+    }
+    if (req->inflate && !atomic_load(&req->aborted)) {
+        if (req->inflate->stage != INFLATE_DONE) {
+            // Connection closed before the end of the compressed data
+            pool_release(client, entry, true);
+            inflate_fail(req);
+            return false;
+        }
+        ESP_LOGD(TAG, "HTTP %s inflated %u bytes to %u", name, (unsigned)req->received,
+                 (unsigned)req->inflate->inflated);
+    }
+
+    req->status = esp_http_client_get_status_code(client);
+    ESP_LOGI(TAG, "HTTP %s Status = %d, content_length = %lld%s", name, req->status,
+             esp_http_client_get_content_length(client), req->reused ? " (reused)" : "");
+    pool_release(client, entry, true);
+    return true;
+}
+
+// Run a request on a worker, leaving the outcome in req
+static void http_run(http_req_t *req)
+{
+    if (!req->sink) {
+        req->response.buffer = spare_take();
+        req->sink = response_write;
+        req->sink_ctx = &req->response;
+    } else {
+        // Streamed bodies aren't kept
+        req->cache = CACHE_OFF;
+    }
+    if (req->method != HTTP_METHOD_GET) {
+        req->cache = CACHE_OFF;
+    }
+
+    if (req->cache == CACHE_OFF) {
+        http_fetch(req);
+        return;
+    }
+    if (cache_lookup(req)) {
+        ESP_LOGI(TAG, "HTTP GET %s served from cache", req->url);
+        return;
+    }
+    if (http_fetch(req) && !cache_update(req)) {
+        // Nothing left to answer the 304 with: ask for the whole body
+        req->if_none_match[0] = '\0';
+        req->if_modified_since[0] = '\0';
+        if (http_fetch(req)) {
+            cache_update(req);
+        }
+    }
+}
+
+// Add a finished request to the completion list and wake a waiting Lua task.
+// Lock-free, so any number of workers can complete at once.
+static void complete_push(http_req_t *req)
+{
+    http_req_t *head = atomic_load_explicit(&s_completed, memory_order_relaxed);
+    do {
+        req->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&s_completed, &head, req,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+    xSemaphoreGive(s_completed_sem);
+}
+
+static void http_worker(void *arg)
+{
+    (void)arg;
+    http_req_t *req;
+
+    for (;;) {
+        // Wake up now and then to close connections that went idle
+        BaseType_t got = xQueueReceive(s_queue, &req, pdMS_TO_TICKS(HTTP_POOL_IDLE_US / 1000));
+
+        xSemaphoreTake(s_pool_lock, portMAX_DELAY);
+        if (atomic_exchange(&s_close_idle, false)) {
+            for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+                if (s_pool[i].client && !s_pool[i].in_use) {
+                    pool_drop(&s_pool[i]);
                 }
             }
-            break;
-        default:
-            break;
+        }
+        pool_expire(esp_timer_get_time());
+        xSemaphoreGive(s_pool_lock);
+
+        int clear = atomic_exchange(&s_cache_clear, CACHE_OFF);
+        if (clear != CACHE_OFF) {
+            xSemaphoreTake(s_cache_lock, portMAX_DELAY);
+            cache_clear(clear == CACHE_PERSIST);
+            xSemaphoreGive(s_cache_lock);
+        }
+
+        // NULL only wakes a worker
+        if (got != pdTRUE || !req) continue;
+
+        int queued = REQ_QUEUED;
+        if (atomic_compare_exchange_strong(&req->state, &queued, REQ_RUNNING)) {
+            http_run(req);
+            free(req->inflate);
+            req->inflate = NULL;
+        } else {
+            req_fail(req, ESP_ERR_INVALID_STATE, "Cancelled");
+        }
+        complete_push(req);
     }
-    return ESP_OK;
 }
 
-static int lua_http_get(lua_State *L)
+// Create the queue and workers on first use
+static bool http_start(void)
 {
-    const char *url = luaL_checkstring(L, 1);
-    int timeout_ms = 5000;  // 5 second default timeout
+    if (s_queue) return true;
 
-    if (lua_gettop(L) >= 2 && lua_isnumber(L, 2)) {
-        timeout_ms = lua_tointeger(L, 2);
+    s_completed_sem = xSemaphoreCreateBinary();
+    s_pool_lock = xSemaphoreCreateMutex();
+    s_cache_lock = xSemaphoreCreateMutex();
+    s_queue = xQueueCreate(HTTP_QUEUE_LEN, sizeof(http_req_t *));
+
+    int workers = 0;
+    if (s_completed_sem && s_pool_lock && s_cache_lock && s_queue) {
+        for (; workers < HTTP_WORKERS; workers++) {
+            char name[24];
+            snprintf(name, sizeof(name), "http_worker%d", workers);
+            if (xTaskCreate(http_worker, name, HTTP_WORKER_STACK, NULL,
+                            HTTP_WORKER_PRIORITY, NULL) != pdPASS) {
+                break;
+            }
+        }
+    }
+    if (workers > 0) {
+        if (workers < HTTP_WORKERS) {
+            ESP_LOGW(TAG, "Started %d of %d HTTP workers", workers, HTTP_WORKERS);
+        }
+        return true;
     }
 
-    http_response_t response = {
-        .buffer = malloc(HTTP_MAX_RESPONSE_SIZE),
-        .buffer_len = 0,
-        .buffer_size = HTTP_MAX_RESPONSE_SIZE
-    };
+    if (s_queue) vQueueDelete(s_queue);
+    if (s_cache_lock) vSemaphoreDelete(s_cache_lock);
+    if (s_pool_lock) vSemaphoreDelete(s_pool_lock);
+    if (s_completed_sem) vSemaphoreDelete(s_completed_sem);
+    s_queue = NULL;
+    s_cache_lock = NULL;
+    s_pool_lock = NULL;
+    s_completed_sem = NULL;
+    return false;
+}
 
-    if (!response.buffer) {
-        lua_pushnil(L);
-        lua_pushstring(L, "Memory allocation failed");
-        return 2;
+static void req_free(http_req_t *req)
+{
+    if (req->stream) {
+        vStreamBufferDelete(req->stream);
+    }
+    response_release(&req->response);
+    free(req);
+}
+
+// Mark everything completed so far as done (Lua task only)
+static void complete_drain(void)
+{
+    http_req_t *req = atomic_exchange_explicit(&s_completed, NULL, memory_order_acquire);
+    while (req) {
+        http_req_t *next = req->next;
+        req->done = true;
+        if (req->orphaned) {
+            req_free(req);
+        }
+        req = next;
     }
+}
 
-    response.buffer[0] = '\0';
+// Pass what a streaming request has received so far to the on_chunk of
+// its handle at index, waiting up to ticks for the first chunk (Lua task).
+// on_chunk returning false drops the rest of the body.
+static void stream_pump(lua_State *L, int index, http_req_t *req, TickType_t ticks)
+{
+    char chunk[HTTP_STREAM_CHUNK];
+    size_t len;
 
-    esp_http_client_config_t config = {
-        .url = url,
-        .event_handler = http_event_handler,
-        .user_data = &response,
-        .timeout_ms = timeout_ms,
-        .crt_bundle_attach = esp_crt_bundle_attach,
-    };
+    while ((len = xStreamBufferReceive(req->stream, chunk, sizeof(chunk), ticks)) > 0) {
+        ticks = 0;
+        if (atomic_load(&req->aborted)) continue;
 
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client) {
-        free(response.buffer);
-        lua_pushnil(L);
-        lua_pushstring(L, "Failed to init HTTP client");
-        return 2;
+        lua_getiuservalue(L, index, 1);
+        lua_pushlstring(L, chunk, len);
+        lua_call(L, 1, 1);
+        if (lua_isboolean(L, -1) && !lua_toboolean(L, -1)) {
+            atomic_store(&req->aborted, true);
+        }
+        lua_pop(L, 1);
     }
+}
 
-    esp_http_client_set_header(client, "User-Agent", "MoonshotDashboard/1.0 ESP32");
+// Collect completions, and chunks for a streaming request, waiting up to
+// ticks for progress; true once req has finished (Lua task only)
+static bool req_poll(lua_State *L, int index, http_req_t *req, TickType_t ticks)
+{
+    complete_drain();
 
-    esp_err_t err = esp_http_client_perform(client);
+    if (!req->stream) {
+        if (!req->done && ticks > 0 && xSemaphoreTake(s_completed_sem, ticks) == pdTRUE) {
+            complete_drain();
+        }
+        return req->done;
+    }
 
-    if (err == ESP_OK) {
-        int status = esp_http_client_get_status_code(client);
-        ESP_LOGI(TAG, "HTTP GET Status = %d, content_length = %lld",
-                 status, esp_http_client_get_content_length(client));
+    // The worker writes the whole body before completing, so a request
+    // that was done before the pump has nothing left once it is empty
+    bool done = req->done;
+    stream_pump(L, index, req, done ? 0 : ticks);
+    return done && xStreamBufferIsEmpty(req->stream);
+}
 
-        if (status >= 200 && status < 300) {
-            lua_pushstring(L, response.buffer);
-        } else {
-            lua_pushnil(L);
-            char err_msg[64];
-            snprintf(err_msg, sizeof(err_msg), "HTTP error: %d", status);
-            lua_pushstring(L, err_msg);
-            esp_http_client_cleanup(client);
-            free(response.buffer);
-            return 2;
+// Wait up to ticks for req to finish; true if it has
+static bool req_wait(lua_State *L, int index, http_req_t *req, TickType_t ticks)
+{
+    TickType_t start = xTaskGetTickCount();
+
+    for (;;) {
+        TickType_t waited = xTaskGetTickCount() - start;
+        TickType_t left = ticks == portMAX_DELAY ? portMAX_DELAY :
+                          waited < ticks ? ticks - waited : 0;
+        // Streams also check for completion between chunks
+        if (req->stream && left > pdMS_TO_TICKS(HTTP_STREAM_POLL_MS)) {
+            left = pdMS_TO_TICKS(HTTP_STREAM_POLL_MS);
         }
-    } else {
-        ESP_LOGE(TAG, "HTTP GET failed: %s", esp_err_to_name(err));
+        if (req_poll(L, index, req, left)) return true;
+        if (ticks != portMAX_DELAY && xTaskGetTickCount() - start >= ticks) return false;
+    }
+}
+
+static http_req_t *req_new(esp_http_client_method_t method, const char *url,
+                           const char *body, const char *content_type, int timeout_ms)
+{
+    size_t url_len = strlen(url) + 1;
+    size_t body_len = body ? strlen(body) + 1 : 0;
+    size_t type_len = content_type ? strlen(content_type) + 1 : 0;
+
+    http_req_t *req = calloc(1, sizeof(http_req_t) + url_len + body_len + type_len);
+    if (!req) return NULL;
+
+    char *strings = (char *)(req + 1);
+    req->url = memcpy(strings, url, url_len);
+    if (body) req->body = memcpy(strings + url_len, body, body_len);
+    if (content_type) req->content_type = memcpy(strings + url_len + body_len, content_type, type_len);
+    req->method = method;
+    req->timeout_ms = timeout_ms;
+    req->cache = CACHE_MEMORY;
+    atomic_init(&req->state, REQ_QUEUED);
+    atomic_init(&req->aborted, false);
+    return req;
+}
+
+// Push a new request handle owning a copy of the arguments. With the
+// function at on_chunk (0 for none) the body streams to it. The handle's
+// user values are on_chunk and the body string once it has been read.
+static http_req_t *req_push(lua_State *L, esp_http_client_method_t method, const char *url,
+                            const char *body, const char *content_type, int timeout_ms,
+                            int on_chunk)
+{
+    http_req_t **ud = (http_req_t **)lua_newuserdatauv(L, sizeof(http_req_t *), 2);
+    *ud = NULL;
+    luaL_setmetatable(L, REQUEST_MT);
+
+    http_req_t *req = req_new(method, url, body, content_type, timeout_ms);
+    if (!req) {
+        luaL_error(L, "out of memory");
+    }
+    *ud = req;
+
+    if (on_chunk) {
+        req->stream = xStreamBufferCreate(HTTP_STREAM_BUFFER, 1);
+        if (!req->stream) {
+            luaL_error(L, "out of memory");
+        }
+        req->sink = stream_write;
+        req->sink_ctx = req;
+        lua_pushvalue(L, on_chunk);
+        lua_setiuservalue(L, -2, 1);
+    }
+    return req;
+}
+
+// Hand a request to the worker, or complete it at once with an error
+static void req_submit(http_req_t *req)
+{
+    if (!http_start()) {
+        req_fail(req, ESP_FAIL, "Failed to start HTTP worker");
+        req->done = true;
+        return;
+    }
+    if (xQueueSend(s_queue, &req, 0) != pdTRUE) {
+        req_fail(req, ESP_ERR_NO_MEM, "Request queue full");
+        req->done = true;
+    }
+}
+
+// Push the body (true for a streamed one), or nil and an error message, for
+// the handle at index. The body is copied out once and kept on the handle,
+// and its buffer goes back to the spares.
+static int push_result(lua_State *L, int index, http_req_t *req)
+{
+    if (req->error) {
         lua_pushnil(L);
-        lua_pushstring(L, esp_err_to_name(err));
-        esp_http_client_cleanup(client);
-        free(response.buffer);
+        lua_pushstring(L, req->error);
         return 2;
     }
+    if (req->status >= 200 && req->status < 300) {
+        if (req->stream) {
+            lua_pushboolean(L, true);
+        } else if (lua_getiuservalue(L, index, 2) == LUA_TNIL) {
+            http_response_t *response = &req->response;
+            lua_pop(L, 1);
+            lua_pushlstring(L, response->buffer ? response->buffer->data : "", response->len);
+            lua_pushvalue(L, -1);
+            lua_setiuservalue(L, index, 2);
+            response_release(response);
+        }
+        return 1;
+    }
+    response_release(&req->response);
+    lua_pushnil(L);
+    lua_pushfstring(L, "HTTP error: %d", req->status);
+    return 2;
+}
 
-    esp_http_client_cleanup(client);
-    free(response.buffer);
-    return 1;
+static int http_await_k(lua_State *L, int status, lua_KContext ctx)
+{
+    (void)status;
+    http_req_t *req = *(http_req_t **)luaL_checkudata(L, (int)ctx, REQUEST_MT);
+
+    if (!req_poll(L, (int)ctx, req, 0)) {
+        return lua_yieldk(L, 0, ctx, http_await_k);
+    }
+    return push_result(L, (int)ctx, req);
+}
+
+// Run a request for get/post: yield until it completes when called from a
+// coroutine, else block. Returns the body, or nil and an error message.
+static int http_call(lua_State *L, esp_http_client_method_t method, const char *url,
+                     const char *body, const char *content_type, int timeout_ms,
+                     int on_chunk, int cache)
+{
+    http_req_t *req = req_push(L, method, url, body, content_type, timeout_ms, on_chunk);
+    int index = lua_gettop(L);
+    req->cache = cache;
+
+    req_submit(req);
+    if (!req->done && lua_isyieldable(L)) {
+        return lua_yieldk(L, 0, index, http_await_k);
+    }
+    req_wait(L, index, req, portMAX_DELAY);
+    return push_result(L, index, req);
+}
+
+// Function at opts.on_chunk, pushed, as a stack index; 0 if there is none
+static int opt_on_chunk(lua_State *L, int opts)
+{
+    if (lua_getfield(L, opts, "on_chunk") == LUA_TNIL) {
+        lua_pop(L, 1);
+        return 0;
+    }
+    luaL_checktype(L, -1, LUA_TFUNCTION);
+    return lua_gettop(L);
+}
+
+// Cache mode from opts.cache: true (the default), false or "persist"
+static int opt_cache(lua_State *L, int opts)
+{
+    int mode = CACHE_MEMORY;
+    int type = lua_getfield(L, opts, "cache");
+    if (type == LUA_TBOOLEAN) {
+        mode = lua_toboolean(L, -1) ? CACHE_MEMORY : CACHE_OFF;
+    } else if (type == LUA_TSTRING && strcmp(lua_tostring(L, -1), "persist") == 0) {
+        mode = CACHE_PERSIST;
+    } else if (type != LUA_TNIL) {
+        return luaL_error(L, "cache must be true, false or \"persist\"");
+    }
+    lua_pop(L, 1);
+    return mode;
+}
+
+// body, err = http.get(url, [timeout | {timeout, on_chunk, cache}])
+static int lua_http_get(lua_State *L)
+{
+    const char *url = luaL_checkstring(L, 1);
+    int timeout_ms = 5000;  // 5 second default timeout
+    int on_chunk = 0;
+    int cache = CACHE_MEMORY;
+
+    if (lua_istable(L, 2)) {
+        lua_getfield(L, 2, "timeout");
+        timeout_ms = (int)luaL_optinteger(L, -1, timeout_ms);
+        cache = opt_cache(L, 2);
+        on_chunk = opt_on_chunk(L, 2);
+    } else if (lua_gettop(L) >= 2 && lua_isnumber(L, 2)) {
+        timeout_ms = lua_tointeger(L, 2);
+    }
+
+    return http_call(L, HTTP_METHOD_GET, url, NULL, NULL, timeout_ms, on_chunk, cache);
 }
 
 static int lua_http_post(lua_State *L)
@@ -130,79 +1569,368 @@ static int lua_http_post(lua_State *L)
         timeout_ms = lua_tointeger(L, 4);
     }
 
-    http_response_t response = {
-        .buffer = malloc(HTTP_MAX_RESPONSE_SIZE),
-        .buffer_len = 0,
-        .buffer_size = HTTP_MAX_RESPONSE_SIZE
-    };
+    return http_call(L, HTTP_METHOD_POST, url, post_data, content_type, timeout_ms, 0, CACHE_OFF);
+}
 
-    if (!response.buffer) {
-        lua_pushnil(L);
-        lua_pushstring(L, "Memory allocation failed");
-        return 2;
+// stats = http.pool_stats([reset])
+// Pooled connections and reuse counters; reset clears the counters after reading
+static int lua_http_pool_stats(lua_State *L)
+{
+    bool reset = lua_toboolean(L, 1);
+    int open = s_pool_open;
+    int idle = open - s_pool_busy;
+
+    lua_createtable(L, 0, 7);
+    lua_pushinteger(L, open);             lua_setfield(L, -2, "open");
+    lua_pushinteger(L, idle < 0 ? 0 : idle); lua_setfield(L, -2, "idle");
+    lua_pushinteger(L, HTTP_POOL_SIZE);   lua_setfield(L, -2, "size");
+    lua_pushinteger(L, s_pool_hits);      lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, s_pool_misses);    lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, s_pool_evictions); lua_setfield(L, -2, "evictions");
+    lua_pushinteger(L, s_pool_retries);   lua_setfield(L, -2, "retries");
+
+    if (reset) {
+        s_pool_hits = 0;
+        s_pool_misses = 0;
+        s_pool_evictions = 0;
+        s_pool_retries = 0;
     }
+    return 1;
+}
 
-    response.buffer[0] = '\0';
+// http.close_idle and http.cache_clear: leave the work to the worker
+static void worker_wake(void)
+{
+    http_req_t *wake = NULL;
+    xQueueSend(s_queue, &wake, 0);
+}
 
-    esp_http_client_config_t config = {
-        .url = url,
-        .event_handler = http_event_handler,
-        .user_data = &response,
-        .timeout_ms = timeout_ms,
-        .method = HTTP_METHOD_POST,
-        .crt_bundle_attach = esp_crt_bundle_attach,
-    };
+// http.close_idle()
+// Have the worker close every idle pooled connection, e.g. after WiFi reconnects
+static int lua_http_close_idle(lua_State *L)
+{
+    (void)L;
+    if (s_queue) {
+        atomic_store(&s_close_idle, true);
+        worker_wake();
+    }
+    return 0;
+}
 
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client) {
-        free(response.buffer);
-        lua_pushnil(L);
-        lua_pushstring(L, "Failed to init HTTP client");
-        return 2;
+// stats = http.cache_stats([reset])
+// Response cache use; reset clears the counters after reading
+static int lua_http_cache_stats(lua_State *L)
+{
+    bool reset = lua_toboolean(L, 1);
+
+    lua_createtable(L, 0, 9);
+    lua_pushinteger(L, s_cache_count);       lua_setfield(L, -2, "entries");
+    lua_pushinteger(L, s_cache_bytes);       lua_setfield(L, -2, "bytes");
+    lua_pushinteger(L, s_cache_hits);        lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, s_cache_revalidated); lua_setfield(L, -2, "revalidated");
+    lua_pushinteger(L, s_cache_misses);      lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, s_cache_evictions);   lua_setfield(L, -2, "evictions");
+    lua_pushinteger(L, s_cache_loads);       lua_setfield(L, -2, "loads");
+    lua_pushinteger(L, s_cache_saves);       lua_setfield(L, -2, "saves");
+
+    if (reset) {
+        s_cache_hits = 0;
+        s_cache_revalidated = 0;
+        s_cache_misses = 0;
+        s_cache_evictions = 0;
+        s_cache_loads = 0;
+        s_cache_saves = 0;
+    }
+    return 1;
+}
+
+// http.cache_clear([persisted])
+// Drop every cached response, and with persisted the copies in NVS too
+static int lua_http_cache_clear(lua_State *L)
+{
+    if (!http_start()) {
+        return luaL_error(L, "Failed to start HTTP worker");
+    }
+    if (lua_toboolean(L, 1)) {
+        atomic_store(&s_cache_clear, CACHE_PERSIST);
+    } else {
+        // Without downgrading a pending clear of NVS
+        int none = CACHE_OFF;
+        atomic_compare_exchange_strong(&s_cache_clear, &none, CACHE_MEMORY);
     }
+    worker_wake();
+    return 0;
+}
 
-    esp_http_client_set_header(client, "Content-Type", content_type);
-    esp_http_client_set_post_field(client, post_data, strlen(post_data));
+// http.wait_any([ms])
+// Block until some request completes or ms pass (default 50), for code
+// running several requests outside a coroutine
+static int lua_http_wait_any(lua_State *L)
+{
+    int ms = (int)luaL_optinteger(L, 1, 50);
+    if (s_completed_sem && !atomic_load(&s_completed)) {
+        xSemaphoreTake(s_completed_sem, pdMS_TO_TICKS(ms));
+    }
+    complete_drain();
+    return 0;
+}
 
-    esp_err_t err = esp_http_client_perform(client);
+// handle = http.request_async(url | {url, method, body, content_type, timeout, on_chunk, cache})
+// Queue a request for the worker and return at once
+static int lua_http_request_async(lua_State *L)
+{
+    esp_http_client_method_t method = HTTP_METHOD_GET;
+    const char *url;
+    const char *body = NULL;
+    const char *content_type = NULL;
+    int timeout_ms = 5000;
+    int on_chunk = 0;
+    int cache = CACHE_MEMORY;
 
-    if (err == ESP_OK) {
-        int status = esp_http_client_get_status_code(client);
-        ESP_LOGI(TAG, "HTTP POST Status = %d", status);
+    if (lua_type(L, 1) == LUA_TSTRING) {
+        url = lua_tostring(L, 1);
+    } else {
+        luaL_checktype(L, 1, LUA_TTABLE);
+        lua_getfield(L, 1, "url");
+        url = luaL_checkstring(L, -1);
 
-        if (status >= 200 && status < 300) {
-            lua_pushstring(L, response.buffer);
-        } else {
-            lua_pushnil(L);
-            char err_msg[64];
-            snprintf(err_msg, sizeof(err_msg), "HTTP error: %d", status);
-            lua_pushstring(L, err_msg);
-            esp_http_client_cleanup(client);
-            free(response.buffer);
-            return 2;
+        lua_getfield(L, 1, "method");
+        const char *name = luaL_optstring(L, -1, "GET");
+        if (strcasecmp(name, "POST") == 0) {
+            method = HTTP_METHOD_POST;
+            timeout_ms = 10000;
+        } else if (strcasecmp(name, "GET") != 0) {
+            return luaL_error(L, "unsupported method '%s'", name);
         }
-    } else {
-        ESP_LOGE(TAG, "HTTP POST failed: %s", esp_err_to_name(err));
+
+        lua_getfield(L, 1, "body");
+        body = luaL_optstring(L, -1, method == HTTP_METHOD_POST ? "" : NULL);
+        if (body && method == HTTP_METHOD_GET) {
+            return luaL_error(L, "GET requests have no body");
+        }
+
+        lua_getfield(L, 1, "content_type");
+        content_type = luaL_optstring(L, -1, "application/json");
+
+        lua_getfield(L, 1, "timeout");
+        timeout_ms = (int)luaL_optinteger(L, -1, timeout_ms);
+
+        cache = opt_cache(L, 1);
+        on_chunk = opt_on_chunk(L, 1);
+    }
+
+    // The strings above stay on the stack until req_push copies them
+    http_req_t *req = req_push(L, method, url, body, content_type, timeout_ms, on_chunk);
+    req->cache = cache;
+    req_submit(req);
+    return 1;
+}
+
+static http_req_t *check_request(lua_State *L)
+{
+    return *(http_req_t **)luaL_checkudata(L, 1, REQUEST_MT);
+}
+
+// done = handle:done()
+// Also where a streaming request passes its chunks to on_chunk
+static int request_done(lua_State *L)
+{
+    http_req_t *req = check_request(L);
+    lua_pushboolean(L, req_poll(L, 1, req, 0));
+    return 1;
+}
+
+// done = handle:wait([timeout_ms])
+// Block until the request completes or the timeout (default forever) passes
+static int request_wait(lua_State *L)
+{
+    http_req_t *req = check_request(L);
+    TickType_t ticks = portMAX_DELAY;
+    if (!lua_isnoneornil(L, 2)) {
+        lua_Integer ms = luaL_checkinteger(L, 2);
+        ticks = ms > 0 ? pdMS_TO_TICKS(ms) : 0;
+    }
+    lua_pushboolean(L, req_wait(L, 1, req, ticks));
+    return 1;
+}
+
+// body, err = handle:result()
+// As http.get, or nil and "pending" while the request is in flight
+static int request_result(lua_State *L)
+{
+    http_req_t *req = check_request(L);
+    if (!req_poll(L, 1, req, 0)) {
         lua_pushnil(L);
-        lua_pushstring(L, esp_err_to_name(err));
-        esp_http_client_cleanup(client);
-        free(response.buffer);
+        lua_pushliteral(L, "pending");
         return 2;
     }
+    return push_result(L, 1, req);
+}
+
+// status = handle:status()
+// HTTP status code, nil until a response has arrived
+static int request_status(lua_State *L)
+{
+    http_req_t *req = check_request(L);
+    complete_drain();
+    if (!req->done || req->error) {
+        lua_pushnil(L);
+    } else {
+        lua_pushinteger(L, req->status);
+    }
+    return 1;
+}
+
+// source = handle:cached()
+// "fresh" if served from the cache, "revalidated" after a 304, else nil
+static int request_cached(lua_State *L)
+{
+    http_req_t *req = check_request(L);
+    complete_drain();
+    if (!req->done || req->error || req->from == FROM_NETWORK) {
+        lua_pushnil(L);
+    } else {
+        lua_pushstring(L, req->from == FROM_CACHE ? "fresh" : "revalidated");
+    }
+    return 1;
+}
 
-    esp_http_client_cleanup(client);
-    free(response.buffer);
+// cancelled = handle:cancel()
+// Drop a request the worker hasn't started; false once it has
+static int request_cancel(lua_State *L)
+{
+    http_req_t *req = check_request(L);
+    int queued = REQ_QUEUED;
+    lua_pushboolean(L, !req->done &&
+                       atomic_compare_exchange_strong(&req->state, &queued, REQ_CANCELLED));
     return 1;
 }
 
+static int request_gc(lua_State *L)
+{
+    http_req_t **ud = (http_req_t **)luaL_checkudata(L, 1, REQUEST_MT);
+    http_req_t *req = *ud;
+    if (!req) return 0;
+    *ud = NULL;
+
+    complete_drain();
+    if (req->done) {
+        req_free(req);
+    } else {
+        // The worker still holds it: skip it if not started, stop streaming,
+        // and free it when it comes off the completion list
+        int queued = REQ_QUEUED;
+        atomic_compare_exchange_strong(&req->state, &queued, REQ_CANCELLED);
+        atomic_store(&req->aborted, true);
+        req->orphaned = true;
+    }
+    return 0;
+}
+
+esp_err_t lua_http_stream(const char *url, int timeout_ms, lua_http_sink_t sink, void *ctx,
+                          int *status)
+{
+    http_req_t *req = req_new(HTTP_METHOD_GET, url, NULL, NULL, timeout_ms);
+    if (!req) return ESP_ERR_NO_MEM;
+    req->sink = sink;
+    req->sink_ctx = ctx;
+
+    req_submit(req);
+    req_wait(NULL, 0, req, portMAX_DELAY);
+
+    esp_err_t err = req->err;
+    if (status) *status = req->status;
+    req_free(req);
+    return err;
+}
+
+lua_http_body_t *lua_http_open(const char *url, int timeout_ms)
+{
+    http_req_t *req = req_new(HTTP_METHOD_GET, url, NULL, NULL, timeout_ms);
+    if (!req) return NULL;
+    req->stream = xStreamBufferCreate(HTTP_STREAM_BUFFER, 1);
+    if (!req->stream) {
+        req_free(req);
+        return NULL;
+    }
+    req->sink = stream_write;
+    req->sink_ctx = req;
+    req->max_size = HTTP_MAX_RESPONSE_SIZE;
+
+    req_submit(req);
+    return (lua_http_body_t *)req;
+}
+
+size_t lua_http_read(lua_http_body_t *body, void *buf, size_t len)
+{
+    http_req_t *req = (http_req_t *)body;
+    char skip[64];
+    size_t done = 0;
+
+    // The worker writes the whole body before completing, so the body has
+    // ended once the request is done and the stream is empty
+    while (done < len) {
+        complete_drain();
+        bool finished = req->done;
+        size_t want = len - done;
+        char *dst = (char *)buf + done;
+        if (!buf) {
+            dst = skip;
+            if (want > sizeof(skip)) want = sizeof(skip);
+        }
+        size_t n = xStreamBufferReceive(req->stream, dst, want,
+                                        finished ? 0 : pdMS_TO_TICKS(HTTP_STREAM_POLL_MS));
+        if (n == 0 && finished) break;
+        done += n;
+    }
+    return done;
+}
+
+esp_err_t lua_http_close(lua_http_body_t *body, int *status)
+{
+    http_req_t *req = (http_req_t *)body;
+
+    // The worker reads the rest off the connection without passing it on
+    atomic_store(&req->aborted, true);
+    req_wait(NULL, 0, req, portMAX_DELAY);
+
+    esp_err_t err = req->err;
+    if (status) *status = req->status;
+    req_free(req);
+    return err;
+}
+
+static const luaL_Reg request_methods[] = {
+    {"done", request_done},
+    {"wait", request_wait},
+    {"result", request_result},
+    {"status", request_status},
+    {"cached", request_cached},
+    {"cancel", request_cancel},
+    {NULL, NULL}
+};
+
 static const luaL_Reg http_funcs[] = {
     {"get", lua_http_get},
     {"post", lua_http_post},
+    {"request_async", lua_http_request_async},
+    {"wait_any", lua_http_wait_any},
+    {"pool_stats", lua_http_pool_stats},
+    {"close_idle", lua_http_close_idle},
+    {"cache_stats", lua_http_cache_stats},
+    {"cache_clear", lua_http_cache_clear},
     {NULL, NULL}
 };
 
 int luaopen_http(lua_State *L)
 {
+    luaL_newmetatable(L, REQUEST_MT);
+    luaL_newlib(L, request_methods);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, request_gc);
+    lua_setfield(L, -2, "__gc");
+    lua_pop(L, 1);
+
     luaL_newlib(L, http_funcs);
     return 1;
 }
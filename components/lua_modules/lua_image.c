@@ -0,0 +1,284 @@
+/*
+ * Lua Image Module for ESP32
+ *
+ * QOI and PNG decoding from Lua strings, flash assets or an HTTP body
+ * read through the HTTP workers. Rows are drawn into the current target
+ * (or an image) as they are decoded, so neither a decoded copy nor the
+ * whole download is held.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "image_decode.h"
+#include "assets.h"
+#include "lua_modules.h"
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+static const char *TAG = "lua_image";
+
+// HTTP body read size for image.fetch
+#define IMAGE_FETCH_CHUNK 2048
+
+static const char *decode_error(esp_err_t err)
+{
+    switch (err) {
+        case ESP_ERR_NOT_SUPPORTED: return "Unsupported image";
+        case ESP_ERR_NO_MEM:        return "Memory allocation failed";
+        default:                    return "Corrupt image data";
+    }
+}
+
+// Push w, h after a complete decode, or nil and a message
+static int push_result(lua_State *L, image_decoder_t *dec, esp_err_t err)
+{
+    int w, h;
+    if (err == ESP_OK && !image_decoder_is_done(dec)) {
+        lua_pushnil(L);
+        lua_pushstring(L, "Truncated image data");
+        return 2;
+    }
+    if (err != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushstring(L, decode_error(err));
+        return 2;
+    }
+    image_decoder_get_size(dec, &w, &h);
+    lua_pushinteger(L, w);
+    lua_pushinteger(L, h);
+    return 2;
+}
+
+// Decode a whole buffer to the current drawing target at (x, y)
+static int decode_to_target(lua_State *L, image_decode_format_t format,
+                            const void *data, size_t len, int x, int y)
+{
+    image_decode_target_t target = { .x = x, .y = y };
+    image_decoder_t *dec = image_decoder_create(format, image_decode_draw_row, &target);
+    if (!dec) {
+        lua_pushnil(L);
+        lua_pushstring(L, "Memory allocation failed");
+        return 2;
+    }
+    esp_err_t err = image_decoder_feed(dec, data, len);
+    int n = push_result(L, dec, err);
+    image_decoder_free(dec);
+    return n;
+}
+
+static int decode_string(lua_State *L, image_decode_format_t format)
+{
+    size_t len;
+    const char *data = luaL_checklstring(L, 1, &len);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    return decode_to_target(L, format, data, len, x, y);
+}
+
+// w, h = image.decode_qoi(data, x, y)
+// Draws immediately into the current target; nil, err on failure
+static int lua_image_decode_qoi(lua_State *L)
+{
+    return decode_string(L, IMAGE_DECODE_QOI);
+}
+
+// w, h = image.decode_png(data, x, y)
+static int lua_image_decode_png(lua_State *L)
+{
+    return decode_string(L, IMAGE_DECODE_PNG);
+}
+
+// w, h = image.decode_asset(name, x, y)
+// QOI or PNG asset decoded straight from flash
+static int lua_image_decode_asset(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+
+    assets_map_t map;
+    if (assets_map(name, &map) != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Image not found: %s", name);
+        return 2;
+    }
+    image_decode_format_t format;
+    int n;
+    if (image_decode_sniff(map.data, map.size, &format)) {
+        n = decode_to_target(L, format, map.data, map.size, x, y);
+    } else {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Unknown image format: %s", name);
+        n = 2;
+    }
+    assets_unmap(&map);
+    return n;
+}
+
+// w, h = image.fetch(url, x, y [, timeout_ms])
+// Downloads a QOI or PNG image through the HTTP workers and draws it as
+// the body arrives; only one read buffer is held, and the body is limited
+// like any other response
+static int lua_image_fetch(lua_State *L)
+{
+    const char *url = luaL_checkstring(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    int timeout_ms = luaL_optinteger(L, 4, 10000);
+
+    char *buffer = malloc(IMAGE_FETCH_CHUNK);
+    lua_http_body_t *body = buffer ? lua_http_open(url, timeout_ms) : NULL;
+    if (!body) {
+        free(buffer);
+        lua_pushnil(L);
+        lua_pushstring(L, "Memory allocation failed");
+        return 2;
+    }
+
+    const char *error = NULL;
+    image_decode_target_t target = { .x = x, .y = y };
+    image_decoder_t *dec = NULL;
+
+    // The format is known once the first bytes are in
+    for (;;) {
+        size_t len = lua_http_read(body, buffer, IMAGE_FETCH_CHUNK);
+        if (len == 0) break;
+
+        if (!dec) {
+            image_decode_format_t format;
+            if (!image_decode_sniff(buffer, len, &format)) {
+                error = "Unknown image format";
+                break;
+            }
+            dec = image_decoder_create(format, image_decode_draw_row, &target);
+            if (!dec) {
+                error = "Memory allocation failed";
+                break;
+            }
+        }
+        esp_err_t err = image_decoder_feed(dec, buffer, len);
+        if (err != ESP_OK) {
+            error = decode_error(err);
+            break;
+        }
+        if (image_decoder_is_done(dec)) break;
+    }
+
+    // Failed transfers and error statuses explain a bad body better
+    int status;
+    esp_err_t err = lua_http_close(body, &status);
+    free(buffer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Image fetch failed: %s", esp_err_to_name(err));
+        error = esp_err_to_name(err);
+    } else if (status < 200 || status >= 300) {
+        lua_pushfstring(L, "HTTP error: %d", status);
+        error = lua_tostring(L, -1);
+    }
+
+    int n;
+    if (error) {
+        lua_pushnil(L);
+        lua_pushstring(L, error);
+        n = 2;
+    } else if (!dec) {
+        lua_pushnil(L);
+        lua_pushstring(L, "Empty response");
+        n = 2;
+    } else {
+        n = push_result(L, dec, ESP_OK);
+    }
+    image_decoder_free(dec);
+    return n;
+}
+
+// Decode a whole buffer into a new RGB565 image and push it
+static int load_image(lua_State *L, const void *data, size_t len, uint16_t bg)
+{
+    image_decode_format_t format;
+    if (!image_decode_sniff(data, len, &format)) {
+        lua_pushnil(L);
+        lua_pushstring(L, "Unknown image format");
+        return 2;
+    }
+
+    // Feed the header alone to size the image before any row arrives
+    image_decode_image_t target = { .image = NULL, .bg = bg };
+    image_decoder_t *dec = image_decoder_create(format, image_decode_image_row, &target);
+    if (!dec) {
+        lua_pushnil(L);
+        lua_pushstring(L, "Memory allocation failed");
+        return 2;
+    }
+    size_t header = image_decode_header_size(format);
+    if (header > len) header = len;
+
+    int w, h;
+    esp_err_t err = image_decoder_feed(dec, data, header);
+    if (err == ESP_OK && image_decoder_get_size(dec, &w, &h)) {
+        target.image = rgb_image_create(RGB_IMAGE_RGB565, w, h, NULL, NULL, 0);
+        if (!target.image) {
+            err = ESP_ERR_NO_MEM;
+        } else {
+            err = image_decoder_feed(dec, (const uint8_t *)data + header, len - header);
+        }
+    }
+
+    int n = push_result(L, dec, err);
+    image_decoder_free(dec);
+    if (lua_isnil(L, -n)) {
+        rgb_image_free(target.image);
+        return n;
+    }
+    lua_pop(L, n);
+    lua_display_push_image(L, target.image);
+    return 1;
+}
+
+// img = image.load(data [, bg])
+// Decodes a QOI or PNG string once into a display image (RGB565 in
+// PSRAM) for display.image; alpha is blended over bg (default black).
+// Use this for images drawn inside display frames.
+static int lua_image_load(lua_State *L)
+{
+    size_t len;
+    const char *data = luaL_checklstring(L, 1, &len);
+    uint16_t bg = (uint16_t)luaL_optinteger(L, 2, 0);
+    return load_image(L, data, len, bg);
+}
+
+// img = image.load_asset(name [, bg])
+static int lua_image_load_asset(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    uint16_t bg = (uint16_t)luaL_optinteger(L, 2, 0);
+
+    assets_map_t map;
+    if (assets_map(name, &map) != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Image not found: %s", name);
+        return 2;
+    }
+    int n = load_image(L, map.data, map.size, bg);
+    assets_unmap(&map);
+    return n;
+}
+
+static const luaL_Reg image_funcs[] = {
+    {"decode_qoi", lua_image_decode_qoi},
+    {"decode_png", lua_image_decode_png},
+    {"decode_asset", lua_image_decode_asset},
+    {"fetch", lua_image_fetch},
+    {"load", lua_image_load},
+    {"load_asset", lua_image_load_asset},
+    {NULL, NULL}
+};
+
+int luaopen_image(lua_State *L)
+{
+    luaL_newlib(L, image_funcs);
+    return 1;
+}
@@ -0,0 +1,276 @@
+/*
+ * Lua JPEG Module for ESP32
+ *
+ * Baseline JPEG decoding through the ROM TJpgDec, from Lua strings,
+ * flash assets or an HTTP body (read through the HTTP workers), into the
+ * screen, a canvas or an image.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "jpeg_decode.h"
+#include "assets.h"
+#include "lua_modules.h"
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+static const char *TAG = "lua_jpeg";
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+    size_t pos;
+} buffer_reader_t;
+
+static size_t read_buffer(void *ctx, uint8_t *buf, size_t len)
+{
+    buffer_reader_t *r = ctx;
+    if (len > r->len - r->pos) len = r->len - r->pos;
+    if (buf) memcpy(buf, r->data + r->pos, len);
+    r->pos += len;
+    return len;
+}
+
+// Reads the HTTP body into the decoder's input buffer as it arrives
+static size_t read_http(void *ctx, uint8_t *buf, size_t len)
+{
+    return lua_http_read(ctx, buf, len);
+}
+
+static const char *decode_error(esp_err_t err)
+{
+    switch (err) {
+        case ESP_ERR_NOT_SUPPORTED: return "Unsupported JPEG (progressive?)";
+        case ESP_ERR_NO_MEM:        return "Memory allocation failed";
+        default:                    return "Corrupt JPEG data";
+    }
+}
+
+// scale argument: 1, 2, 4 or 8 (divisor)
+static jpeg_scale_t check_scale(lua_State *L, int idx)
+{
+    switch (luaL_optinteger(L, idx, 1)) {
+        case 1: return JPEG_SCALE_1;
+        case 2: return JPEG_SCALE_1_2;
+        case 4: return JPEG_SCALE_1_4;
+        case 8: return JPEG_SCALE_1_8;
+        default:
+            luaL_argerror(L, idx, "scale must be 1, 2, 4 or 8");
+            return JPEG_SCALE_1;
+    }
+}
+
+// Optional canvas argument; NULL for the current target
+static rgb_surface_t *opt_canvas(lua_State *L, int idx)
+{
+    return lua_isnoneornil(L, idx) ? NULL : lua_display_check_canvas(L, idx);
+}
+
+// Decode into the canvas (if given) or the current target, pushing w, h
+// or nil, err
+static int decode_to_target(lua_State *L, jpeg_decode_read_t read, void *ctx,
+                            int x, int y, jpeg_scale_t scale, rgb_surface_t *canvas)
+{
+    jpeg_decoder_t *dec;
+    esp_err_t err = jpeg_decoder_open(&dec, read, ctx);
+    if (err != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushstring(L, decode_error(err));
+        return 2;
+    }
+
+    int w, h;
+    jpeg_decoder_get_size(dec, scale, &w, &h);
+    if (canvas) {
+        rgb_display_clip_t clip = *rgb_display_get_clip();
+        rgb_display_set_target(canvas);
+        err = jpeg_decoder_draw(dec, scale, x, y);
+        rgb_display_set_target(NULL);
+        rgb_display_set_clip(clip.x0, clip.y0, clip.x1 - clip.x0, clip.y1 - clip.y0);
+    } else {
+        err = jpeg_decoder_draw(dec, scale, x, y);
+    }
+    jpeg_decoder_free(dec);
+
+    if (err != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushstring(L, decode_error(err));
+        return 2;
+    }
+    lua_pushinteger(L, w);
+    lua_pushinteger(L, h);
+    return 2;
+}
+
+// w, h = jpeg.decode(data, x, y [, scale [, canvas]])
+// Draws immediately into the screen (or canvas), scaled down by 1, 2, 4
+// or 8; returns the drawn size, or nil, err
+static int lua_jpeg_decode(lua_State *L)
+{
+    size_t len;
+    const char *data = luaL_checklstring(L, 1, &len);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    jpeg_scale_t scale = check_scale(L, 4);
+    rgb_surface_t *canvas = opt_canvas(L, 5);
+
+    buffer_reader_t reader = { .data = (const uint8_t *)data, .len = len };
+    return decode_to_target(L, read_buffer, &reader, x, y, scale, canvas);
+}
+
+// w, h = jpeg.decode_asset(name, x, y [, scale [, canvas]])
+static int lua_jpeg_decode_asset(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    jpeg_scale_t scale = check_scale(L, 4);
+    rgb_surface_t *canvas = opt_canvas(L, 5);
+
+    assets_map_t map;
+    if (assets_map(name, &map) != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Image not found: %s", name);
+        return 2;
+    }
+    buffer_reader_t reader = { .data = map.data, .len = map.size };
+    int n = decode_to_target(L, read_buffer, &reader, x, y, scale, canvas);
+    assets_unmap(&map);
+    return n;
+}
+
+// w, h = jpeg.fetch(url, x, y [, scale [, canvas [, timeout_ms]]])
+// Decodes the HTTP body as it arrives from the HTTP workers; nothing but
+// the decoder's pool is buffered, and the body is limited like any other
+// response
+static int lua_jpeg_fetch(lua_State *L)
+{
+    const char *url = luaL_checkstring(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    jpeg_scale_t scale = check_scale(L, 4);
+    rgb_surface_t *canvas = opt_canvas(L, 5);
+    int timeout_ms = luaL_optinteger(L, 6, 10000);
+
+    lua_http_body_t *body = lua_http_open(url, timeout_ms);
+    if (!body) {
+        lua_pushnil(L);
+        lua_pushstring(L, "Memory allocation failed");
+        return 2;
+    }
+    int n = decode_to_target(L, read_http, body, x, y, scale, canvas);
+
+    // Failed transfers and error statuses explain a bad body better
+    int status;
+    esp_err_t err = lua_http_close(body, &status);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "JPEG fetch failed: %s", esp_err_to_name(err));
+        lua_pop(L, n);
+        lua_pushnil(L);
+        lua_pushstring(L, esp_err_to_name(err));
+        n = 2;
+    } else if (status < 200 || status >= 300) {
+        lua_pop(L, n);
+        lua_pushnil(L);
+        lua_pushfstring(L, "HTTP error: %d", status);
+        n = 2;
+    }
+    return n;
+}
+
+// w, h = jpeg.info(data)
+// Full-scale size from the headers, or nil, err
+static int lua_jpeg_info(lua_State *L)
+{
+    size_t len;
+    const char *data = luaL_checklstring(L, 1, &len);
+    buffer_reader_t reader = { .data = (const uint8_t *)data, .len = len };
+
+    jpeg_decoder_t *dec;
+    esp_err_t err = jpeg_decoder_open(&dec, read_buffer, &reader);
+    if (err != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushstring(L, decode_error(err));
+        return 2;
+    }
+    int w, h;
+    jpeg_decoder_get_size(dec, JPEG_SCALE_1, &w, &h);
+    jpeg_decoder_free(dec);
+    lua_pushinteger(L, w);
+    lua_pushinteger(L, h);
+    return 2;
+}
+
+// Decode into a new RGB565 image and push it
+static int load_image(lua_State *L, const void *data, size_t len, jpeg_scale_t scale)
+{
+    buffer_reader_t reader = { .data = data, .len = len };
+    jpeg_decoder_t *dec;
+    esp_err_t err = jpeg_decoder_open(&dec, read_buffer, &reader);
+    if (err != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushstring(L, decode_error(err));
+        return 2;
+    }
+
+    int w, h;
+    jpeg_decoder_get_size(dec, scale, &w, &h);
+    rgb_image_t *image = rgb_image_create(RGB_IMAGE_RGB565, w, h, NULL, NULL, 0);
+    err = image ? jpeg_decoder_to_image(dec, scale, image) : ESP_ERR_NO_MEM;
+    jpeg_decoder_free(dec);
+
+    if (err != ESP_OK) {
+        rgb_image_free(image);
+        lua_pushnil(L);
+        lua_pushstring(L, decode_error(err));
+        return 2;
+    }
+    lua_display_push_image(L, image);
+    return 1;
+}
+
+// img = jpeg.load(data [, scale])
+// Decodes once into a display image (RGB565 in PSRAM) for display.image;
+// use this for photos drawn inside display frames
+static int lua_jpeg_load(lua_State *L)
+{
+    size_t len;
+    const char *data = luaL_checklstring(L, 1, &len);
+    return load_image(L, data, len, check_scale(L, 2));
+}
+
+// img = jpeg.load_asset(name [, scale])
+static int lua_jpeg_load_asset(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    jpeg_scale_t scale = check_scale(L, 2);
+
+    assets_map_t map;
+    if (assets_map(name, &map) != ESP_OK) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Image not found: %s", name);
+        return 2;
+    }
+    int n = load_image(L, map.data, map.size, scale);
+    assets_unmap(&map);
+    return n;
+}
+
+static const luaL_Reg jpeg_funcs[] = {
+    {"decode", lua_jpeg_decode},
+    {"decode_asset", lua_jpeg_decode_asset},
+    {"fetch", lua_jpeg_fetch},
+    {"info", lua_jpeg_info},
+    {"load", lua_jpeg_load},
+    {"load_asset", lua_jpeg_load_asset},
+    {NULL, NULL}
+};
+
+int luaopen_jpeg(lua_State *L)
+{
+    luaL_newlib(L, jpeg_funcs);
+    return 1;
+}
@@ -30,7 +30,23 @@ void lua_modules_init(lua_State *L)
     luaL_requiref(L, "http", luaopen_http, 1);
     lua_pop(L, 1);
     
+    // Register DNS module
+    luaL_requiref(L, "dns", luaopen_dns, 1);
+    lua_pop(L, 1);
+    
     // Register touch module
     luaL_requiref(L, "touch", luaopen_touch, 1);
     lua_pop(L, 1);
+    
+    // Register image module
+    luaL_requiref(L, "image", luaopen_image, 1);
+    lua_pop(L, 1);
+    
+    // Register JPEG module
+    luaL_requiref(L, "jpeg", luaopen_jpeg, 1);
+    lua_pop(L, 1);
+    
+    // Register scene module
+    luaL_requiref(L, "scene", luaopen_scene, 1);
+    lua_pop(L, 1);
 }
@@ -0,0 +1,502 @@
+/*
+ * Lua Scene Module for ESP32
+ *
+ * Retained UI nodes (rgb_scene) behind lightweight handles. Lua creates
+ * group, rect, text and image nodes, sets their properties and adds them
+ * to groups; root:render() then lays out and redraws only what changed, so
+ * an unchanged UI costs no Lua work and no garbage per frame. Inside a
+ * display frame a root renders into a canvas that the frame blits.
+ */
+
+#include <string.h>
+#include "rgb_scene.h"
+#include "lua_modules.h"
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+#define NODE_MT "scene.node"
+
+typedef struct {
+    rgb_scene_node_t *node;
+} node_ud_t;
+
+// Handles by node (weak values), to return handles from hit tests and
+// children(); and the handles of attached nodes, which the tree keeps alive
+static const char s_handles_key = 0;
+static const char s_attached_key = 0;
+
+static const char *const s_layout_names[] = {"stack", "row", "column", NULL};
+static const char *const s_align_names[] = {"start", "center", "end", "stretch", "left", "right", NULL};
+static const char *const s_justify_names[] = {"start", "center", "end", "between", "around", NULL};
+static const char *const s_type_names[] = {"group", "rect", "text", "image"};
+
+static rgb_scene_node_t *check_node(lua_State *L, int idx)
+{
+    node_ud_t *ud = (node_ud_t *)luaL_checkudata(L, idx, NODE_MT);
+    return ud->node;
+}
+
+// Push the handle of a node (nil for NULL)
+static void push_handle(lua_State *L, rgb_scene_node_t *node)
+{
+    if (!node) {
+        lua_pushnil(L);
+        return;
+    }
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &s_handles_key);
+    lua_rawgetp(L, -1, node);
+    lua_remove(L, -2);
+}
+
+// Keep (or stop keeping) the handle at idx alive through the tree
+static void set_attached(lua_State *L, int idx, rgb_scene_node_t *node, bool attached)
+{
+    idx = lua_absindex(L, idx);
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &s_attached_key);
+    if (attached) {
+        lua_pushvalue(L, idx);
+    } else {
+        lua_pushnil(L);
+    }
+    lua_rawsetp(L, -2, node);
+    lua_pop(L, 1);
+}
+
+static void set_detached_by_node(lua_State *L, rgb_scene_node_t *node)
+{
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &s_attached_key);
+    lua_pushnil(L);
+    lua_rawsetp(L, -2, node);
+    lua_pop(L, 1);
+}
+
+// Width or height: a number, or nil/false/"auto" for the content size
+static int16_t check_size(lua_State *L, int idx)
+{
+    if (lua_isnoneornil(L, idx) || (lua_isboolean(L, idx) && !lua_toboolean(L, idx))) {
+        return RGB_SCENE_AUTO;
+    }
+    if (lua_type(L, idx) == LUA_TSTRING && strcmp(lua_tostring(L, idx), "auto") == 0) {
+        return RGB_SCENE_AUTO;
+    }
+    int v = luaL_checkinteger(L, idx);
+    return v < 0 ? RGB_SCENE_AUTO : (v > INT16_MAX ? INT16_MAX : v);
+}
+
+// Optional color: a number, or nil/false for none
+static bool opt_color(lua_State *L, int idx, uint16_t *color)
+{
+    if (lua_isnoneornil(L, idx) || (lua_isboolean(L, idx) && !lua_toboolean(L, idx))) {
+        return false;
+    }
+    *color = (uint16_t)luaL_checkinteger(L, idx);
+    return true;
+}
+
+// Set property key to the value at idx on the node handle at 1
+static void set_prop(lua_State *L, rgb_scene_node_t *node, const char *key, int idx)
+{
+    rgb_scene_props_t p = *rgb_scene_get_props(node);
+    rgb_scene_type_t type = rgb_scene_node_type(node);
+
+    if (strcmp(key, "x") == 0) {
+        p.x = luaL_checkinteger(L, idx);
+    } else if (strcmp(key, "y") == 0) {
+        p.y = luaL_checkinteger(L, idx);
+    } else if (strcmp(key, "w") == 0) {
+        p.width = check_size(L, idx);
+    } else if (strcmp(key, "h") == 0) {
+        p.height = check_size(L, idx);
+    } else if (strcmp(key, "visible") == 0) {
+        p.visible = lua_toboolean(L, idx);
+    } else if (strcmp(key, "color") == 0) {
+        p.color = (uint16_t)luaL_checkinteger(L, idx);
+    } else if (strcmp(key, "filled") == 0) {
+        p.filled = lua_toboolean(L, idx);
+    } else if (strcmp(key, "layout") == 0) {
+        p.layout = luaL_checkoption(L, idx, NULL, s_layout_names);
+    } else if (strcmp(key, "gap") == 0) {
+        p.gap = luaL_checkinteger(L, idx);
+    } else if (strcmp(key, "padding") == 0) {
+        p.padding = luaL_checkinteger(L, idx);
+    } else if (strcmp(key, "align") == 0) {
+        int align = luaL_checkoption(L, idx, NULL, s_align_names);
+        // left and right are the text spellings of start and end
+        p.align = align == 4 ? RGB_SCENE_ALIGN_START : align == 5 ? RGB_SCENE_ALIGN_END : align;
+    } else if (strcmp(key, "justify") == 0) {
+        p.justify = luaL_checkoption(L, idx, NULL, s_justify_names);
+    } else if (strcmp(key, "bg") == 0) {
+        p.has_bg = opt_color(L, idx, &p.bg);
+    } else if (strcmp(key, "border") == 0) {
+        p.has_border = opt_color(L, idx, &p.border);
+    } else if (strcmp(key, "font") == 0) {
+        p.font = (font_id_t)luaL_checkinteger(L, idx);
+    } else if (strcmp(key, "text") == 0 && type == RGB_SCENE_TEXT) {
+        if (!rgb_scene_set_text(node, luaL_checkstring(L, idx))) {
+            luaL_error(L, "Out of memory");
+        }
+        return;
+    } else if (strcmp(key, "image") == 0 && type == RGB_SCENE_IMAGE) {
+        // The handle's uservalue keeps the image alive
+        rgb_image_t *image = lua_isnil(L, idx) ? NULL : lua_display_check_image(L, idx);
+        lua_pushvalue(L, idx);
+        lua_setiuservalue(L, 1, 1);
+        rgb_scene_set_image(node, image);
+        return;
+    } else {
+        luaL_error(L, "%s nodes have no property '%s'", s_type_names[type], key);
+        return;
+    }
+    rgb_scene_set_props(node, &p);
+}
+
+// Set each key of the table at idx
+static void set_props(lua_State *L, rgb_scene_node_t *node, int idx)
+{
+    idx = lua_absindex(L, idx);
+    lua_pushnil(L);
+    while (lua_next(L, idx)) {
+        if (lua_type(L, -2) == LUA_TSTRING) {
+            set_prop(L, node, lua_tostring(L, -2), lua_gettop(L));
+        }
+        lua_pop(L, 1);
+    }
+}
+
+static void push_option(lua_State *L, const char *const names[], int value)
+{
+    lua_pushstring(L, names[value]);
+}
+
+static void push_opt_color(lua_State *L, bool has, uint16_t color)
+{
+    if (has) {
+        lua_pushinteger(L, color);
+    } else {
+        lua_pushnil(L);
+    }
+}
+
+// Push property key; false if there is none by that name
+static bool get_prop(lua_State *L, rgb_scene_node_t *node, const char *key)
+{
+    const rgb_scene_props_t *p = rgb_scene_get_props(node);
+    rgb_scene_type_t type = rgb_scene_node_type(node);
+
+    if (strcmp(key, "x") == 0) {
+        lua_pushinteger(L, p->x);
+    } else if (strcmp(key, "y") == 0) {
+        lua_pushinteger(L, p->y);
+    } else if (strcmp(key, "w") == 0) {
+        if (p->width == RGB_SCENE_AUTO) lua_pushnil(L); else lua_pushinteger(L, p->width);
+    } else if (strcmp(key, "h") == 0) {
+        if (p->height == RGB_SCENE_AUTO) lua_pushnil(L); else lua_pushinteger(L, p->height);
+    } else if (strcmp(key, "visible") == 0) {
+        lua_pushboolean(L, p->visible);
+    } else if (strcmp(key, "color") == 0) {
+        lua_pushinteger(L, p->color);
+    } else if (strcmp(key, "filled") == 0) {
+        lua_pushboolean(L, p->filled);
+    } else if (strcmp(key, "layout") == 0) {
+        push_option(L, s_layout_names, p->layout);
+    } else if (strcmp(key, "gap") == 0) {
+        lua_pushinteger(L, p->gap);
+    } else if (strcmp(key, "padding") == 0) {
+        lua_pushinteger(L, p->padding);
+    } else if (strcmp(key, "align") == 0) {
+        push_option(L, s_align_names, p->align);
+    } else if (strcmp(key, "justify") == 0) {
+        push_option(L, s_justify_names, p->justify);
+    } else if (strcmp(key, "bg") == 0) {
+        push_opt_color(L, p->has_bg, p->bg);
+    } else if (strcmp(key, "border") == 0) {
+        push_opt_color(L, p->has_border, p->border);
+    } else if (strcmp(key, "font") == 0) {
+        lua_pushinteger(L, p->font);
+    } else if (strcmp(key, "text") == 0 && type == RGB_SCENE_TEXT) {
+        lua_pushstring(L, rgb_scene_get_text(node));
+    } else if (strcmp(key, "image") == 0 && type == RGB_SCENE_IMAGE) {
+        lua_getiuservalue(L, 1, 1);
+    } else if (strcmp(key, "type") == 0) {
+        lua_pushstring(L, s_type_names[type]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Create a node of a type, with properties from the table at 1 (if any),
+// or with its shorthand property (text or image) given directly at 1
+static int new_node(lua_State *L, rgb_scene_type_t type, const char *shorthand)
+{
+    lua_settop(L, 1);
+
+    node_ud_t *ud = (node_ud_t *)lua_newuserdatauv(L, sizeof(node_ud_t), 1);
+    ud->node = rgb_scene_node_create(type);
+    if (!ud->node) {
+        return luaL_error(L, "Out of memory");
+    }
+    luaL_setmetatable(L, NODE_MT);
+
+    lua_rawgetp(L, LUA_REGISTRYINDEX, &s_handles_key);
+    lua_pushvalue(L, -2);
+    lua_rawsetp(L, -2, ud->node);
+    lua_pop(L, 1);
+
+    // Properties are set with the handle at 1, as in node:set()
+    lua_insert(L, 1);
+    if (lua_istable(L, 2)) {
+        set_props(L, ud->node, 2);
+    } else if (shorthand && !lua_isnil(L, 2)) {
+        set_prop(L, ud->node, shorthand, 2);
+    } else if (!lua_isnil(L, 2)) {
+        return luaL_argerror(L, 1, "table expected");
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+// node = scene.group({layout = "column", gap = 8, padding = 10, bg = color, ...})
+static int lua_scene_group(lua_State *L)
+{
+    return new_node(L, RGB_SCENE_GROUP, NULL);
+}
+
+// node = scene.rect({w = 100, h = 10, color = color, filled = true, border = color})
+static int lua_scene_rect(lua_State *L)
+{
+    return new_node(L, RGB_SCENE_RECT, NULL);
+}
+
+// node = scene.text({text = "Hello", font = id, color = color, align = "center"})
+// node = scene.text("Hello")
+static int lua_scene_text(lua_State *L)
+{
+    return new_node(L, RGB_SCENE_TEXT, "text");
+}
+
+// node = scene.image({image = img, color = ink})
+// node = scene.image(img)
+static int lua_scene_image(lua_State *L)
+{
+    return new_node(L, RGB_SCENE_IMAGE, "image");
+}
+
+// node:set({key = value, ...}) -> node
+static int l_node_set(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    set_props(L, node, 2);
+    lua_settop(L, 1);
+    return 1;
+}
+
+// group:add(child, ...) -> group
+// Appends children in order, moving them from any other group
+static int l_node_add(lua_State *L)
+{
+    rgb_scene_node_t *parent = check_node(L, 1);
+    int top = lua_gettop(L);
+    for (int i = 2; i <= top; i++) {
+        rgb_scene_node_t *child = check_node(L, i);
+        if (rgb_scene_node_type(parent) != RGB_SCENE_GROUP) {
+            return luaL_error(L, "Only groups have children");
+        }
+        if (!rgb_scene_append(parent, child)) {
+            return luaL_argerror(L, i, "node is an ancestor of the group");
+        }
+        set_attached(L, i, child, true);
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+// node:remove() - detach from the parent group
+static int l_node_remove(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    if (rgb_scene_parent(node)) {
+        rgb_scene_detach(node);
+        set_attached(L, 1, node, false);
+    }
+    return 0;
+}
+
+// group:clear() - detach all children
+static int l_node_clear(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    rgb_scene_node_t *child;
+    while ((child = rgb_scene_first_child(node)) != NULL) {
+        rgb_scene_detach(child);
+        set_detached_by_node(L, child);
+    }
+    return 0;
+}
+
+// node:parent() -> group or nil
+static int l_node_parent(lua_State *L)
+{
+    push_handle(L, rgb_scene_parent(check_node(L, 1)));
+    return 1;
+}
+
+// group:children() -> {node, ...}
+static int l_node_children(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    lua_newtable(L);
+    int i = 0;
+    for (rgb_scene_node_t *c = rgb_scene_first_child(node); c; c = rgb_scene_next_sibling(c)) {
+        push_handle(L, c);
+        lua_rawseti(L, -2, ++i);
+    }
+    return 1;
+}
+
+// x, y, w, h = node:box()
+// Where the last render placed the node
+static int l_node_box(lua_State *L)
+{
+    rgb_scene_rect_t box = rgb_scene_get_box(check_node(L, 1));
+    lua_pushinteger(L, box.x);
+    lua_pushinteger(L, box.y);
+    lua_pushinteger(L, box.width);
+    lua_pushinteger(L, box.height);
+    return 4;
+}
+
+// rects, pixels = root:render([canvas])
+// Lays out what changed and repaints the damaged areas of the screen (or
+// the current target), or of a canvas. The screen is not allowed inside a
+// display frame, whose recorded commands would be drawn over it; a canvas
+// is, to be blitted in the frame. An unchanged scene leaves the canvas
+// untouched, so the frame's blit of it is unchanged too.
+static int l_node_render(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    rgb_surface_t *canvas = lua_isnoneornil(L, 2) ? NULL : lua_display_check_canvas(L, 2);
+    if (rgb_scene_parent(node)) {
+        return luaL_error(L, "render() on a node inside a group");
+    }
+    if (!canvas && lua_display_in_frame()) {
+        return luaL_error(L, "render() inside a display frame (render into a canvas and blit it)");
+    }
+
+    int rects = 0, pixels = 0;
+    if (!canvas) {
+        rects = rgb_scene_render(node, &pixels);
+    } else if (rgb_scene_needs_render(node, canvas)) {
+        rgb_display_clip_t clip = *rgb_display_get_clip();
+        rgb_display_set_target(canvas);
+        rects = rgb_scene_render(node, &pixels);
+        rgb_display_set_target(NULL);
+        rgb_display_set_clip(clip.x0, clip.y0, clip.x1 - clip.x0, clip.y1 - clip.y0);
+    }
+    lua_pushinteger(L, rects);
+    lua_pushinteger(L, pixels);
+    return 2;
+}
+
+// root:invalidate() - repaint everything at the next render
+static int l_node_invalidate(lua_State *L)
+{
+    rgb_scene_invalidate(check_node(L, 1));
+    return 0;
+}
+
+// node = root:hit(x, y)
+// Topmost visible node at a point, for touch handling (nil for none)
+static int l_node_hit(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    int x = luaL_checkinteger(L, 2);
+    int y = luaL_checkinteger(L, 3);
+    push_handle(L, rgb_scene_hit_test(node, x, y));
+    return 1;
+}
+
+static int l_node_index(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    const char *key = luaL_checkstring(L, 2);
+
+    // Methods are in the metatable
+    lua_getmetatable(L, 1);
+    lua_getfield(L, -1, key);
+    if (!lua_isnil(L, -1)) return 1;
+    lua_pop(L, 2);
+
+    if (!get_prop(L, node, key)) lua_pushnil(L);
+    return 1;
+}
+
+static int l_node_newindex(lua_State *L)
+{
+    rgb_scene_node_t *node = check_node(L, 1);
+    set_prop(L, node, luaL_checkstring(L, 2), 3);
+    return 0;
+}
+
+// Children stay alive on their own handles once detached
+static int l_node_gc(lua_State *L)
+{
+    node_ud_t *ud = (node_ud_t *)luaL_checkudata(L, 1, NODE_MT);
+    if (!ud->node) return 0;
+
+    for (rgb_scene_node_t *c = rgb_scene_first_child(ud->node); c; c = rgb_scene_next_sibling(c)) {
+        set_detached_by_node(L, c);
+    }
+    rgb_scene_node_free(ud->node);
+    ud->node = NULL;
+    return 0;
+}
+
+static const luaL_Reg node_methods[] = {
+    {"set",        l_node_set},
+    {"add",        l_node_add},
+    {"remove",     l_node_remove},
+    {"clear",      l_node_clear},
+    {"parent",     l_node_parent},
+    {"children",   l_node_children},
+    {"box",        l_node_box},
+    {"render",     l_node_render},
+    {"invalidate", l_node_invalidate},
+    {"hit",        l_node_hit},
+    {"__index",    l_node_index},
+    {"__newindex", l_node_newindex},
+    {"__gc",       l_node_gc},
+    {NULL, NULL}
+};
+
+static const luaL_Reg scene_funcs[] = {
+    {"group", lua_scene_group},
+    {"rect",  lua_scene_rect},
+    {"text",  lua_scene_text},
+    {"image", lua_scene_image},
+    {NULL, NULL}
+};
+
+int luaopen_scene(lua_State *L)
+{
+    luaL_newmetatable(L, NODE_MT);
+    luaL_setfuncs(L, node_methods, 0);
+    lua_pop(L, 1);
+
+    // Handles by node, weak so unattached handles can be collected
+    lua_newtable(L);
+    lua_createtable(L, 0, 1);
+    lua_pushstring(L, "v");
+    lua_setfield(L, -2, "__mode");
+    lua_setmetatable(L, -2);
+    lua_rawsetp(L, LUA_REGISTRYINDEX, &s_handles_key);
+
+    lua_newtable(L);
+    lua_rawsetp(L, LUA_REGISTRYINDEX, &s_attached_key);
+
+    luaL_newlib(L, scene_funcs);
+    return 1;
+}
@@ -6,6 +6,7 @@
 #include "lauxlib.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
 
 // sys.sleep(ms) - sleep for given milliseconds, yields to FreeRTOS
 static int lua_sys_sleep(lua_State *L)
@@ -17,8 +18,16 @@ static int lua_sys_sleep(lua_State *L)
     return 0;
 }
 
+// sys.millis() - milliseconds since boot
+static int lua_sys_millis(lua_State *L)
+{
+    lua_pushinteger(L, esp_timer_get_time() / 1000);
+    return 1;
+}
+
 static const luaL_Reg sys_lib[] = {
     {"sleep", lua_sys_sleep},
+    {"millis", lua_sys_millis},
     {NULL, NULL}
 };
 
@@ -0,0 +1,78 @@
+/*
+ * Asset Partition Access
+ *
+ * The directory is read with esp_partition_read() when an asset is
+ * requested; only the blob itself is mapped, so nothing is parsed at boot
+ * and many assets can live in flash without using address space.
+ */
+
+#include <string.h>
+#include "assets.h"
+#include "esp_log.h"
+
+static const char *TAG = "ASSETS";
+
+static const esp_partition_t *s_partition = NULL;
+
+static const esp_partition_t *assets_partition(void)
+{
+    if (!s_partition) {
+        s_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                               ESP_PARTITION_SUBTYPE_ANY,
+                                               ASSETS_PARTITION_LABEL);
+    }
+    return s_partition;
+}
+
+esp_err_t assets_map(const char *name, assets_map_t *out)
+{
+    if (!name || !out) return ESP_ERR_INVALID_ARG;
+    memset(out, 0, sizeof(*out));
+
+    const esp_partition_t *part = assets_partition();
+    if (!part) {
+        ESP_LOGW(TAG, "No '%s' partition", ASSETS_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    assets_header_t header;
+    esp_err_t ret = esp_partition_read(part, 0, &header, sizeof(header));
+    if (ret != ESP_OK) return ret;
+
+    if (memcmp(header.magic, ASSETS_MAGIC, 4) != 0 || header.version != ASSETS_VERSION) {
+        ESP_LOGW(TAG, "Partition '%s' holds no asset directory", ASSETS_PARTITION_LABEL);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    size_t entry_offset = sizeof(header);
+    for (int i = 0; i < header.count; i++, entry_offset += sizeof(assets_entry_t)) {
+        assets_entry_t entry;
+        ret = esp_partition_read(part, entry_offset, &entry, sizeof(entry));
+        if (ret != ESP_OK) return ret;
+
+        if (strncmp(entry.name, name, ASSETS_NAME_LEN) != 0) continue;
+
+        if (entry.size == 0 || entry.offset + entry.size > part->size) {
+            ESP_LOGE(TAG, "Asset '%s' is out of partition bounds", name);
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        ret = esp_partition_mmap(part, entry.offset, entry.size, ESP_PARTITION_MMAP_DATA,
+                                 &out->data, &out->handle);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to map asset '%s': %s", name, esp_err_to_name(ret));
+            return ret;
+        }
+        out->size = entry.size;
+        return ESP_OK;
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+void assets_unmap(assets_map_t *map)
+{
+    if (!map || !map->data) return;
+    esp_partition_munmap(map->handle);
+    memset(map, 0, sizeof(*map));
+}
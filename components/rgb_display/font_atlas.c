@@ -0,0 +1,310 @@
+/*
+ * Glyph Atlas - pre-expanded glyph spans in internal RAM
+ *
+ * Each page belongs to one (font, color) pair and holds the glyphs drawn
+ * with it as solid spans (along rows or columns, whichever needs fewer),
+ * plus a row of pixels in that color. A cached glyph is drawn as plain
+ * span fills, with no bit or RLE decoding. Pages are statically allocated,
+ * so they live in internal DRAM rather than PSRAM.
+ *
+ * Replacement is least-frequently-used with aging: every string drawn
+ * counts a use for its page, a new pair takes the page with the fewest
+ * uses, and all counts are halved on each eviction. A one-off color
+ * therefore recycles one page instead of pushing out the theme colors.
+ */
+
+#include <string.h>
+#include "fonts.h"
+#include "rgb_display.h"
+#include "rgb_stats.h"
+
+#define SLOT_EMPTY 0xFFFF
+
+// Horizontal spans cover len pixels to the right of (x, row), vertical
+// spans len pixels down from it
+typedef struct {
+    uint8_t row;
+    uint8_t x;
+    uint8_t len;
+} atlas_span_t;
+
+typedef struct {
+    uint16_t offset;        // First span, SLOT_EMPTY if not expanded yet
+    uint16_t count : 15;
+    uint16_t vertical : 1;
+} atlas_slot_t;
+
+struct font_atlas_page {
+    const font_t *font;     // NULL = free
+    uint16_t color;
+    uint16_t uses;
+    uint16_t spans_used;
+    uint16_t glyphs;
+    atlas_slot_t slots[FONT_ATLAS_GLYPHS];
+    uint16_t fill[FONT_ATLAS_MAX_GLYPH];
+    atlas_span_t spans[FONT_ATLAS_SPANS];
+};
+
+static font_atlas_page_t s_pages[FONT_ATLAS_PAGES];
+static uint64_t s_mask[FONT_ATLAS_MAX_GLYPH];   // One bit per pixel, row-major
+static uint32_t s_hits = 0;
+static uint32_t s_misses = 0;
+static uint32_t s_evictions = 0;
+
+font_atlas_page_t* font_atlas_get_page(const font_t *font, uint16_t color)
+{
+    if (!font || !font->bitmap) return NULL;
+
+    font_atlas_page_t *victim = NULL;
+    font_atlas_page_t *same_font = NULL;
+
+    for (int i = 0; i < FONT_ATLAS_PAGES; i++) {
+        font_atlas_page_t *p = &s_pages[i];
+        if (p->font == font && p->color == color) {
+            if (p->uses < UINT16_MAX) p->uses++;
+            return p;
+        }
+        if (p->font == font && (!same_font || p->glyphs > same_font->glyphs)) {
+            same_font = p;
+        }
+        if (!victim || (victim->font && (!p->font || p->uses < victim->uses))) {
+            victim = p;
+        }
+    }
+
+    if (victim->font) {
+        s_evictions++;
+        for (int i = 0; i < FONT_ATLAS_PAGES; i++) {
+            s_pages[i].uses >>= 1;
+        }
+    }
+
+    // Spans don't depend on color, so another page of the same font
+    // saves expanding its glyphs again
+    if (same_font && same_font != victim) {
+        memcpy(victim->slots, same_font->slots, sizeof(victim->slots));
+        memcpy(victim->spans, same_font->spans, same_font->spans_used * sizeof(atlas_span_t));
+        victim->spans_used = same_font->spans_used;
+        victim->glyphs = same_font->glyphs;
+    } else if (!same_font) {
+        memset(victim->slots, 0xFF, sizeof(victim->slots));
+        victim->spans_used = 0;
+        victim->glyphs = 0;
+    }
+
+    victim->font = font;
+    victim->color = color;
+    victim->uses = 1;
+    for (int i = 0; i < FONT_ATLAS_MAX_GLYPH; i++) {
+        victim->fill[i] = color;
+    }
+    return victim;
+}
+
+// Decode a glyph bitmap (column-major, raw or RLE) into s_mask
+static void expand_mask(const font_t *font, const font_glyph_t *glyph)
+{
+    const uint8_t *bitmap = &font->bitmap[glyph->bitmap_offset];
+    int height = glyph->height;
+
+    memset(s_mask, 0, height * sizeof(s_mask[0]));
+
+    if (font->flags & FONT_FLAG_RLE) {
+        int pos = 0;
+        uint8_t code;
+        while ((code = *bitmap++) != 0) {
+            pos += code >> 3;
+            for (int n = code & 0x07; n > 0; n--, pos++) {
+                s_mask[pos % height] |= 1ULL << (pos / height);
+            }
+        }
+        return;
+    }
+
+    int bytes_per_col = (height + 7) / 8;
+    for (int col = 0; col < glyph->width; col++) {
+        for (int row = 0; row < height; row++) {
+            if (bitmap[col * bytes_per_col + row / 8] & (1 << (row & 7))) {
+                s_mask[row] |= 1ULL << col;
+            }
+        }
+    }
+}
+
+// Count horizontal (row) and vertical (column) runs in s_mask
+static void count_runs(const font_glyph_t *glyph, int *rows, int *cols)
+{
+    *rows = 0;
+    *cols = 0;
+    for (int row = 0; row < glyph->height; row++) {
+        uint64_t bits = s_mask[row];
+        // Run starts: set bits whose left neighbour is clear
+        *rows += __builtin_popcountll(bits & ~(bits << 1));
+        // Column runs starting in this row
+        uint64_t above = row > 0 ? s_mask[row - 1] : 0;
+        *cols += __builtin_popcountll(bits & ~above);
+    }
+}
+
+static inline void push_span(font_atlas_page_t *page, int row, int x, int len)
+{
+    page->spans[page->spans_used++] = (atlas_span_t){ row, x, len };
+}
+
+// Expand a glyph into spans at the end of the page; false if it doesn't fit
+// Spans run along rows or columns, whichever gives fewer of them.
+static bool add_glyph(font_atlas_page_t *page, atlas_slot_t *slot, const font_glyph_t *glyph)
+{
+    uint16_t start = page->spans_used;
+    int rows = 0;
+    int cols = 0;
+
+    if (glyph->width == 0) {
+        // Blank (space): no spans, and s_mask still holds the last glyph
+        slot->offset = start;
+        slot->count = 0;
+        slot->vertical = false;
+        page->glyphs++;
+        return true;
+    }
+
+    expand_mask(page->font, glyph);
+    count_runs(glyph, &rows, &cols);
+
+    if (start + (rows < cols ? rows : cols) > FONT_ATLAS_SPANS) {
+        return false;
+    }
+
+    bool vertical = cols < rows;
+    if (vertical) {
+        for (int col = 0; col < glyph->width; col++) {
+            uint64_t bit = 1ULL << col;
+            for (int row = 0; row < glyph->height; row++) {
+                if (!(s_mask[row] & bit)) continue;
+                int len = 1;
+                while (row + len < glyph->height && (s_mask[row + len] & bit)) len++;
+                push_span(page, row, col, len);
+                row += len;
+            }
+        }
+    } else {
+        for (int row = 0; row < glyph->height; row++) {
+            uint64_t bits = s_mask[row];
+            while (bits) {
+                int x = __builtin_ctzll(bits);
+                uint64_t rest = ~(bits >> x);
+                int len = rest ? __builtin_ctzll(rest) : 64 - x;
+                push_span(page, row, x, len);
+                bits = x + len >= 64 ? 0 : bits & (~0ULL << (x + len));
+            }
+        }
+    }
+
+    slot->offset = start;
+    slot->count = page->spans_used - start;
+    slot->vertical = vertical;
+    page->glyphs++;
+    return true;
+}
+
+bool font_atlas_draw_glyph(font_atlas_page_t *page, int x, int y, char c)
+{
+    if (!page) return false;
+
+    const font_t *font = page->font;
+    uint8_t ch = (uint8_t)c;
+    if (ch < font->first_char || ch > font->last_char) return false;
+
+    int index = ch - font->first_char;
+    if (index >= FONT_ATLAS_GLYPHS) {
+        s_misses++;
+        return false;
+    }
+
+    atlas_slot_t *slot = &page->slots[index];
+    if (slot->offset == SLOT_EMPTY) {
+        const font_glyph_t *glyph = &font->glyphs[index];
+        s_misses++;
+        if (glyph->width > FONT_ATLAS_MAX_GLYPH || glyph->height > FONT_ATLAS_MAX_GLYPH ||
+            !add_glyph(page, slot, glyph)) {
+            return false;
+        }
+    } else {
+        s_hits++;
+    }
+
+    const rgb_surface_t *target = rgb_display_get_target();
+    uint16_t *fb = target->pixels;
+    if (!fb) return true;
+    const int stride = target->width;
+
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    const atlas_span_t *span = &page->spans[slot->offset];
+    const atlas_span_t *end = span + slot->count;
+    const font_glyph_t *glyph = &font->glyphs[index];
+    uint16_t color = page->color;
+
+    if (x >= clip->x0 && y >= clip->y0 && x + glyph->width <= clip->x1 &&
+        y + glyph->height <= clip->y1) {
+        // Fully inside the clip: no per-span clipping
+        uint16_t *origin = &fb[y * stride + x];
+        if (slot->vertical) {
+            for (; span < end; span++) {
+                uint16_t *dst = origin + span->row * stride + span->x;
+                for (int i = 0; i < span->len; i++, dst += stride) *dst = color;
+                RGB_STATS_PIXELS(span->len);
+            }
+        } else {
+            for (; span < end; span++) {
+                uint16_t *dst = origin + span->row * stride + span->x;
+                for (int i = 0; i < span->len; i++) dst[i] = color;
+                RGB_STATS_PIXELS(span->len);
+            }
+        }
+        return true;
+    }
+
+    for (; span < end; span++) {
+        int x0 = x + span->x;
+        int y0 = y + span->row;
+        if (slot->vertical) {
+            int y1 = y0 + span->len;
+            if (x0 < clip->x0 || x0 >= clip->x1) continue;
+            if (y0 < clip->y0) y0 = clip->y0;
+            if (y1 > clip->y1) y1 = clip->y1;
+            for (int py = y0; py < y1; py++) fb[py * stride + x0] = color;
+            if (y1 > y0) RGB_STATS_PIXELS(y1 - y0);
+        } else {
+            int x1 = x0 + span->len;
+            if (y0 < clip->y0 || y0 >= clip->y1) continue;
+            if (x0 < clip->x0) x0 = clip->x0;
+            if (x1 > clip->x1) x1 = clip->x1;
+            if (x1 <= x0) continue;
+            memcpy(&fb[y0 * stride + x0], page->fill, (x1 - x0) * sizeof(uint16_t));
+            RGB_STATS_PIXELS(x1 - x0);
+        }
+    }
+    return true;
+}
+
+void font_atlas_get_stats(font_atlas_stats_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    for (int i = 0; i < FONT_ATLAS_PAGES; i++) {
+        if (!s_pages[i].font) continue;
+        out->pages++;
+        out->glyphs += s_pages[i].glyphs;
+        out->spans_used += s_pages[i].spans_used;
+    }
+    out->spans_total = FONT_ATLAS_PAGES * FONT_ATLAS_SPANS;
+    out->hits = s_hits;
+    out->misses = s_misses;
+    out->evictions = s_evictions;
+}
+
+void font_atlas_reset_stats(void)
+{
+    s_hits = 0;
+    s_misses = 0;
+    s_evictions = 0;
+}
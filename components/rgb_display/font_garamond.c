@@ -2,424 +2,589 @@
  * Garamond Font - Bitmap data
  * Generated from: fonts/EBGaramond/EBGaramond12-Regular.ttf
  * Pixel size: 20
- * Height: 17 pixels (3 bytes per column)
+ * Height: 17 pixels (RLE encoded)
  */
 
 #include "fonts.h"
 
 static const uint8_t garamond20_bitmap[] = {
     // ! (33) - 3px wide, offset 0
-    0x00, 0x00, 0x00, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // " (34) - 5px wide, offset 9
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // # (35) - 7px wide, offset 24
-    0x00, 0x01, 0x00, 0x10, 0x07, 0x00, 0x70, 0x01, 0x00, 0x16, 0x01, 0x00, 
-    0xD0, 0x01, 0x00, 0x1C, 0x01, 0x00, 0x10, 0x00, 0x00, 
-    // $ (36) - 8px wide, offset 45
-    0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x3C, 0x08, 0x00, 0x62, 0x1F, 0x00, 
-    0xFF, 0x08, 0x00, 0xC2, 0x0D, 0x00, 0x86, 0x07, 0x00, 0x00, 0x00, 0x00, 
-        // % (37) - 11px wide, offset 69
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x42, 0x08, 0x00, 0x42, 0x04, 0x00, 
-    0x3C, 0x01, 0x00, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0xD8, 0x07, 0x00, 
-    0x24, 0x08, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x07, 0x00, 
-    // & (38) - 12px wide, offset 102
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x0C, 0x0C, 0x00, 0x36, 0x08, 0x00, 
-    0x62, 0x08, 0x00, 0x96, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 
-    0x80, 0x0C, 0x00, 0x60, 0x08, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        // ' (39) - 3px wide, offset 138
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // ( (40) - 5px wide, offset 147
-    0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x04, 0x30, 0x00, 0x01, 0x80, 0x00, 
-    0x00, 0x00, 0x00, 
-    // ) (41) - 5px wide, offset 162
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x04, 0x18, 0x00, 0xF0, 0x07, 0x00, 
-    0x00, 0x00, 0x00, 
-    // * (42) - 5px wide, offset 177
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 
-    // + (43) - 9px wide, offset 192
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 
-    0xF0, 0x0F, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 
-    0x80, 0x00, 0x00, 
-    // , (44) - 3px wide, offset 219
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x18, 0x00, 
-    // - (45) - 4px wide, offset 228
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-        // . (46) - 3px wide, offset 240
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // / (47) - 7px wide, offset 249
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x00, 0xE0, 0x00, 0x00, 
-    0x18, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // 0 (48) - 8px wide, offset 270
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 
-        // 1 (49) - 5px wide, offset 294
-    0x00, 0x08, 0x00, 0x20, 0x08, 0x00, 0xE0, 0x0F, 0x00, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // 2 (50) - 7px wide, offset 309
-    0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0x60, 0x09, 0x00, 
-    0xC0, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // 3 (51) - 6px wide, offset 330
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x42, 0x00, 0xE0, 0x23, 0x00, 
-    0x40, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-    // 4 (52) - 8px wide, offset 348
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x80, 0x04, 0x00, 
-    0xC0, 0x3F, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        // 5 (53) - 5px wide, offset 372
-    0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x60, 0x43, 0x00, 0x20, 0x26, 0x00, 
-    0x00, 0x1C, 0x00, 
-    // 6 (54) - 8px wide, offset 387
-    0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x30, 0x0C, 0x00, 0x08, 0x08, 0x00, 
-    0x44, 0x08, 0x00, 0xC0, 0x04, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 
-        // 7 (55) - 7px wide, offset 411
-    0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x18, 0x00, 0x20, 0x04, 0x00, 
-    0x20, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x00, 
-    // 8 (56) - 7px wide, offset 432
-    0x00, 0x00, 0x00, 0x18, 0x07, 0x00, 0xEC, 0x0C, 0x00, 0xC4, 0x08, 0x00, 
-    0x84, 0x08, 0x00, 0x98, 0x07, 0x00, 0x00, 0x00, 0x00, 
-    // 9 (57) - 7px wide, offset 453
-    0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x60, 0x46, 0x00, 0x20, 0x24, 0x00, 
-    0x20, 0x10, 0x00, 0xC0, 0x0F, 0x00, 0x80, 0x03, 0x00, 
-    // : (58) - 2px wide, offset 474
-    0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 
-    // ; (59) - 3px wide, offset 480
-    0x00, 0x00, 0x00, 0x40, 0x24, 0x00, 0x00, 0x18, 0x00, 
-    // < (60) - 9px wide, offset 489
-    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x40, 0x02, 0x00, 
-    0x40, 0x02, 0x00, 0x20, 0x04, 0x00, 0x20, 0x04, 0x00, 0x10, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // = (61) - 9px wide, offset 516
-    0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 
-    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 
-    0x40, 0x02, 0x00, 
-    // > (62) - 9px wide, offset 543
-    0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x20, 0x04, 0x00, 0x20, 0x04, 0x00, 
-    0x40, 0x02, 0x00, 0x40, 0x02, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 
-    // ? (63) - 5px wide, offset 570
-    0x00, 0x00, 0x00, 0xC2, 0x09, 0x00, 0xC0, 0x08, 0x00, 0x60, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // @ (64) - 12px wide, offset 585
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x20, 0x18, 0x00, 0x10, 0x13, 0x00, 
-    0x88, 0x26, 0x00, 0x48, 0x24, 0x00, 0x48, 0x20, 0x00, 0xC8, 0x27, 0x00, 
-    0x18, 0x14, 0x00, 0x10, 0x14, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 
-        // A (65) - 13px wide, offset 621
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x00, 
-    0xC0, 0x08, 0x00, 0x98, 0x00, 0x00, 0x86, 0x00, 0x00, 0xBC, 0x00, 0x00, 
-    0xE0, 0x09, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // B (66) - 9px wide, offset 660
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x22, 0x0C, 0x00, 
-    0x22, 0x08, 0x00, 0x22, 0x08, 0x00, 0x7E, 0x0C, 0x00, 0xCC, 0x07, 0x00, 
-    0x00, 0x01, 0x00, 
-    // C (67) - 10px wide, offset 687
-    0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x98, 0x07, 0x00, 0x04, 0x04, 0x00, 
-    0x02, 0x0C, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 
-    0x06, 0x0C, 0x00, 0x0C, 0x06, 0x00, 
-    // D (68) - 12px wide, offset 717
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x06, 0x0C, 0x00, 
-    0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 
-    0x04, 0x04, 0x00, 0x0C, 0x06, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 
-        // E (69) - 9px wide, offset 753
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x42, 0x0C, 0x00, 
-    0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0xE2, 0x08, 0x00, 0x06, 0x0C, 0x00, 
-    0x00, 0x00, 0x00, 
-    // F (70) - 8px wide, offset 780
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x42, 0x08, 0x00, 
-    0x42, 0x00, 0x00, 0x42, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x06, 0x00, 0x00, 
-        // G (71) - 12px wide, offset 804
-    0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x18, 0x07, 0x00, 0x04, 0x04, 0x00, 
-    0x06, 0x0C, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x82, 0x08, 0x00, 
-    0x82, 0x0C, 0x00, 0x8E, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // H (72) - 13px wide, offset 840
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x42, 0x08, 0x00, 
-    0x40, 0x08, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 
-    0x40, 0x00, 0x00, 0x42, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x02, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // I (73) - 6px wide, offset 879
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x02, 0x08, 0x00, 
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // J (74) - 7px wide, offset 897
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x02, 0x80, 0x00, 
-    0xFE, 0x7F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // K (75) - 12px wide, offset 918
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x42, 0x0C, 0x00, 
-    0xE0, 0x00, 0x00, 0x90, 0x01, 0x00, 0x08, 0x03, 0x00, 0x06, 0x0E, 0x00, 
-    0x02, 0x0C, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // L (76) - 10px wide, offset 954
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x02, 0x0C, 0x00, 
-    0x02, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-    // M (77) - 14px wide, offset 984
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x1E, 0x08, 0x00, 
-    0x78, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0x00, 
-    0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1C, 0x08, 0x00, 0xFE, 0x0F, 0x00, 
-    0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // N (78) - 13px wide, offset 1026
-    0x02, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x1C, 0x08, 0x00, 
-    0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x00, 
-    0x00, 0x03, 0x00, 0x02, 0x0E, 0x00, 0xFE, 0x0F, 0x00, 0x02, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // O (79) - 12px wide, offset 1065
-    0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x1C, 0x07, 0x00, 0x04, 0x04, 0x00, 
-    0x02, 0x0C, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 
-    0x04, 0x04, 0x00, 0x0C, 0x06, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 
-        // P (80) - 9px wide, offset 1101
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x02, 0x08, 0x00, 
-    0x82, 0x00, 0x00, 0x82, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x7C, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // Q (81) - 15px wide, offset 1128
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x18, 0x06, 0x00, 0x04, 0x08, 0x00, 
-    0x02, 0x10, 0x00, 0x02, 0x10, 0x00, 0x02, 0x20, 0x00, 0x02, 0x70, 0x00, 
-    0x06, 0xC0, 0x00, 0x0C, 0x88, 0x00, 0x38, 0x86, 0x01, 0xF0, 0x03, 0x01, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    // R (82) - 12px wide, offset 1173
-    0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x46, 0x08, 0x00, 
-    0x42, 0x00, 0x00, 0xC2, 0x00, 0x00, 0xB6, 0x03, 0x00, 0x1C, 0x07, 0x00, 
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        // S (83) - 7px wide, offset 1209
-    0x00, 0x00, 0x00, 0x1C, 0x0C, 0x00, 0x36, 0x08, 0x00, 0x62, 0x08, 0x00, 
-    0xC2, 0x08, 0x00, 0x82, 0x07, 0x00, 0x00, 0x03, 0x00, 
-    // T (84) - 11px wide, offset 1230
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 
-    0x02, 0x08, 0x00, 0xFE, 0x0F, 0x00, 0x02, 0x08, 0x00, 0x02, 0x00, 0x00, 
-    0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 
-    // U (85) - 12px wide, offset 1263
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x02, 0x06, 0x00, 
-    0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x04, 0x00, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // V (86) - 11px wide, offset 1299
-    0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF2, 0x00, 0x00, 
-    0x80, 0x07, 0x00, 0x00, 0x06, 0x00, 0x80, 0x01, 0x00, 0x32, 0x00, 0x00, 
-    0x0E, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // W (87) - 15px wide, offset 1332
-    0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x70, 0x00, 0x00, 
-    0xC0, 0x03, 0x00, 0x02, 0x0F, 0x00, 0x06, 0x01, 0x00, 0x7A, 0x00, 0x00, 
-    0xF0, 0x01, 0x00, 0x82, 0x07, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x00, 0x00, 
-    0x1E, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // X (88) - 13px wide, offset 1377
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x08, 0x00, 0x06, 0x0C, 0x00, 
-    0x0E, 0x0A, 0x00, 0x3A, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x01, 0x00, 
-    0x18, 0x0F, 0x00, 0x06, 0x0E, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // Y (89) - 10px wide, offset 1416
-    0x02, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3A, 0x08, 0x00, 
-    0xE0, 0x0F, 0x00, 0xC0, 0x0F, 0x00, 0x10, 0x08, 0x00, 0x06, 0x00, 0x00, 
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // Z (90) - 10px wide, offset 1446
-    0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x02, 0x0E, 0x00, 0x82, 0x09, 0x00, 
-    0xC2, 0x08, 0x00, 0x32, 0x08, 0x00, 0x1A, 0x08, 0x00, 0x0E, 0x08, 0x00, 
-    0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-    // [ (91) - 5px wide, offset 1476
-    0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // backslash (92) - 7px wide, offset 1491
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x80, 0x01, 0x00, 
-    0x00, 0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    // ] (93) - 5px wide, offset 1512
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x7F, 0x00, 
-    0x00, 0x00, 0x00, 
-    // ^ (94) - 8px wide, offset 1527
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0C, 0x00, 0x00, 
-    0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // _ (95) - 9px wide, offset 1551
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 
-    0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 
-    // ` (96) - 4px wide, offset 1578
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // a (97) - 7px wide, offset 1590
-    0x00, 0x00, 0x00, 0x40, 0x0E, 0x00, 0x20, 0x08, 0x00, 0x20, 0x01, 0x00, 
-    0xE0, 0x0F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // b (98) - 8px wide, offset 1611
-    0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x40, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x01, 0x00, 
-        // c (99) - 6px wide, offset 1635
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x20, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x40, 0x00, 0x00, 
-    // d (100) - 9px wide, offset 1653
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x63, 0x0C, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // e (101) - 6px wide, offset 1680
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0xA0, 0x0C, 0x00, 0xA0, 0x08, 0x00, 
-    0xE0, 0x08, 0x00, 0xC0, 0x00, 0x00, 
-    // f (102) - 7px wide, offset 1698
-    0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xFC, 0x0F, 0x00, 0x02, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 
-    // g (103) - 7px wide, offset 1719
-    0x00, 0xC0, 0x00, 0xC0, 0x8B, 0x01, 0x20, 0x04, 0x01, 0x20, 0x04, 0x01, 
-    0x60, 0x02, 0x01, 0xE0, 0xC1, 0x00, 0x20, 0x60, 0x00, 
-    // h (104) - 8px wide, offset 1740
-    0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x60, 0x08, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-        // i (105) - 4px wide, offset 1764
-    0x00, 0x00, 0x00, 0xC4, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-        // j (106) - 4px wide, offset 1776
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE4, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-        // k (107) - 8px wide, offset 1788
-    0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x03, 0x09, 0x00, 0x00, 0x03, 0x00, 
-    0x40, 0x0E, 0x00, 0x20, 0x0C, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        // l (108) - 4px wide, offset 1812
-    0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 
-        // m (109) - 13px wide, offset 1824
-    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x60, 0x08, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x60, 0x08, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // n (110) - 9px wide, offset 1863
-    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x60, 0x08, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // o (111) - 8px wide, offset 1890
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 
-        // p (112) - 8px wide, offset 1914
-    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0xE0, 0x0E, 0x01, 0x00, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x20, 0x08, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x01, 0x00, 
-        // q (113) - 9px wide, offset 1938
-    0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x08, 0x00, 0x60, 0x00, 0x01, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 
-    // r (114) - 6px wide, offset 1965
-    0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0xE0, 0x0F, 0x00, 0x20, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // s (115) - 5px wide, offset 1983
-    0x00, 0x00, 0x00, 0xC0, 0x08, 0x00, 0x20, 0x09, 0x00, 0x20, 0x0E, 0x00, 
-    0x00, 0x04, 0x00, 
-    // t (116) - 5px wide, offset 1998
-    0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x0C, 0x00, 0x20, 0x08, 0x00, 
-    0x20, 0x00, 0x00, 
-    // u (117) - 9px wide, offset 2013
-    0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x20, 0x0E, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x08, 0x00, 0x20, 0x04, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // v (118) - 8px wide, offset 2040
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xA0, 0x03, 0x00, 0x00, 0x0E, 0x00, 
-    0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // w (119) - 12px wide, offset 2064
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x0E, 0x00, 
-    0x20, 0x02, 0x00, 0xE0, 0x00, 0x00, 0xA0, 0x03, 0x00, 0x00, 0x0E, 0x00, 
-    0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // x (120) - 7px wide, offset 2100
-    0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0xE0, 0x02, 0x00, 0x80, 0x03, 0x00, 
-    0x60, 0x0E, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    // y (121) - 8px wide, offset 2121
-    0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0xA0, 0x43, 0x00, 0x00, 0x0E, 0x00, 
-    0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // z (122) - 6px wide, offset 2145
-    0x00, 0x00, 0x00, 0x20, 0x0C, 0x00, 0x20, 0x0B, 0x00, 0xA0, 0x09, 0x00, 
-    0x60, 0x08, 0x00, 0x20, 0x0C, 0x00, 
-    // { (123) - 6px wide, offset 2163
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0x40, 0x00, 
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    // | (124) - 2px wide, offset 2181
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-    // } (125) - 6px wide, offset 2187
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0x60, 0x00, 0x7E, 0x3F, 0x00, 
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // ~ (126) - 8px wide, offset 2205
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    };
+    0x97, 0x19, 0x00, 
+    // " (34) - 5px wide, offset 3
+    0x93, 0xFB, 0x00, 
+    // # (35) - 7px wide, offset 6
+    0x41, 0x61, 0x1B, 0x53, 0x09, 0x4A, 0x09, 0x19, 0x61, 0x0B, 0x53, 0x19, 
+    0x61, 0x00, 
+    // $ (36) - 8px wide, offset 20
+    0xA1, 0x2A, 0x44, 0x29, 0x31, 0x1A, 0x0D, 0x27, 0x01, 0x19, 0x31, 0x23, 
+    0x0A, 0x32, 0x24, 0x00, 
+    // % (37) - 11px wide, offset 36
+    0x9C, 0x61, 0x21, 0x21, 0x31, 0x21, 0x19, 0x44, 0x11, 0x72, 0x71, 0x72, 
+    0x0D, 0x41, 0x11, 0x29, 0x52, 0x1A, 0x5D, 0x00, 
+    // & (38) - 12px wide, offset 56
+    0xC4, 0x42, 0x32, 0x32, 0x0A, 0x29, 0x31, 0x1A, 0x21, 0x32, 0x09, 0x11, 
+    0x8A, 0x82, 0x69, 0x12, 0x52, 0x21, 0x51, 0x29, 0x00, 
+    // ' (39) - 3px wide, offset 77
+    0x93, 0x00, 
+    // ( (40) - 5px wide, offset 79
+    0xAF, 0x01, 0x39, 0x4A, 0x19, 0x71, 0x00, 
+    // ) (41) - 5px wide, offset 86
+    0x89, 0x62, 0x21, 0x42, 0x47, 0x00, 
+    // * (42) - 5px wide, offset 92
+    0x99, 0x09, 0x6C, 0x73, 0x81, 0x00, 
+    // + (43) - 9px wide, offset 98
+    0xC1, 0x81, 0x81, 0x6F, 0x01, 0x61, 0x81, 0x81, 0x81, 0x00, 
+    // , (44) - 3px wide, offset 108
+    0xD9, 0x11, 0x72, 0x00, 
+    // - (45) - 4px wide, offset 112
+    0xC9, 0x81, 0x00, 
+    // . (46) - 3px wide, offset 115
+    0xE1, 0x00, 
+    // / (47) - 7px wide, offset 117
+    0xDA, 0x6A, 0x63, 0x62, 0x6A, 0x00, 
+    // 0 (48) - 8px wide, offset 123
+    0xBD, 0x5A, 0x1A, 0x51, 0x29, 0x51, 0x29, 0x52, 0x1A, 0x5D, 0x00, 
+    // 1 (49) - 5px wide, offset 134
+    0x59, 0x51, 0x29, 0x57, 0x51, 0x00, 
+    // 2 (50) - 7px wide, offset 140
+    0xB1, 0x29, 0x51, 0x29, 0x52, 0x09, 0x11, 0x5A, 0x19, 0x81, 0x00, 
+    // 3 (51) - 6px wide, offset 151
+    0xF9, 0x39, 0x19, 0x21, 0x3D, 0x19, 0x49, 0x1B, 0x00, 
+    // 4 (52) - 8px wide, offset 160
+    0xD9, 0x81, 0x69, 0x11, 0x67, 0x01, 0x4F, 0x01, 0x69, 0x00, 
+    // 5 (53) - 5px wide, offset 170
+    0xBB, 0x6A, 0x0A, 0x21, 0x39, 0x1A, 0x11, 0x6B, 0x00, 
+    // 6 (54) - 8px wide, offset 179
+    0xB6, 0x52, 0x22, 0x41, 0x39, 0x39, 0x19, 0x21, 0x5A, 0x11, 0x6B, 0x00, 
+        // 7 (55) - 7px wide, offset 191
+    0xB1, 0x39, 0x41, 0x2A, 0x49, 0x21, 0x59, 0x11, 0x6B, 0x71, 0x00, 
+    // 8 (56) - 7px wide, offset 202
+    0xA2, 0x1B, 0x42, 0x0B, 0x12, 0x39, 0x1A, 0x19, 0x39, 0x21, 0x19, 0x42, 
+    0x14, 0x00, 
+    // 9 (57) - 7px wide, offset 216
+    0xC3, 0x62, 0x12, 0x19, 0x39, 0x21, 0x11, 0x41, 0x31, 0x56, 0x63, 0x00, 
+        // : (58) - 2px wide, offset 228
+    0x31, 0x21, 0x59, 0x21, 0x00, 
+    // ; (59) - 3px wide, offset 233
+    0xB9, 0x19, 0x11, 0x72, 0x00, 
+    // < (60) - 9px wide, offset 238
+    0xC2, 0x7A, 0x71, 0x11, 0x69, 0x11, 0x61, 0x21, 0x59, 0x21, 0x51, 0x31, 
+    0x00, 
+    // = (61) - 9px wide, offset 251
+    0xB9, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 
+    0x69, 0x11, 0x69, 0x11, 0x00, 
+    // > (62) - 9px wide, offset 268
+    0xA9, 0x31, 0x51, 0x21, 0x59, 0x21, 0x61, 0x11, 0x69, 0x11, 0x72, 0x7A, 
+    0x00, 
+    // ? (63) - 5px wide, offset 281
+    0x91, 0x23, 0x11, 0x5A, 0x19, 0x52, 0x00, 
+    // @ (64) - 12px wide, offset 288
+    0xBD, 0x59, 0x2A, 0x41, 0x1A, 0x11, 0x39, 0x19, 0x0A, 0x11, 0x31, 0x11, 
+    0x19, 0x11, 0x31, 0x11, 0x31, 0x31, 0x15, 0x11, 0x32, 0x29, 0x09, 0x41, 
+    0x29, 0x09, 0x4D, 0x00, 
+    // A (65) - 13px wide, offset 316
+    0xE1, 0x81, 0x6C, 0x5A, 0x19, 0x42, 0x11, 0x52, 0x21, 0x5C, 0x09, 0x74, 
+    0x11, 0x6C, 0x81, 0x81, 0x00, 
+    // B (66) - 9px wide, offset 333
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x19, 0x22, 0x31, 0x19, 0x29, 0x31, 0x19, 
+    0x29, 0x36, 0x1A, 0x3A, 0x15, 0x71, 0x00, 
+    // C (67) - 10px wide, offset 352
+    0xAD, 0x5A, 0x14, 0x41, 0x39, 0x39, 0x42, 0x31, 0x49, 0x31, 0x49, 0x31, 
+    0x49, 0x32, 0x3A, 0x3A, 0x2A, 0x00, 
+    // D (68) - 12px wide, offset 370
+    0x91, 0x49, 0x37, 0x04, 0x32, 0x3A, 0x31, 0x49, 0x31, 0x49, 0x31, 0x49, 
+    0x31, 0x49, 0x39, 0x39, 0x42, 0x2A, 0x4E, 0x00, 
+    // E (69) - 9px wide, offset 390
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x21, 0x1A, 0x31, 0x21, 0x21, 0x31, 0x21, 
+    0x21, 0x31, 0x1B, 0x19, 0x32, 0x3A, 0x00, 
+    // F (70) - 8px wide, offset 409
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x21, 0x21, 0x31, 0x21, 0x59, 0x21, 0x59, 
+    0x1B, 0x52, 0x00, 
+    // G (71) - 12px wide, offset 424
+    0xAD, 0x5A, 0x1B, 0x41, 0x39, 0x3A, 0x3A, 0x31, 0x49, 0x31, 0x49, 0x31, 
+    0x29, 0x19, 0x31, 0x29, 0x12, 0x33, 0x1C, 0x69, 0x00, 
+    // H (72) - 13px wide, offset 445
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x21, 0x21, 0x59, 0x21, 0x59, 0x81, 0x81, 
+    0x81, 0x59, 0x21, 0x21, 0x37, 0x04, 0x31, 0x49, 0x00, 
+    // I (73) - 6px wide, offset 466
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x49, 0x81, 0x00, 
+    // J (74) - 7px wide, offset 474
+    0xFA, 0x81, 0x11, 0x69, 0x17, 0x07, 0x19, 0x00, 
+    // K (75) - 12px wide, offset 482
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x21, 0x1A, 0x53, 0x69, 0x12, 0x59, 0x22, 
+    0x42, 0x33, 0x31, 0x42, 0x31, 0x49, 0x00, 
+    // L (76) - 10px wide, offset 501
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x42, 0x31, 0x49, 0x81, 0x81, 0x81, 0x7A, 
+    0x00, 
+    // M (77) - 14px wide, offset 514
+    0x91, 0x49, 0x37, 0x04, 0x34, 0x31, 0x44, 0x84, 0x83, 0x71, 0x71, 0x6A, 
+    0x6B, 0x31, 0x37, 0x04, 0x31, 0x49, 0x00, 
+    // N (78) - 13px wide, offset 533
+    0x09, 0x81, 0x49, 0x37, 0x04, 0x3B, 0x31, 0x43, 0x7B, 0x82, 0x82, 0x82, 
+    0x41, 0x3B, 0x37, 0x04, 0x31, 0x00, 
+    // O (79) - 12px wide, offset 551
+    0xAD, 0x53, 0x1B, 0x41, 0x39, 0x39, 0x42, 0x31, 0x49, 0x31, 0x49, 0x31, 
+    0x49, 0x39, 0x39, 0x42, 0x2A, 0x4F, 0x00, 
+    // P (80) - 9px wide, offset 570
+    0x91, 0x49, 0x37, 0x04, 0x31, 0x49, 0x31, 0x29, 0x51, 0x29, 0x52, 0x1A, 
+    0x5D, 0x00, 
+    // Q (81) - 15px wide, offset 584
+    0xAE, 0x52, 0x22, 0x41, 0x41, 0x31, 0x51, 0x29, 0x51, 0x29, 0x59, 0x21, 
+    0x53, 0x1A, 0x5A, 0x1A, 0x39, 0x19, 0x23, 0x1A, 0x22, 0x26, 0x31, 0x81, 
+    0x81, 0x00, 
+    // R (82) - 12px wide, offset 610
+    0x91, 0x49, 0x37, 0x04, 0x32, 0x19, 0x21, 0x31, 0x21, 0x59, 0x22, 0x52, 
+    0x0A, 0x0B, 0x4B, 0x1B, 0x82, 0x7A, 0x81, 0x00, 
+    // S (83) - 7px wide, offset 630
+    0x9B, 0x2A, 0x32, 0x0A, 0x29, 0x31, 0x1A, 0x21, 0x31, 0x22, 0x19, 0x31, 
+    0x2C, 0x72, 0x00, 
+    // T (84) - 11px wide, offset 645
+    0x8A, 0x81, 0x81, 0x81, 0x49, 0x37, 0x04, 0x31, 0x49, 0x31, 0x81, 0x81, 
+    0x7A, 0x00, 
+    // U (85) - 12px wide, offset 659
+    0x91, 0x87, 0x03, 0x39, 0x3A, 0x89, 0x81, 0x81, 0x81, 0x79, 0x3F, 0x02, 
+    0x41, 0x00, 
+    // V (86) - 11px wide, offset 673
+    0x09, 0x82, 0x7C, 0x69, 0x14, 0x84, 0x7A, 0x6A, 0x49, 0x12, 0x63, 0x71, 
+    0x00, 
+    // W (87) - 15px wide, offset 686
+    0x09, 0x81, 0x84, 0x83, 0x84, 0x41, 0x34, 0x32, 0x29, 0x49, 0x0C, 0x75, 
+    0x49, 0x2C, 0x73, 0x5B, 0x54, 0x69, 0x00, 
+    // X (88) - 13px wide, offset 705
+    0xE1, 0x31, 0x49, 0x32, 0x3A, 0x33, 0x29, 0x09, 0x31, 0x0B, 0x11, 0x6B, 
+    0x74, 0x5A, 0x1C, 0x32, 0x33, 0x31, 0x49, 0x31, 0x49, 0x00, 
+    // Y (89) - 10px wide, offset 727
+    0x09, 0x82, 0x7B, 0x71, 0x0B, 0x29, 0x57, 0x5E, 0x49, 0x31, 0x32, 0x79, 
+    0x00, 
+    // Z (90) - 10px wide, offset 740
+    0x92, 0x3A, 0x31, 0x3B, 0x31, 0x2A, 0x11, 0x31, 0x22, 0x19, 0x31, 0x12, 
+    0x29, 0x31, 0x0A, 0x31, 0x33, 0x39, 0x31, 0x42, 0x00, 
+    // [ (91) - 5px wide, offset 761
+    0x8F, 0x07, 0x01, 0x11, 0x81, 0x00, 
+    // backslash (92) - 7px wide, offset 767
+    0x9A, 0x8A, 0x92, 0x8A, 0x8A, 0x00, 
+    // ] (93) - 5px wide, offset 773
+    0x89, 0x81, 0x87, 0x07, 0x01, 0x00, 
+    // ^ (94) - 8px wide, offset 779
+    0xB2, 0x71, 0x72, 0x7A, 0x89, 0x8A, 0x00, 
+    // _ (95) - 9px wide, offset 786
+    0x71, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x00, 
+    // ` (96) - 4px wide, offset 795
+    0x91, 0x8A, 0x00, 
+    // a (97) - 7px wide, offset 798
+    0xB9, 0x13, 0x51, 0x29, 0x51, 0x11, 0x6F, 0x81, 0x00, 
+    // b (98) - 8px wide, offset 807
+    0x8F, 0x05, 0x59, 0x1A, 0x51, 0x29, 0x51, 0x29, 0x51, 0x29, 0x5D, 0x6A, 
+    0x00, 
+    // c (99) - 6px wide, offset 820
+    0xBD, 0x59, 0x22, 0x51, 0x29, 0x51, 0x29, 0x59, 0x00, 
+    // d (100) - 9px wide, offset 829
+    0xBD, 0x5A, 0x1A, 0x51, 0x29, 0x51, 0x29, 0x2A, 0x1A, 0x1A, 0x2F, 0x05, 
+    0x81, 0x00, 
+    // e (101) - 6px wide, offset 843
+    0xBD, 0x59, 0x09, 0x12, 0x51, 0x09, 0x19, 0x53, 0x19, 0x5A, 0x00, 
+    // f (102) - 7px wide, offset 854
+    0xB7, 0x3F, 0x03, 0x31, 0xF8, 0x11, 0x81, 0x00, 
+    // g (103) - 7px wide, offset 862
+    0x72, 0x3C, 0x09, 0x1A, 0x29, 0x21, 0x29, 0x29, 0x21, 0x29, 0x2A, 0x11, 
+    0x31, 0x2C, 0x2A, 0x31, 0x3A, 0x00, 
+    // h (104) - 8px wide, offset 880
+    0x8F, 0x05, 0x2A, 0x21, 0x21, 0xD9, 0x82, 0x21, 0x5E, 0x00, 
+    // i (105) - 4px wide, offset 890
+    0x99, 0x1E, 0x57, 0x00, 
+    // j (106) - 4px wide, offset 894
+    0xF8, 0x11, 0x11, 0x17, 0x03, 0x00, 
+    // k (107) - 8px wide, offset 900
+    0x8F, 0x05, 0x2A, 0x31, 0x11, 0x6A, 0x69, 0x13, 0x51, 0x22, 0x51, 0x29, 
+    0x00, 
+    // l (108) - 4px wide, offset 913
+    0x8F, 0x05, 0x29, 0x51, 0x00, 
+    // m (109) - 13px wide, offset 918
+    0xBE, 0x57, 0xD9, 0x82, 0x21, 0x5E, 0xD9, 0x82, 0x21, 0x5E, 0x81, 0x00, 
+        // n (110) - 9px wide, offset 930
+    0xBE, 0x57, 0xD9, 0x82, 0x21, 0x5E, 0x81, 0x00, 
+    // o (111) - 8px wide, offset 938
+    0xBD, 0x5A, 0x1A, 0x51, 0x29, 0x51, 0x29, 0x52, 0x1A, 0x5D, 0x00, 
+    // p (112) - 8px wide, offset 949
+    0xB7, 0x05, 0x2B, 0x0B, 0x21, 0x59, 0x51, 0x29, 0x51, 0x29, 0x5D, 0x6A, 
+    0x00, 
+    // q (113) - 9px wide, offset 962
+    0xBD, 0x5A, 0x1A, 0x51, 0x29, 0x51, 0x29, 0x52, 0x49, 0x2F, 0x05, 0x81, 
+    0x00, 
+    // r (114) - 6px wide, offset 975
+    0xBE, 0x57, 0x51, 0x81, 0x00, 
+    // s (115) - 5px wide, offset 980
+    0xBA, 0x19, 0x51, 0x11, 0x11, 0x51, 0x1B, 0x79, 0x00, 
+    // t (116) - 5px wide, offset 989
+    0xB6, 0x53, 0x1A, 0x51, 0x29, 0x51, 0x00, 
+    // u (117) - 9px wide, offset 996
+    0xB6, 0x59, 0x1B, 0x81, 0x81, 0x51, 0x21, 0x5F, 0x81, 0x00, 
+    // v (118) - 8px wide, offset 1006
+    0xB2, 0x79, 0x0B, 0x83, 0x6A, 0x62, 0x79, 0x00, 
+    // w (119) - 12px wide, offset 1014
+    0xB2, 0x7C, 0x8B, 0x51, 0x19, 0x63, 0x71, 0x0B, 0x83, 0x6A, 0x62, 0x79, 
+    0x00, 
+    // x (120) - 7px wide, offset 1027
+    0xB1, 0x29, 0x53, 0x09, 0x73, 0x62, 0x13, 0x51, 0x29, 0x00, 
+    // y (121) - 8px wide, offset 1037
+    0x81, 0x2A, 0x49, 0x29, 0x0B, 0x21, 0x5B, 0x6A, 0x62, 0x79, 0x00, 
+    // z (122) - 6px wide, offset 1048
+    0xB1, 0x22, 0x51, 0x12, 0x09, 0x51, 0x0A, 0x11, 0x52, 0x21, 0x51, 0x22, 
+    0x00, 
+    // { (123) - 6px wide, offset 1061
+    0xC1, 0x56, 0x0E, 0x1A, 0x61, 0x11, 0x69, 0x00, 
+    // | (124) - 2px wide, offset 1069
+    0x8F, 0x07, 0x02, 0x00, 
+    // } (125) - 6px wide, offset 1073
+    0x89, 0x69, 0x12, 0x5A, 0x1E, 0x0E, 0x51, 0x00, 
+    // ~ (126) - 8px wide, offset 1081
+    0xB9, 0x79, 0x81, 0x89, 0x81, 0x79, 0x00, 
+};
 
 static const font_glyph_t garamond20_glyphs[] = {
     {0, 0, 17, 0, 12, 3},  // Space (32)
     {0, 3, 17, 1, 1, 5},  // ! (33)
-    {9, 5, 17, 0, 1, 5},  // " (34)
-    {24, 7, 17, 0, 1, 7},  // # (35)
-    {45, 8, 17, 0, 0, 7},  // $ (36)
-    {69, 11, 17, 0, 1, 12},  // % (37)
-    {102, 12, 17, 0, 1, 13},  // & (38)
-    {138, 3, 17, 0, 1, 3},  // ' (39)
-    {147, 5, 17, 0, 0, 5},  // ( (40)
-    {162, 5, 17, 0, 0, 5},  // ) (41)
-    {177, 5, 17, 0, 1, 5},  // * (42)
-    {192, 9, 17, 0, 3, 9},  // + (43)
-    {219, 3, 17, 0, 10, 4},  // , (44)
-    {228, 4, 17, 0, 7, 4},  // - (45)
-    {240, 3, 17, 0, 11, 4},  // . (46)
-    {249, 7, 17, 0, 1, 6},  // / (47)
-    {270, 8, 17, 0, 5, 8},  // 0 (48)
-    {294, 5, 17, 0, 5, 5},  // 1 (49)
-    {309, 7, 17, 0, 5, 7},  // 2 (50)
-    {330, 6, 17, 0, 5, 6},  // 3 (51)
-    {348, 8, 17, 0, 5, 8},  // 4 (52)
-    {372, 5, 17, 0, 5, 6},  // 5 (53)
-    {387, 8, 17, 0, 1, 8},  // 6 (54)
-    {411, 7, 17, 0, 5, 7},  // 7 (55)
-    {432, 7, 17, 0, 2, 7},  // 8 (56)
-    {453, 7, 17, 0, 5, 7},  // 9 (57)
-    {474, 2, 17, 1, 6, 4},  // : (58)
-    {480, 3, 17, 0, 6, 4},  // ; (59)
-    {489, 9, 17, 0, 4, 9},  // < (60)
-    {516, 9, 17, 0, 6, 9},  // = (61)
-    {543, 9, 17, 0, 4, 9},  // > (62)
-    {570, 5, 17, 1, 1, 6},  // ? (63)
-    {585, 12, 17, 0, 3, 12},  // @ (64)
-    {621, 13, 17, -1, 0, 11},  // A (65)
-    {660, 9, 17, 0, 1, 9},  // B (66)
-    {687, 10, 17, 0, 1, 10},  // C (67)
-    {717, 12, 17, 0, 1, 12},  // D (68)
-    {753, 9, 17, 0, 1, 9},  // E (69)
-    {780, 8, 17, 0, 1, 8},  // F (70)
-    {804, 12, 17, 0, 1, 12},  // G (71)
-    {840, 13, 17, 0, 1, 13},  // H (72)
-    {879, 6, 17, 0, 1, 5},  // I (73)
-    {897, 7, 17, -2, 1, 5},  // J (74)
-    {918, 12, 17, 0, 1, 11},  // K (75)
-    {954, 10, 17, 0, 1, 9},  // L (76)
-    {984, 14, 17, 0, 1, 14},  // M (77)
-    {1026, 13, 17, 0, 1, 12},  // N (78)
-    {1065, 12, 17, 0, 1, 12},  // O (79)
-    {1101, 9, 17, 0, 1, 9},  // P (80)
-    {1128, 15, 17, 0, 1, 13},  // Q (81)
-    {1173, 12, 17, 0, 1, 11},  // R (82)
-    {1209, 7, 17, 0, 1, 7},  // S (83)
-    {1230, 11, 17, 0, 0, 11},  // T (84)
-    {1263, 12, 17, 0, 1, 12},  // U (85)
-    {1299, 11, 17, 0, 1, 11},  // V (86)
-    {1332, 15, 17, 0, 1, 15},  // W (87)
-    {1377, 13, 17, -1, 1, 11},  // X (88)
-    {1416, 10, 17, 0, 1, 9},  // Y (89)
-    {1446, 10, 17, 0, 1, 10},  // Z (90)
-    {1476, 5, 17, 1, 0, 6},  // [ (91)
-    {1491, 7, 17, 0, 1, 6},  // backslash (92)
-    {1512, 5, 17, 0, 0, 6},  // ] (93)
-    {1527, 8, 17, 0, 1, 8},  // ^ (94)
-    {1551, 9, 17, 0, 14, 8},  // _ (95)
-    {1578, 4, 17, 0, 1, 4},  // ` (96)
-    {1590, 7, 17, 0, 5, 6},  // a (97)
-    {1611, 8, 17, 0, 0, 8},  // b (98)
-    {1635, 6, 17, 0, 5, 6},  // c (99)
-    {1653, 9, 17, 0, 0, 8},  // d (100)
-    {1680, 6, 17, 0, 5, 6},  // e (101)
-    {1698, 7, 17, 0, 0, 5},  // f (102)
-    {1719, 7, 17, 0, 5, 7},  // g (103)
-    {1740, 8, 17, 0, 0, 8},  // h (104)
-    {1764, 4, 17, 0, 2, 4},  // i (105)
-    {1776, 4, 17, -1, 2, 3},  // j (106)
-    {1788, 8, 17, 0, 0, 8},  // k (107)
-    {1812, 4, 17, 0, 0, 4},  // l (108)
-    {1824, 13, 17, 0, 5, 12},  // m (109)
-    {1863, 9, 17, 0, 5, 8},  // n (110)
-    {1890, 8, 17, 0, 5, 8},  // o (111)
-    {1914, 8, 17, 0, 5, 8},  // p (112)
-    {1938, 9, 17, 0, 5, 8},  // q (113)
-    {1965, 6, 17, 0, 5, 5},  // r (114)
-    {1983, 5, 17, 0, 5, 5},  // s (115)
-    {1998, 5, 17, 0, 4, 5},  // t (116)
-    {2013, 9, 17, 0, 4, 8},  // u (117)
-    {2040, 8, 17, 0, 5, 7},  // v (118)
-    {2064, 12, 17, 0, 5, 11},  // w (119)
-    {2100, 7, 17, 0, 5, 7},  // x (120)
-    {2121, 8, 17, 0, 5, 7},  // y (121)
-    {2145, 6, 17, 0, 5, 6},  // z (122)
-    {2163, 6, 17, 0, 0, 6},  // { (123)
-    {2181, 2, 17, 1, 0, 4},  // | (124)
-    {2187, 6, 17, 0, 0, 6},  // } (125)
-    {2205, 8, 17, 0, 5, 8},  // ~ (126)
+    {3, 5, 17, 0, 1, 5},  // " (34)
+    {6, 7, 17, 0, 1, 7},  // # (35)
+    {20, 8, 17, 0, 0, 7},  // $ (36)
+    {36, 11, 17, 0, 1, 12},  // % (37)
+    {56, 12, 17, 0, 1, 13},  // & (38)
+    {77, 3, 17, 0, 1, 3},  // ' (39)
+    {79, 5, 17, 0, 0, 5},  // ( (40)
+    {86, 5, 17, 0, 0, 5},  // ) (41)
+    {92, 5, 17, 0, 1, 5},  // * (42)
+    {98, 9, 17, 0, 3, 9},  // + (43)
+    {108, 3, 17, 0, 10, 4},  // , (44)
+    {112, 4, 17, 0, 7, 4},  // - (45)
+    {115, 3, 17, 0, 11, 4},  // . (46)
+    {117, 7, 17, 0, 1, 6},  // / (47)
+    {123, 8, 17, 0, 5, 8},  // 0 (48)
+    {134, 5, 17, 0, 5, 5},  // 1 (49)
+    {140, 7, 17, 0, 5, 7},  // 2 (50)
+    {151, 6, 17, 0, 5, 6},  // 3 (51)
+    {160, 8, 17, 0, 5, 8},  // 4 (52)
+    {170, 5, 17, 0, 5, 6},  // 5 (53)
+    {179, 8, 17, 0, 1, 8},  // 6 (54)
+    {191, 7, 17, 0, 5, 7},  // 7 (55)
+    {202, 7, 17, 0, 2, 7},  // 8 (56)
+    {216, 7, 17, 0, 5, 7},  // 9 (57)
+    {228, 2, 17, 1, 6, 4},  // : (58)
+    {233, 3, 17, 0, 6, 4},  // ; (59)
+    {238, 9, 17, 0, 4, 9},  // < (60)
+    {251, 9, 17, 0, 6, 9},  // = (61)
+    {268, 9, 17, 0, 4, 9},  // > (62)
+    {281, 5, 17, 1, 1, 6},  // ? (63)
+    {288, 12, 17, 0, 3, 12},  // @ (64)
+    {316, 13, 17, -1, 0, 11},  // A (65)
+    {333, 9, 17, 0, 1, 9},  // B (66)
+    {352, 10, 17, 0, 1, 10},  // C (67)
+    {370, 12, 17, 0, 1, 12},  // D (68)
+    {390, 9, 17, 0, 1, 9},  // E (69)
+    {409, 8, 17, 0, 1, 8},  // F (70)
+    {424, 12, 17, 0, 1, 12},  // G (71)
+    {445, 13, 17, 0, 1, 13},  // H (72)
+    {466, 6, 17, 0, 1, 5},  // I (73)
+    {474, 7, 17, -2, 1, 5},  // J (74)
+    {482, 12, 17, 0, 1, 11},  // K (75)
+    {501, 10, 17, 0, 1, 9},  // L (76)
+    {514, 14, 17, 0, 1, 14},  // M (77)
+    {533, 13, 17, 0, 1, 12},  // N (78)
+    {551, 12, 17, 0, 1, 12},  // O (79)
+    {570, 9, 17, 0, 1, 9},  // P (80)
+    {584, 15, 17, 0, 1, 13},  // Q (81)
+    {610, 12, 17, 0, 1, 11},  // R (82)
+    {630, 7, 17, 0, 1, 7},  // S (83)
+    {645, 11, 17, 0, 0, 11},  // T (84)
+    {659, 12, 17, 0, 1, 12},  // U (85)
+    {673, 11, 17, 0, 1, 11},  // V (86)
+    {686, 15, 17, 0, 1, 15},  // W (87)
+    {705, 13, 17, -1, 1, 11},  // X (88)
+    {727, 10, 17, 0, 1, 9},  // Y (89)
+    {740, 10, 17, 0, 1, 10},  // Z (90)
+    {761, 5, 17, 1, 0, 6},  // [ (91)
+    {767, 7, 17, 0, 1, 6},  // backslash (92)
+    {773, 5, 17, 0, 0, 6},  // ] (93)
+    {779, 8, 17, 0, 1, 8},  // ^ (94)
+    {786, 9, 17, 0, 14, 8},  // _ (95)
+    {795, 4, 17, 0, 1, 4},  // ` (96)
+    {798, 7, 17, 0, 5, 6},  // a (97)
+    {807, 8, 17, 0, 0, 8},  // b (98)
+    {820, 6, 17, 0, 5, 6},  // c (99)
+    {829, 9, 17, 0, 0, 8},  // d (100)
+    {843, 6, 17, 0, 5, 6},  // e (101)
+    {854, 7, 17, 0, 0, 5},  // f (102)
+    {862, 7, 17, 0, 5, 7},  // g (103)
+    {880, 8, 17, 0, 0, 8},  // h (104)
+    {890, 4, 17, 0, 2, 4},  // i (105)
+    {894, 4, 17, -1, 2, 3},  // j (106)
+    {900, 8, 17, 0, 0, 8},  // k (107)
+    {913, 4, 17, 0, 0, 4},  // l (108)
+    {918, 13, 17, 0, 5, 12},  // m (109)
+    {930, 9, 17, 0, 5, 8},  // n (110)
+    {938, 8, 17, 0, 5, 8},  // o (111)
+    {949, 8, 17, 0, 5, 8},  // p (112)
+    {962, 9, 17, 0, 5, 8},  // q (113)
+    {975, 6, 17, 0, 5, 5},  // r (114)
+    {980, 5, 17, 0, 5, 5},  // s (115)
+    {989, 5, 17, 0, 4, 5},  // t (116)
+    {996, 9, 17, 0, 4, 8},  // u (117)
+    {1006, 8, 17, 0, 5, 7},  // v (118)
+    {1014, 12, 17, 0, 5, 11},  // w (119)
+    {1027, 7, 17, 0, 5, 7},  // x (120)
+    {1037, 8, 17, 0, 5, 7},  // y (121)
+    {1048, 6, 17, 0, 5, 6},  // z (122)
+    {1061, 6, 17, 0, 0, 6},  // { (123)
+    {1069, 2, 17, 1, 0, 4},  // | (124)
+    {1073, 6, 17, 0, 0, 6},  // } (125)
+    {1081, 8, 17, 0, 5, 8},  // ~ (126)
+};
+
+static const uint16_t garamond20_kern_index[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 8, 8, 16, 21, 21, 21, 21, 21, 21, 21, 21, 
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 33, 33, 
+    33, 36, 36, 43, 43, 43, 43, 43, 43, 48, 53, 53, 
+    56, 67, 67, 76, 76, 102, 102, 131, 160, 160, 198, 198, 
+    198, 198, 198, 198, 198, 198, 199, 203, 207, 207, 211, 217, 
+    217, 217, 217, 217, 217, 217, 217, 217, 221, 225, 225, 225, 
+    225, 225, 225, 228, 231, 231, 234, 234, 234, 234, 234, 234, 
+};
+
+static const font_kern_pair_t garamond20_kern_pairs[] = {
+    {44, 84, -1},  // , T
+    {44, 86, -2},  // , V
+    {44, 87, -2},  // , W
+    {44, 89, -2},  // , Y
+    {44, 118, -1},  // , v
+    {44, 119, -1},  // , w
+    {44, 120, -1},  // , x
+    {44, 121, -1},  // , y
+    {46, 84, -1},  // . T
+    {46, 86, -2},  // . V
+    {46, 87, -2},  // . W
+    {46, 89, -2},  // . Y
+    {46, 118, -1},  // . v
+    {46, 119, -1},  // . w
+    {46, 120, -1},  // . x
+    {46, 121, -1},  // . y
+    {47, 51, -1},  // / 3
+    {47, 52, -2},  // / 4
+    {47, 53, -2},  // / 5
+    {47, 57, -1},  // / 9
+    {47, 65, -2},  // / A
+    {65, 67, -1},  // A C
+    {65, 71, -1},  // A G
+    {65, 79, -1},  // A O
+    {65, 81, -1},  // A Q
+    {65, 84, -2},  // A T
+    {65, 86, -3},  // A V
+    {65, 87, -3},  // A W
+    {65, 89, -1},  // A Y
+    {65, 118, -1},  // A v
+    {65, 119, -1},  // A w
+    {65, 120, -1},  // A x
+    {65, 121, -1},  // A y
+    {68, 65, -2},  // D A
+    {68, 86, -1},  // D V
+    {68, 87, -1},  // D W
+    {70, 65, -1},  // F A
+    {70, 109, -1},  // F m
+    {70, 110, -1},  // F n
+    {70, 112, -1},  // F p
+    {70, 114, -1},  // F r
+    {70, 117, -1},  // F u
+    {70, 122, -1},  // F z
+    {76, 84, -2},  // L T
+    {76, 118, -1},  // L v
+    {76, 119, -1},  // L w
+    {76, 120, -1},  // L x
+    {76, 121, -1},  // L y
+    {77, 116, -1},  // M t
+    {77, 118, -1},  // M v
+    {77, 119, -1},  // M w
+    {77, 120, -1},  // M x
+    {77, 121, -1},  // M y
+    {79, 65, -2},  // O A
+    {79, 86, -1},  // O V
+    {79, 87, -1},  // O W
+    {80, 44, -1},  // P ,
+    {80, 46, -1},  // P .
+    {80, 65, -2},  // P A
+    {80, 97, -1},  // P a
+    {80, 99, -1},  // P c
+    {80, 100, -1},  // P d
+    {80, 101, -1},  // P e
+    {80, 103, -1},  // P g
+    {80, 111, -1},  // P o
+    {80, 113, -1},  // P q
+    {80, 115, -1},  // P s
+    {82, 65, 1},  // R A
+    {82, 67, -1},  // R C
+    {82, 71, -1},  // R G
+    {82, 79, -1},  // R O
+    {82, 81, -1},  // R Q
+    {82, 84, -2},  // R T
+    {82, 86, -2},  // R V
+    {82, 87, -2},  // R W
+    {82, 89, -1},  // R Y
+    {84, 44, -1},  // T ,
+    {84, 46, -1},  // T .
+    {84, 58, -1},  // T :
+    {84, 59, -1},  // T ;
+    {84, 65, -1},  // T A
+    {84, 86, 1},  // T V
+    {84, 87, 1},  // T W
+    {84, 97, -2},  // T a
+    {84, 99, -2},  // T c
+    {84, 100, -2},  // T d
+    {84, 101, -2},  // T e
+    {84, 103, -2},  // T g
+    {84, 109, -1},  // T m
+    {84, 110, -1},  // T n
+    {84, 111, -2},  // T o
+    {84, 112, -1},  // T p
+    {84, 113, -2},  // T q
+    {84, 114, -1},  // T r
+    {84, 115, -2},  // T s
+    {84, 116, -2},  // T t
+    {84, 117, -1},  // T u
+    {84, 118, -2},  // T v
+    {84, 119, -2},  // T w
+    {84, 120, -2},  // T x
+    {84, 121, -2},  // T y
+    {84, 122, -1},  // T z
+    {86, 44, -2},  // V ,
+    {86, 46, -2},  // V .
+    {86, 47, -2},  // V /
+    {86, 58, -2},  // V :
+    {86, 59, -2},  // V ;
+    {86, 65, -2},  // V A
+    {86, 67, -1},  // V C
+    {86, 71, -1},  // V G
+    {86, 79, -1},  // V O
+    {86, 81, -1},  // V Q
+    {86, 97, -2},  // V a
+    {86, 99, -2},  // V c
+    {86, 100, -2},  // V d
+    {86, 101, -2},  // V e
+    {86, 103, -2},  // V g
+    {86, 109, -1},  // V m
+    {86, 110, -1},  // V n
+    {86, 111, -2},  // V o
+    {86, 112, -1},  // V p
+    {86, 113, -2},  // V q
+    {86, 114, -1},  // V r
+    {86, 115, -2},  // V s
+    {86, 116, -1},  // V t
+    {86, 117, -1},  // V u
+    {86, 118, -2},  // V v
+    {86, 119, -2},  // V w
+    {86, 120, -2},  // V x
+    {86, 121, -2},  // V y
+    {86, 122, -1},  // V z
+    {87, 44, -2},  // W ,
+    {87, 46, -2},  // W .
+    {87, 47, -2},  // W /
+    {87, 58, -2},  // W :
+    {87, 59, -2},  // W ;
+    {87, 65, -2},  // W A
+    {87, 67, -1},  // W C
+    {87, 71, -1},  // W G
+    {87, 79, -1},  // W O
+    {87, 81, -1},  // W Q
+    {87, 97, -2},  // W a
+    {87, 99, -2},  // W c
+    {87, 100, -2},  // W d
+    {87, 101, -2},  // W e
+    {87, 103, -2},  // W g
+    {87, 109, -1},  // W m
+    {87, 110, -1},  // W n
+    {87, 111, -2},  // W o
+    {87, 112, -1},  // W p
+    {87, 113, -2},  // W q
+    {87, 114, -1},  // W r
+    {87, 115, -2},  // W s
+    {87, 116, -1},  // W t
+    {87, 117, -1},  // W u
+    {87, 118, -2},  // W v
+    {87, 119, -2},  // W w
+    {87, 120, -2},  // W x
+    {87, 121, -2},  // W y
+    {87, 122, -1},  // W z
+    {89, 44, -1},  // Y ,
+    {89, 46, -1},  // Y .
+    {89, 58, -1},  // Y :
+    {89, 59, -1},  // Y ;
+    {89, 65, -1},  // Y A
+    {89, 66, 1},  // Y B
+    {89, 68, 1},  // Y D
+    {89, 69, 1},  // Y E
+    {89, 70, 1},  // Y F
+    {89, 72, 1},  // Y H
+    {89, 73, 1},  // Y I
+    {89, 74, 1},  // Y J
+    {89, 75, 1},  // Y K
+    {89, 76, 1},  // Y L
+    {89, 77, 1},  // Y M
+    {89, 78, 1},  // Y N
+    {89, 80, 1},  // Y P
+    {89, 82, 1},  // Y R
+    {89, 84, 1},  // Y T
+    {89, 97, -2},  // Y a
+    {89, 99, -2},  // Y c
+    {89, 100, -2},  // Y d
+    {89, 101, -2},  // Y e
+    {89, 103, -2},  // Y g
+    {89, 109, -1},  // Y m
+    {89, 110, -1},  // Y n
+    {89, 111, -2},  // Y o
+    {89, 112, -1},  // Y p
+    {89, 113, -2},  // Y q
+    {89, 114, -1},  // Y r
+    {89, 115, -2},  // Y s
+    {89, 116, -1},  // Y t
+    {89, 117, -1},  // Y u
+    {89, 118, -1},  // Y v
+    {89, 119, -1},  // Y w
+    {89, 120, -1},  // Y x
+    {89, 121, -1},  // Y y
+    {89, 122, -1},  // Y z
+    {97, 84, -2},  // a T
+    {98, 84, -2},  // b T
+    {98, 86, -2},  // b V
+    {98, 87, -2},  // b W
+    {98, 89, -2},  // b Y
+    {99, 84, -2},  // c T
+    {99, 86, -2},  // c V
+    {99, 87, -2},  // c W
+    {99, 89, -2},  // c Y
+    {101, 84, -2},  // e T
+    {101, 86, -2},  // e V
+    {101, 87, -2},  // e W
+    {101, 89, -2},  // e Y
+    {102, 98, 1},  // f b
+    {102, 104, 1},  // f h
+    {102, 105, 1},  // f i
+    {102, 106, 1},  // f j
+    {102, 107, 1},  // f k
+    {102, 108, 1},  // f l
+    {111, 84, -2},  // o T
+    {111, 86, -2},  // o V
+    {111, 87, -2},  // o W
+    {111, 89, -2},  // o Y
+    {112, 84, -2},  // p T
+    {112, 86, -2},  // p V
+    {112, 87, -2},  // p W
+    {112, 89, -2},  // p Y
+    {118, 44, -1},  // v ,
+    {118, 46, -1},  // v .
+    {118, 65, -1},  // v A
+    {119, 44, -1},  // w ,
+    {119, 46, -1},  // w .
+    {119, 65, -1},  // w A
+    {121, 44, -1},  // y ,
+    {121, 46, -1},  // y .
+    {121, 65, -1},  // y A
 };
 
 const font_t font_garamond_20 = {
@@ -429,4 +594,8 @@ const font_t font_garamond_20 = {
     .last_char = 126,
     .line_height = 20,
     .baseline = 16,
+    .kern_index = garamond20_kern_index,
+    .kern_pairs = garamond20_kern_pairs,
+    .kern_count = 234,
+    .flags = FONT_FLAG_RLE,
 };
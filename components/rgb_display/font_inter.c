@@ -2,428 +2,961 @@
  * Inter Font - Bitmap data
  * Generated from: fonts/Inter/Inter18-Regular.ttf
  * Pixel size: 20
- * Height: 20 pixels (3 bytes per column)
+ * Height: 20 pixels (RLE encoded)
  */
 
 #include "fonts.h"
 
 static const uint8_t inter20_bitmap[] = {
     // ! (33) - 3px wide, offset 0
-    0xE0, 0xCF, 0x00, 0xF0, 0xCF, 0x00, 0x00, 0x00, 0x00, 
-    // " (34) - 5px wide, offset 9
-    0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 
-    0xE0, 0x00, 0x00, 
-    // # (35) - 10px wide, offset 24
-    0x00, 0x10, 0x00, 0x00, 0x91, 0x00, 0x80, 0xFF, 0x00, 0xE0, 0x1B, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0xFD, 0x00, 0xE0, 0x1F, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 
-    // $ (36) - 10px wide, offset 54
-    0x00, 0x00, 0x00, 0xC0, 0x61, 0x00, 0xE0, 0xE3, 0x00, 0x30, 0xC2, 0x00, 
-    0x30, 0xC6, 0x01, 0xF8, 0xFF, 0x01, 0x30, 0x84, 0x00, 0x60, 0xCC, 0x00, 
-    0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 
-    // % (37) - 13px wide, offset 84
-    0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x10, 0x81, 0x00, 0x10, 0xC1, 0x00, 
-    0xE0, 0x31, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 
-    0xC0, 0x70, 0x00, 0x60, 0x88, 0x00, 0x10, 0x88, 0x00, 0x00, 0xF8, 0x00, 
-    0x00, 0x20, 0x00, 
-    // & (38) - 10px wide, offset 123
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xE0, 0xCD, 0x00, 0x30, 0x87, 0x00, 
-    0x10, 0x86, 0x00, 0x30, 0x9B, 0x00, 0xE0, 0xF1, 0x00, 0x00, 0x60, 0x00, 
-    0x00, 0xF8, 0x00, 0x00, 0x80, 0x00, 
-    // ' (39) - 3px wide, offset 153
-    0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    // ( (40) - 4px wide, offset 162
-    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xF0, 0x80, 0x03, 0x10, 0x00, 0x02, 
-        // ) (41) - 5px wide, offset 174
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0xE0, 0xE3, 0x01, 0x80, 0x7F, 0x00, 
-    0x00, 0x00, 0x00, 
-    // * (42) - 8px wide, offset 189
-    0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x40, 0x01, 0x00, 0xE0, 0x07, 0x00, 
-    0xC0, 0x01, 0x00, 0x40, 0x01, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 
-        // + (43) - 8px wide, offset 213
-    0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 
-    0x00, 0x7F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 
-        // , (44) - 4px wide, offset 237
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 
-        // - (45) - 6px wide, offset 249
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 
-    // . (46) - 3px wide, offset 267
-    0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-    // / (47) - 6px wide, offset 276
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x3C, 0x00, 0xC0, 0x07, 0x00, 
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // 0 (48) - 10px wide, offset 294
-    0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0xE0, 0x70, 0x00, 0x20, 0xC0, 0x00, 
-    0x30, 0x80, 0x00, 0x30, 0x80, 0x00, 0x30, 0xC0, 0x00, 0xE0, 0x70, 0x00, 
-    0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-    // 1 (49) - 5px wide, offset 324
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 
-    0xF0, 0xFF, 0x00, 
-    // 2 (50) - 8px wide, offset 339
-    0xC0, 0xC0, 0x00, 0x60, 0xE0, 0x00, 0x30, 0xF0, 0x00, 0x30, 0x98, 0x00, 
-    0x30, 0x8C, 0x00, 0x20, 0x86, 0x00, 0xE0, 0x83, 0x00, 0x00, 0x80, 0x00, 
-        // 3 (51) - 9px wide, offset 363
-    0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x60, 0xE0, 0x00, 0x30, 0x80, 0x00, 
-    0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 0x30, 0xC6, 0x00, 0xE0, 0x7D, 0x00, 
-    0x00, 0x38, 0x00, 
-    // 4 (52) - 10px wide, offset 390
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x33, 0x00, 
-    0x80, 0x31, 0x00, 0x60, 0x30, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    // 5 (53) - 9px wide, offset 420
-    0x00, 0x00, 0x00, 0xC0, 0x63, 0x00, 0xF0, 0xE3, 0x00, 0x30, 0x82, 0x00, 
-    0x30, 0x83, 0x00, 0x30, 0x83, 0x00, 0x30, 0xC6, 0x00, 0x30, 0x7C, 0x00, 
-    0x00, 0x10, 0x00, 
-    // 6 (54) - 9px wide, offset 447
-    0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0xE0, 0x7E, 0x00, 0x20, 0xC2, 0x00, 
-    0x30, 0x83, 0x00, 0x30, 0x83, 0x00, 0x30, 0xC2, 0x00, 0x60, 0x7E, 0x00, 
-    0x40, 0x3C, 0x00, 
-    // 7 (55) - 9px wide, offset 474
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x30, 0x70, 0x00, 
-    0x30, 0x1C, 0x00, 0x30, 0x07, 0x00, 0xF0, 0x01, 0x00, 0x70, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 
-    // 8 (56) - 9px wide, offset 501
-    0x00, 0x00, 0x00, 0xC0, 0x78, 0x00, 0xE0, 0xCF, 0x00, 0x30, 0x86, 0x00, 
-    0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 0x20, 0xC6, 0x00, 0xE0, 0x7D, 0x00, 
-    0x00, 0x38, 0x00, 
-    // 9 (57) - 9px wide, offset 528
-    0x00, 0x00, 0x00, 0xC0, 0x23, 0x00, 0x60, 0xE6, 0x00, 0x30, 0x8C, 0x00, 
-    0x30, 0x88, 0x00, 0x30, 0x88, 0x00, 0x20, 0xC4, 0x00, 0xE0, 0x7F, 0x00, 
-    0x80, 0x1F, 0x00, 
-    // : (58) - 3px wide, offset 555
-    0x00, 0xC3, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 
-    // ; (59) - 4px wide, offset 564
-    0x00, 0x00, 0x00, 0x00, 0x82, 0x07, 0x00, 0xC3, 0x01, 0x00, 0x00, 0x00, 
-        // < (60) - 8px wide, offset 576
-    0x00, 0x08, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x36, 0x00, 
-    0x00, 0x22, 0x00, 0x00, 0x63, 0x00, 0x00, 0x41, 0x00, 0x00, 0x41, 0x00, 
-        // = (61) - 8px wide, offset 600
-    0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 
-    0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x32, 0x00, 0x00, 0x22, 0x00, 
-        // > (62) - 9px wide, offset 624
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x63, 0x00, 0x00, 0x22, 0x00, 
-    0x00, 0x36, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 
-    // ? (63) - 8px wide, offset 651
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x30, 0xDC, 0x00, 
-    0x30, 0xCE, 0x00, 0x30, 0x02, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 
-        // @ (64) - 15px wide, offset 675
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x80, 0xC3, 0x01, 0xC0, 0x00, 0x03, 
-    0x60, 0x18, 0x02, 0x20, 0x7E, 0x06, 0x20, 0xC3, 0x04, 0x20, 0xC1, 0x04, 
-    0x20, 0xC1, 0x04, 0x20, 0x66, 0x04, 0x20, 0x7F, 0x04, 0x40, 0x80, 0x00, 
-    0xC0, 0xC0, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x1C, 0x00, 
-    // A (65) - 11px wide, offset 720
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x80, 0x1F, 0x00, 
-    0xE0, 0x19, 0x00, 0x30, 0x18, 0x00, 0xE0, 0x19, 0x00, 0x00, 0x1F, 0x00, 
-    0x00, 0x7C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-    // B (66) - 9px wide, offset 753
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 
-    0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 0x60, 0xC7, 0x00, 0xC0, 0x79, 0x00, 
-    0x00, 0x30, 0x00, 
-    // C (67) - 11px wide, offset 780
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0xC0, 0x71, 0x00, 0x60, 0x40, 0x00, 
-    0x30, 0xC0, 0x00, 0x30, 0x80, 0x00, 0x30, 0x80, 0x00, 0x30, 0x80, 0x00, 
-    0x60, 0xC0, 0x00, 0xC0, 0x70, 0x00, 0x80, 0x10, 0x00, 
-    // D (68) - 10px wide, offset 813
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x80, 0x00, 0x30, 0x80, 0x00, 
-    0x30, 0x80, 0x00, 0x20, 0xC0, 0x00, 0x20, 0xC0, 0x00, 0x60, 0x60, 0x00, 
-    0xC0, 0x3F, 0x00, 0x00, 0x04, 0x00, 
-    // E (69) - 8px wide, offset 843
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 
-    0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 0x00, 0x80, 0x00, 
-        // F (70) - 8px wide, offset 867
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x04, 0x00, 0x30, 0x04, 0x00, 
-    0x30, 0x04, 0x00, 0x30, 0x04, 0x00, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 
-        // G (71) - 11px wide, offset 891
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0xC0, 0x71, 0x00, 0x60, 0x40, 0x00, 
-    0x30, 0xC0, 0x00, 0x30, 0x80, 0x00, 0x30, 0x80, 0x00, 0x30, 0x84, 0x00, 
-    0x60, 0xC4, 0x00, 0xC0, 0x7C, 0x00, 0x80, 0x3C, 0x00, 
-    // H (72) - 10px wide, offset 924
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 
-    0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 
-    0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    // I (73) - 2px wide, offset 954
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 
-    // J (74) - 8px wide, offset 960
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 
-    0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0xF0, 0x7F, 0x00, 0xE0, 0x3F, 0x00, 
-        // K (75) - 10px wide, offset 984
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 
-    0x80, 0x0F, 0x00, 0xC0, 0x18, 0x00, 0x60, 0x70, 0x00, 0x30, 0xC0, 0x00, 
-    0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    // L (76) - 8px wide, offset 1014
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
-        // M (77) - 12px wide, offset 1038
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x07, 0x00, 
-    0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 
-    0x00, 0x0F, 0x00, 0xE0, 0x01, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 
-        // N (78) - 10px wide, offset 1074
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x00, 
-    0x00, 0x07, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 
-    0xF0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 
-    // O (79) - 12px wide, offset 1104
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0xC0, 0x71, 0x00, 0x60, 0x40, 0x00, 
-    0x30, 0xC0, 0x00, 0x30, 0x80, 0x00, 0x30, 0x80, 0x00, 0x30, 0xC0, 0x00, 
-    0x60, 0xC0, 0x00, 0xC0, 0x70, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-        // P (80) - 9px wide, offset 1140
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 
-    0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 
-    // Q (81) - 12px wide, offset 1167
-    0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0xC0, 0x71, 0x00, 0x60, 0x40, 0x00, 
-    0x30, 0xC0, 0x00, 0x30, 0x80, 0x00, 0x30, 0xB0, 0x00, 0x30, 0xE0, 0x00, 
-    0x60, 0xC0, 0x00, 0xC0, 0xF0, 0x01, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-        // R (82) - 9px wide, offset 1203
-    0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x04, 0x00, 0x30, 0x04, 0x00, 
-    0x30, 0x0C, 0x00, 0x30, 0x1C, 0x00, 0x60, 0x76, 0x00, 0xC0, 0xC3, 0x00, 
-    0x00, 0x00, 0x00, 
-    // S (83) - 10px wide, offset 1230
-    0x00, 0x00, 0x00, 0xC0, 0x61, 0x00, 0xE0, 0xE3, 0x00, 0x30, 0xC2, 0x00, 
-    0x30, 0x86, 0x00, 0x30, 0x86, 0x00, 0x30, 0x84, 0x00, 0x60, 0xCC, 0x00, 
-    0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 
-    // T (84) - 10px wide, offset 1260
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 
-    0xF0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // U (85) - 10px wide, offset 1290
-    0xE0, 0x1F, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x00, 
-    0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 
-    0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-    // V (86) - 11px wide, offset 1320
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x1E, 0x00, 
-    0x00, 0xF0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 
-    0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // W (87) - 16px wide, offset 1353
-    0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xF8, 0x00, 
-    0x00, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0xC0, 0x07, 0x00, 0xF0, 0x00, 0x00, 
-    0xE0, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 
-    0x00, 0x7E, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-        // X (88) - 11px wide, offset 1401
-    0x00, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x60, 0x60, 0x00, 0xC0, 0x30, 0x00, 
-    0x00, 0x0F, 0x00, 0x00, 0x06, 0x00, 0x80, 0x1F, 0x00, 0xC0, 0x30, 0x00, 
-    0x60, 0xE0, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    // Y (89) - 11px wide, offset 1434
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x01, 0x00, 
-    0x00, 0x07, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x01, 0x00, 
-    0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // Z (90) - 10px wide, offset 1467
-    0x00, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xE0, 0x00, 0x30, 0x98, 0x00, 
-    0x30, 0x8C, 0x00, 0x30, 0x87, 0x00, 0xB0, 0x81, 0x00, 0xF0, 0x80, 0x00, 
-    0x30, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    // [ (91) - 4px wide, offset 1497
-    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x10, 0x00, 0x02, 0x10, 0x00, 0x02, 
-        // backslash (92) - 6px wide, offset 1509
-    0x10, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xF8, 0x00, 
-    0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 
-    // ] (93) - 4px wide, offset 1527
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x10, 0x00, 0x02, 0xF0, 0xFF, 0x03, 
-        // ^ (94) - 7px wide, offset 1539
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x01, 0x00, 0x20, 0x00, 0x00, 
-    0xE0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    // _ (95) - 8px wide, offset 1560
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-        // ` (96) - 3px wide, offset 1584
-    0x10, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    // a (97) - 8px wide, offset 1593
-    0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0xD9, 0x00, 0x80, 0x89, 0x00, 
-    0x80, 0x88, 0x00, 0x80, 0xC9, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 
-        // b (98) - 8px wide, offset 1617
-    0xF0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xC1, 0x00, 0x80, 0x81, 0x00, 
-    0x80, 0x81, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3C, 0x00, 
-        // c (99) - 9px wide, offset 1641
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xE3, 0x00, 0x80, 0x81, 0x00, 
-    0x80, 0x81, 0x00, 0x80, 0x81, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x63, 0x00, 
-    0x00, 0x00, 0x00, 
-    // d (100) - 9px wide, offset 1668
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xE3, 0x00, 0x80, 0x81, 0x00, 
-    0x80, 0x81, 0x00, 0x80, 0x81, 0x00, 0x00, 0x41, 0x00, 0xF0, 0xFF, 0x00, 
-    0x00, 0x00, 0x00, 
-    // e (101) - 9px wide, offset 1695
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xCB, 0x00, 0x80, 0x89, 0x00, 
-    0x80, 0x89, 0x00, 0x80, 0x89, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x4E, 0x00, 
-    0x00, 0x00, 0x00, 
-    // f (102) - 6px wide, offset 1722
-    0x80, 0x00, 0x00, 0x80, 0x01, 0x00, 0xE0, 0xFF, 0x00, 0xB0, 0x01, 0x00, 
-    0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    // g (103) - 9px wide, offset 1740
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0x00, 0x63, 0x06, 0x80, 0xC1, 0x04, 
-    0x80, 0x81, 0x04, 0x80, 0x81, 0x04, 0x00, 0x41, 0x04, 0x80, 0xFF, 0x07, 
-    0x00, 0x00, 0x00, 
-    // h (104) - 8px wide, offset 1767
-    0xF0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 
-    0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-        // i (105) - 3px wide, offset 1791
-    0x00, 0x00, 0x00, 0xB0, 0xFF, 0x00, 0x30, 0xFF, 0x00, 
-    // j (106) - 4px wide, offset 1800
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB0, 0xFF, 0x07, 0x30, 0xFF, 0x01, 
-        // k (107) - 8px wide, offset 1812
-    0xF0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1E, 0x00, 
-    0x00, 0x33, 0x00, 0x80, 0xC1, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 
-        // l (108) - 2px wide, offset 1836
-    0xF0, 0xFF, 0x00, 0xE0, 0xFF, 0x00, 
-    // m (109) - 12px wide, offset 1842
-    0x80, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 
-    0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 
-    0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 
-        // n (110) - 8px wide, offset 1878
-    0x80, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 
-    0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-        // o (111) - 9px wide, offset 1902
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xE3, 0x00, 0x80, 0x81, 0x00, 
-    0x80, 0x81, 0x00, 0x80, 0x81, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x7F, 0x00, 
-    0x00, 0x1C, 0x00, 
-    // p (112) - 8px wide, offset 1929
-    0x80, 0xFF, 0x07, 0x00, 0xFF, 0x07, 0x00, 0xC1, 0x00, 0x80, 0x81, 0x00, 
-    0x80, 0x81, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3C, 0x00, 
-        // q (113) - 9px wide, offset 1953
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xE3, 0x00, 0x80, 0x81, 0x00, 
-    0x80, 0x81, 0x00, 0x80, 0x81, 0x00, 0x00, 0x41, 0x00, 0x80, 0xFF, 0x07, 
-    0x00, 0x00, 0x00, 
-    // r (114) - 5px wide, offset 1980
-    0x80, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 
-    // s (115) - 8px wide, offset 1995
-    0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0xCF, 0x00, 0x80, 0x89, 0x00, 
-    0x80, 0x88, 0x00, 0x80, 0x99, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 
-        // t (116) - 5px wide, offset 2019
-    0x80, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xE0, 0xFF, 0x00, 0x80, 0x81, 0x00, 
-    0x00, 0x80, 0x00, 
-    // u (117) - 8px wide, offset 2034
-    0x80, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 
-    0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-        // v (118) - 9px wide, offset 2058
-    0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 
-    0x00, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 
-    // w (119) - 13px wide, offset 2085
-    0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xE0, 0x00, 
-    0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x03, 0x00, 0x00, 0x1E, 0x00, 
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 
-    // x (120) - 9px wide, offset 2124
-    0x00, 0x00, 0x00, 0x80, 0xC1, 0x00, 0x00, 0x63, 0x00, 0x00, 0x3E, 0x00, 
-    0x00, 0x1C, 0x00, 0x00, 0x36, 0x00, 0x00, 0xC3, 0x00, 0x80, 0x80, 0x00, 
-    0x00, 0x00, 0x00, 
-    // y (121) - 9px wide, offset 2151
-    0x00, 0x00, 0x00, 0x80, 0x03, 0x04, 0x00, 0x1E, 0x04, 0x00, 0xF0, 0x06, 
-    0x00, 0xC0, 0x03, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 
-    // z (122) - 8px wide, offset 2178
-    0x00, 0x00, 0x00, 0x80, 0xC1, 0x00, 0x80, 0xE1, 0x00, 0x80, 0xB1, 0x00, 
-    0x80, 0x8D, 0x00, 0x80, 0x87, 0x00, 0x80, 0x83, 0x00, 0x00, 0x80, 0x00, 
-        // { (123) - 5px wide, offset 2202
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0xF3, 0x01, 0x10, 0x00, 0x02, 
-    0x10, 0x00, 0x02, 
-    // | (124) - 2px wide, offset 2217
-    0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 
-    // } (125) - 6px wide, offset 2223
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x30, 0x00, 0x03, 0xE0, 0xFF, 0x01, 
-    0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 
-    // ~ (126) - 9px wide, offset 2241
-    0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 
-    0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 
-    0x00, 0x00, 0x00, 
+    0x2F, 0x12, 0x47, 0x01, 0x12, 0x00, 
+    // " (34) - 5px wide, offset 6
+    0xC5, 0xF8, 0x24, 0x8B, 0x00, 
+    // # (35) - 10px wide, offset 11
+    0x61, 0x79, 0x19, 0x11, 0x5F, 0x02, 0x4D, 0x0A, 0x79, 0x19, 0x79, 0x19, 
+    0x79, 0x0E, 0x4F, 0x01, 0x79, 0x19, 0x79, 0x00, 
+    // $ (36) - 10px wide, offset 31
+    0xD3, 0x22, 0x55, 0x1B, 0x42, 0x19, 0x22, 0x42, 0x1A, 0x1B, 0x37, 0x07, 
+    0x3A, 0x21, 0x21, 0x4A, 0x1A, 0x12, 0x51, 0x24, 0x00, 
+    // % (37) - 13px wide, offset 52
+    0xCC, 0x79, 0x19, 0x31, 0x41, 0x19, 0x2A, 0x4C, 0x1A, 0x8A, 0x82, 0x8A, 
+    0x82, 0x23, 0x52, 0x21, 0x19, 0x41, 0x31, 0x19, 0x7D, 0x89, 0x00, 
+    // & (38) - 10px wide, offset 75
+    0xFC, 0x54, 0x0A, 0x12, 0x42, 0x13, 0x21, 0x41, 0x22, 0x21, 0x42, 0x12, 
+    0x0A, 0x11, 0x4C, 0x1C, 0x8A, 0x85, 0x99, 0x00, 
+    // ' (39) - 3px wide, offset 95
+    0xC5, 0x00, 
+    // ( (40) - 4px wide, offset 97
+    0xD7, 0x03, 0x44, 0x3B, 0x31, 0x61, 0x00, 
+    // ) (41) - 5px wide, offset 104
+    0xC2, 0x52, 0x3D, 0x1C, 0x57, 0x01, 0x00, 
+    // * (42) - 8px wide, offset 111
+    0xD1, 0x0A, 0x81, 0x09, 0x86, 0x7B, 0x89, 0x09, 0x89, 0x09, 0x00, 
+    // + (43) - 8px wide, offset 122
+    0x59, 0x99, 0x99, 0x92, 0x87, 0x81, 0x99, 0x99, 0x00, 
+    // , (44) - 4px wide, offset 131
+    0xF8, 0x24, 0x7B, 0x00, 
+    // - (45) - 6px wide, offset 135
+    0x52, 0x92, 0x92, 0x92, 0x92, 0x00, 
+    // . (46) - 3px wide, offset 141
+    0x72, 0x92, 0x00, 
+    // / (47) - 6px wide, offset 144
+    0xF8, 0x15, 0x64, 0x65, 0x6B, 0x00, 
+    // 0 (48) - 10px wide, offset 150
+    0xDF, 0x5B, 0x23, 0x51, 0x42, 0x42, 0x49, 0x42, 0x49, 0x42, 0x42, 0x4B, 
+    0x23, 0x67, 0x00, 
+    // 1 (49) - 5px wide, offset 165
+    0xD1, 0x91, 0x92, 0x97, 0x05, 0x00, 
+    // 2 (50) - 8px wide, offset 171
+    0x32, 0x32, 0x4A, 0x33, 0x42, 0x34, 0x42, 0x2A, 0x11, 0x42, 0x22, 0x19, 
+    0x49, 0x1A, 0x21, 0x4D, 0x29, 0x99, 0x00, 
+    // 3 (51) - 9px wide, offset 190
+    0xD1, 0x32, 0x52, 0x33, 0x42, 0x49, 0x42, 0x1A, 0x21, 0x42, 0x1A, 0x21, 
+    0x42, 0x1A, 0x1A, 0x4C, 0x0D, 0x83, 0x00, 
+    // 4 (52) - 10px wide, offset 209
+    0xFB, 0x84, 0x72, 0x12, 0x6A, 0x1A, 0x5A, 0x2A, 0x57, 0x05, 0x47, 0x05, 
+    0x82, 0x00, 
+    // 5 (53) - 9px wide, offset 223
+    0xD4, 0x1A, 0x4E, 0x1B, 0x42, 0x19, 0x29, 0x42, 0x12, 0x29, 0x42, 0x12, 
+    0x29, 0x42, 0x1A, 0x1A, 0x42, 0x25, 0x89, 0x00, 
+    // 6 (54) - 9px wide, offset 243
+    0xDF, 0x5B, 0x0E, 0x51, 0x19, 0x22, 0x42, 0x12, 0x29, 0x42, 0x12, 0x29, 
+    0x42, 0x19, 0x22, 0x4A, 0x16, 0x59, 0x1C, 0x00, 
+    // 7 (55) - 9px wide, offset 263
+    0xC2, 0x92, 0x42, 0x42, 0x33, 0x4A, 0x23, 0x5A, 0x13, 0x6D, 0x7B, 0x00, 
+        // 8 (56) - 9px wide, offset 275
+    0xD2, 0x1C, 0x57, 0x12, 0x42, 0x1A, 0x21, 0x42, 0x1A, 0x21, 0x42, 0x1A, 
+    0x21, 0x49, 0x1A, 0x1A, 0x4C, 0x0D, 0x83, 0x00, 
+    // 9 (57) - 9px wide, offset 295
+    0xD4, 0x19, 0x5A, 0x12, 0x13, 0x42, 0x22, 0x19, 0x42, 0x29, 0x19, 0x42, 
+    0x29, 0x19, 0x49, 0x21, 0x1A, 0x4F, 0x03, 0x66, 0x00, 
+    // : (58) - 3px wide, offset 316
+    0x42, 0x22, 0x62, 0x22, 0x00, 
+    // ; (59) - 4px wide, offset 321
+    0xE9, 0x2C, 0x4A, 0x23, 0x00, 
+    // < (60) - 8px wide, offset 326
+    0x59, 0x93, 0x8B, 0x82, 0x0A, 0x79, 0x19, 0x72, 0x1A, 0x69, 0x29, 0x69, 
+    0x29, 0x00, 
+    // = (61) - 8px wide, offset 340
+    0xE9, 0x12, 0x79, 0x12, 0x79, 0x12, 0x79, 0x12, 0x79, 0x12, 0x79, 0x12, 
+    0x79, 0x19, 0x00, 
+    // > (62) - 9px wide, offset 355
+    0xE1, 0x29, 0x6A, 0x1A, 0x71, 0x19, 0x7A, 0x0A, 0x81, 0x09, 0x8B, 0x91, 
+    0x00, 
+    // ? (63) - 8px wide, offset 368
+    0xCA, 0x91, 0x92, 0x23, 0x0A, 0x42, 0x1B, 0x12, 0x42, 0x19, 0x7C, 0x00, 
+        // @ (64) - 15px wide, offset 380
+    0xEE, 0x63, 0x23, 0x4A, 0x42, 0x3A, 0x22, 0x21, 0x39, 0x1E, 0x12, 0x31, 
+    0x12, 0x22, 0x11, 0x31, 0x11, 0x2A, 0x11, 0x31, 0x11, 0x2A, 0x11, 0x31, 
+    0x1A, 0x12, 0x19, 0x31, 0x17, 0x19, 0x39, 0x41, 0x52, 0x32, 0x5F, 0x01, 
+    0x7B, 0x00, 
+    // A (65) - 11px wide, offset 418
+    0xF8, 0x13, 0x74, 0x6E, 0x64, 0x12, 0x5A, 0x2A, 0x64, 0x12, 0x7D, 0x8D, 
+    0x93, 0x00, 
+    // B (66) - 9px wide, offset 432
+    0x2F, 0x04, 0x47, 0x05, 0x42, 0x1A, 0x21, 0x42, 0x1A, 0x21, 0x42, 0x1A, 
+    0x21, 0x42, 0x1A, 0x21, 0x4A, 0x0B, 0x1A, 0x53, 0x14, 0x8A, 0x00, 
+    // C (67) - 11px wide, offset 455
+    0xDE, 0x6B, 0x1B, 0x52, 0x39, 0x4A, 0x42, 0x42, 0x49, 0x42, 0x49, 0x42, 
+    0x49, 0x4A, 0x3A, 0x52, 0x23, 0x61, 0x21, 0x00, 
+    // D (68) - 10px wide, offset 475
+    0x2F, 0x04, 0x47, 0x05, 0x42, 0x49, 0x42, 0x49, 0x42, 0x49, 0x49, 0x42, 
+    0x49, 0x42, 0x4A, 0x32, 0x5F, 0x01, 0x81, 0x00, 
+    // E (69) - 8px wide, offset 495
+    0x2F, 0x04, 0x47, 0x05, 0x42, 0x1A, 0x21, 0x42, 0x1A, 0x21, 0x42, 0x1A, 
+    0x21, 0x42, 0x1A, 0x21, 0x42, 0x1A, 0x21, 0x99, 0x00, 
+    // F (70) - 8px wide, offset 516
+    0x2F, 0x04, 0x47, 0x05, 0x42, 0x21, 0x6A, 0x21, 0x6A, 0x21, 0x6A, 0x21, 
+    0x6A, 0x21, 0x00, 
+    // G (71) - 11px wide, offset 531
+    0xDE, 0x6B, 0x1B, 0x52, 0x39, 0x4A, 0x42, 0x42, 0x49, 0x42, 0x49, 0x42, 
+    0x21, 0x21, 0x4A, 0x19, 0x1A, 0x52, 0x15, 0x61, 0x14, 0x00, 
+    // H (72) - 10px wide, offset 553
+    0x2F, 0x04, 0x47, 0x05, 0x6A, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6F, 0x05, 
+    0x00, 
+    // I (73) - 2px wide, offset 566
+    0x2F, 0x04, 0x47, 0x05, 0x00, 
+    // J (74) - 8px wide, offset 571
+    0xF8, 0x0B, 0x9A, 0x99, 0x99, 0x92, 0x47, 0x04, 0x57, 0x02, 0x00, 
+    // K (75) - 10px wide, offset 582
+    0x2F, 0x04, 0x47, 0x05, 0x71, 0x8B, 0x85, 0x72, 0x1A, 0x62, 0x2B, 0x4A, 
+    0x42, 0x41, 0x51, 0x00, 
+    // L (76) - 8px wide, offset 598
+    0x2F, 0x04, 0x47, 0x05, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 
+    // M (77) - 12px wide, offset 608
+    0x2F, 0x04, 0x47, 0x05, 0x4B, 0x9C, 0x9B, 0x9C, 0x8B, 0x7B, 0x74, 0x6C, 
+    0x7F, 0x05, 0x47, 0x05, 0x00, 
+    // N (78) - 10px wide, offset 625
+    0x2F, 0x04, 0x47, 0x05, 0x4B, 0x9A, 0x9B, 0x9A, 0x9B, 0x9B, 0x47, 0x05, 
+    0x4F, 0x04, 0x00, 
+    // O (79) - 12px wide, offset 640
+    0xDE, 0x6B, 0x1B, 0x52, 0x39, 0x4A, 0x42, 0x42, 0x49, 0x42, 0x49, 0x42, 
+    0x42, 0x4A, 0x3A, 0x52, 0x23, 0x67, 0x00, 
+    // P (80) - 9px wide, offset 659
+    0x2F, 0x04, 0x47, 0x05, 0x42, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 
+    0x6A, 0x12, 0x7C, 0x00, 
+    // Q (81) - 12px wide, offset 675
+    0xDE, 0x6B, 0x1B, 0x52, 0x39, 0x4A, 0x42, 0x42, 0x49, 0x42, 0x32, 0x09, 
+    0x42, 0x3B, 0x4A, 0x3A, 0x52, 0x25, 0x57, 0x00, 
+    // R (82) - 9px wide, offset 695
+    0x2F, 0x04, 0x47, 0x05, 0x42, 0x21, 0x6A, 0x21, 0x6A, 0x22, 0x62, 0x23, 
+    0x62, 0x12, 0x0B, 0x5C, 0x22, 0x00, 
+    // S (83) - 10px wide, offset 713
+    0xD3, 0x22, 0x55, 0x1B, 0x42, 0x19, 0x22, 0x42, 0x1A, 0x21, 0x42, 0x1A, 
+    0x21, 0x42, 0x21, 0x21, 0x4A, 0x1A, 0x12, 0x51, 0x24, 0x00, 
+    // T (84) - 10px wide, offset 735
+    0xC2, 0x92, 0x92, 0x97, 0x05, 0x47, 0x05, 0x42, 0x92, 0x92, 0x00, 
+    // U (85) - 10px wide, offset 746
+    0x2F, 0x01, 0x5F, 0x04, 0x9A, 0x99, 0x99, 0x99, 0x92, 0x92, 0x47, 0x04, 
+    0x00, 
+    // V (86) - 11px wide, offset 759
+    0xC3, 0x9C, 0x9C, 0x9C, 0x92, 0x84, 0x6C, 0x6C, 0x73, 0x00, 
+    // W (87) - 16px wide, offset 769
+    0xC5, 0x95, 0x9D, 0x8B, 0x75, 0x5D, 0x6C, 0x8C, 0x9D, 0x95, 0x8B, 0x6E, 
+    0x56, 0x6B, 0x00, 
+    // X (88) - 11px wide, offset 784
+    0xC2, 0x42, 0x4A, 0x32, 0x5A, 0x22, 0x74, 0x8A, 0x86, 0x6A, 0x22, 0x5A, 
+    0x33, 0x41, 0x51, 0x00, 
+    // Y (89) - 11px wide, offset 800
+    0xC2, 0x9B, 0x9A, 0x9B, 0x97, 0x63, 0x7B, 0x82, 0x8A, 0x00, 
+    // Z (90) - 10px wide, offset 810
+    0xC2, 0x42, 0x42, 0x3B, 0x42, 0x2A, 0x11, 0x42, 0x22, 0x19, 0x42, 0x13, 
+    0x21, 0x42, 0x0A, 0x31, 0x44, 0x39, 0x42, 0x49, 0x00, 
+    // [ (91) - 4px wide, offset 831
+    0xC7, 0x07, 0x31, 0x61, 0x31, 0x61, 0x00, 
+    // backslash (92) - 6px wide, offset 838
+    0x21, 0x9C, 0x9D, 0x9D, 0x9B, 0x00, 
+    // ] (93) - 4px wide, offset 844
+    0xC1, 0x61, 0x31, 0x61, 0x37, 0x07, 0x00, 
+    // ^ (94) - 7px wide, offset 851
+    0xE2, 0x83, 0x81, 0x9B, 0x9A, 0x00, 
+    // _ (95) - 8px wide, offset 857
+    0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 
+    // ` (96) - 3px wide, offset 865
+    0x21, 0x9A, 0x00, 
+    // a (97) - 8px wide, offset 868
+    0xE2, 0x13, 0x69, 0x12, 0x0A, 0x5A, 0x11, 0x19, 0x59, 0x19, 0x19, 0x5A, 
+    0x11, 0x12, 0x67, 0x01, 0x6F, 0x00, 
+    // b (98) - 8px wide, offset 886
+    0x27, 0x05, 0x4F, 0x04, 0x61, 0x2A, 0x5A, 0x31, 0x5A, 0x31, 0x5A, 0x2A, 
+    0x67, 0x7C, 0x00, 
+    // c (99) - 9px wide, offset 901
+    0xED, 0x72, 0x1B, 0x5A, 0x31, 0x5A, 0x31, 0x5A, 0x31, 0x61, 0x2A, 0x62, 
+    0x1A, 0x00, 
+    // d (100) - 9px wide, offset 915
+    0xEE, 0x6A, 0x1B, 0x5A, 0x31, 0x5A, 0x31, 0x5A, 0x31, 0x61, 0x29, 0x4F, 
+    0x05, 0x00, 
+    // e (101) - 9px wide, offset 929
+    0xED, 0x72, 0x09, 0x12, 0x5A, 0x11, 0x19, 0x5A, 0x11, 0x19, 0x5A, 0x11, 
+    0x19, 0x61, 0x11, 0x12, 0x6B, 0x11, 0x00, 
+    // f (102) - 6px wide, offset 948
+    0x39, 0x9A, 0x87, 0x04, 0x42, 0x0A, 0x79, 0x12, 0x00, 
+    // g (103) - 9px wide, offset 957
+    0xED, 0x19, 0x52, 0x1A, 0x12, 0x42, 0x2A, 0x11, 0x42, 0x31, 0x11, 0x42, 
+    0x31, 0x11, 0x49, 0x29, 0x19, 0x47, 0x05, 0x00, 
+    // h (104) - 8px wide, offset 977
+    0x27, 0x05, 0x4F, 0x04, 0x61, 0x92, 0x92, 0x9A, 0x97, 0x01, 0x00, 
+    // i (105) - 3px wide, offset 988
+    0xC2, 0x0F, 0x02, 0x42, 0x17, 0x01, 0x00, 
+    // j (106) - 4px wide, offset 995
+    0xF8, 0x39, 0x2A, 0x0F, 0x05, 0x2A, 0x17, 0x02, 0x00, 
+    // k (107) - 8px wide, offset 1004
+    0x27, 0x05, 0x4F, 0x04, 0x72, 0x8C, 0x7A, 0x12, 0x6A, 0x2A, 0x59, 0x39, 
+    0x00, 
+    // l (108) - 2px wide, offset 1017
+    0x27, 0x05, 0x4F, 0x04, 0x00, 
+    // m (109) - 12px wide, offset 1022
+    0x3F, 0x02, 0x67, 0x01, 0x61, 0x92, 0x92, 0x9F, 0x01, 0x67, 0x01, 0x61, 
+    0x92, 0x92, 0x9F, 0x01, 0x6F, 0x00, 
+    // n (110) - 8px wide, offset 1040
+    0x3F, 0x02, 0x67, 0x01, 0x61, 0x92, 0x92, 0x9A, 0x97, 0x01, 0x00, 
+    // o (111) - 9px wide, offset 1051
+    0xED, 0x72, 0x1B, 0x5A, 0x31, 0x5A, 0x31, 0x5A, 0x31, 0x61, 0x2A, 0x67, 
+    0x7B, 0x00, 
+    // p (112) - 8px wide, offset 1065
+    0x3F, 0x05, 0x4F, 0x04, 0x49, 0x2A, 0x5A, 0x31, 0x5A, 0x31, 0x5A, 0x2A, 
+    0x67, 0x7C, 0x00, 
+    // q (113) - 9px wide, offset 1080
+    0xEE, 0x6A, 0x1B, 0x5A, 0x31, 0x5A, 0x31, 0x5A, 0x31, 0x61, 0x29, 0x67, 
+    0x05, 0x00, 
+    // r (114) - 5px wide, offset 1094
+    0x3F, 0x02, 0x67, 0x01, 0x61, 0x92, 0x00, 
+    // s (115) - 8px wide, offset 1101
+    0xE3, 0x19, 0x6C, 0x12, 0x5A, 0x11, 0x19, 0x59, 0x19, 0x19, 0x5A, 0x12, 
+    0x11, 0x62, 0x13, 0x00, 
+    // t (116) - 5px wide, offset 1117
+    0x39, 0x97, 0x01, 0x5F, 0x04, 0x5A, 0x31, 0x99, 0x00, 
+    // u (117) - 8px wide, offset 1126
+    0x3F, 0x77, 0x01, 0x99, 0x99, 0x99, 0x91, 0x67, 0x02, 0x00, 
+    // v (118) - 9px wide, offset 1136
+    0xDB, 0x9C, 0x9C, 0x92, 0x7C, 0x73, 0x7B, 0x00, 
+    // w (119) - 13px wide, offset 1144
+    0xDC, 0x95, 0x9B, 0x84, 0x65, 0x73, 0x9C, 0x9C, 0x84, 0x6D, 0x6B, 0x00, 
+        // x (120) - 9px wide, offset 1156
+    0xDA, 0x2A, 0x62, 0x1A, 0x75, 0x83, 0x82, 0x0A, 0x72, 0x22, 0x59, 0x39, 
+    0x00, 
+    // y (121) - 9px wide, offset 1169
+    0xDB, 0x41, 0x54, 0x29, 0x6C, 0x0A, 0x7C, 0x6C, 0x73, 0x7B, 0x00, 
+    // z (122) - 8px wide, offset 1180
+    0xDA, 0x2A, 0x5A, 0x23, 0x5A, 0x1A, 0x09, 0x5A, 0x0A, 0x19, 0x5C, 0x21, 
+    0x5B, 0x29, 0x99, 0x00, 
+    // { (123) - 5px wide, offset 1196
+    0x52, 0x92, 0x66, 0x15, 0x39, 0x61, 0x31, 0x61, 0x00, 
+    // | (124) - 2px wide, offset 1205
+    0x0F, 0x07, 0x05, 0x00, 
+    // } (125) - 6px wide, offset 1209
+    0xC1, 0x61, 0x32, 0x52, 0x3F, 0x05, 0x6A, 0x92, 0x00, 
+    // ~ (126) - 9px wide, offset 1218
+    0x59, 0x92, 0x91, 0x9A, 0x99, 0x9A, 0x92, 0x8A, 0x00, 
 };
 
 static const font_glyph_t inter20_glyphs[] = {
     {0, 0, 20, 0, 16, 4},  // Space (32)
     {0, 3, 20, 1, 4, 4},  // ! (33)
-    {9, 5, 20, 1, 4, 7},  // " (34)
-    {24, 10, 20, 0, 4, 10},  // # (35)
-    {54, 10, 20, 0, 2, 10},  // $ (36)
-    {84, 13, 20, 1, 4, 15},  // % (37)
-    {123, 10, 20, 0, 4, 10},  // & (38)
-    {153, 3, 20, 1, 4, 5},  // ' (39)
-    {162, 4, 20, 1, 3, 6},  // ( (40)
-    {174, 5, 20, 0, 3, 6},  // ) (41)
-    {189, 8, 20, 0, 4, 8},  // * (42)
-    {213, 8, 20, 1, 7, 10},  // + (43)
-    {237, 4, 20, 0, 14, 4},  // , (44)
-    {249, 6, 20, 1, 10, 7},  // - (45)
-    {267, 3, 20, 1, 14, 4},  // . (46)
-    {276, 6, 20, 0, 3, 6},  // / (47)
-    {294, 10, 20, 0, 4, 10},  // 0 (48)
-    {324, 5, 20, 0, 4, 6},  // 1 (49)
-    {339, 8, 20, 1, 4, 10},  // 2 (50)
-    {363, 9, 20, 0, 4, 10},  // 3 (51)
-    {390, 10, 20, 0, 4, 10},  // 4 (52)
-    {420, 9, 20, 0, 4, 9},  // 5 (53)
-    {447, 9, 20, 0, 4, 10},  // 6 (54)
-    {474, 9, 20, 0, 4, 9},  // 7 (55)
-    {501, 9, 20, 0, 4, 10},  // 8 (56)
-    {528, 9, 20, 0, 4, 10},  // 9 (57)
-    {555, 3, 20, 1, 8, 4},  // : (58)
-    {564, 4, 20, 0, 8, 5},  // ; (59)
-    {576, 8, 20, 1, 7, 10},  // < (60)
-    {600, 8, 20, 1, 9, 10},  // = (61)
-    {624, 9, 20, 1, 7, 10},  // > (62)
-    {651, 8, 20, 0, 4, 8},  // ? (63)
-    {675, 15, 20, 0, 4, 15},  // @ (64)
-    {720, 11, 20, 0, 4, 11},  // A (65)
-    {753, 9, 20, 1, 4, 10},  // B (66)
-    {780, 11, 20, 0, 4, 12},  // C (67)
-    {813, 10, 20, 1, 4, 11},  // D (68)
-    {843, 8, 20, 1, 4, 10},  // E (69)
-    {867, 8, 20, 1, 4, 9},  // F (70)
-    {891, 11, 20, 0, 4, 12},  // G (71)
-    {924, 10, 20, 1, 4, 12},  // H (72)
-    {954, 2, 20, 1, 4, 4},  // I (73)
-    {960, 8, 20, 0, 4, 9},  // J (74)
-    {984, 10, 20, 1, 4, 11},  // K (75)
-    {1014, 8, 20, 1, 4, 9},  // L (76)
-    {1038, 12, 20, 1, 4, 14},  // M (77)
-    {1074, 10, 20, 1, 4, 12},  // N (78)
-    {1104, 12, 20, 0, 4, 12},  // O (79)
-    {1140, 9, 20, 1, 4, 10},  // P (80)
-    {1167, 12, 20, 0, 4, 12},  // Q (81)
-    {1203, 9, 20, 1, 4, 10},  // R (82)
-    {1230, 10, 20, 0, 4, 10},  // S (83)
-    {1260, 10, 20, 0, 4, 10},  // T (84)
-    {1290, 10, 20, 1, 4, 12},  // U (85)
-    {1320, 11, 20, 0, 4, 11},  // V (86)
-    {1353, 16, 20, 0, 4, 16},  // W (87)
-    {1401, 11, 20, 0, 4, 11},  // X (88)
-    {1434, 11, 20, 0, 4, 11},  // Y (89)
-    {1467, 10, 20, 0, 4, 10},  // Z (90)
-    {1497, 4, 20, 1, 3, 6},  // [ (91)
-    {1509, 6, 20, 0, 3, 6},  // backslash (92)
-    {1527, 4, 20, 0, 3, 6},  // ] (93)
-    {1539, 7, 20, 0, 4, 7},  // ^ (94)
-    {1560, 8, 20, 0, 16, 7},  // _ (95)
-    {1584, 3, 20, 1, 3, 5},  // ` (96)
-    {1593, 8, 20, 0, 7, 9},  // a (97)
-    {1617, 8, 20, 1, 4, 10},  // b (98)
-    {1641, 9, 20, 0, 7, 9},  // c (99)
-    {1668, 9, 20, 0, 4, 10},  // d (100)
-    {1695, 9, 20, 0, 7, 9},  // e (101)
-    {1722, 6, 20, 0, 3, 6},  // f (102)
-    {1740, 9, 20, 0, 7, 10},  // g (103)
-    {1767, 8, 20, 1, 4, 9},  // h (104)
-    {1791, 3, 20, 0, 4, 4},  // i (105)
-    {1800, 4, 20, -1, 4, 4},  // j (106)
-    {1812, 8, 20, 1, 4, 9},  // k (107)
-    {1836, 2, 20, 1, 4, 4},  // l (108)
-    {1842, 12, 20, 1, 7, 14},  // m (109)
-    {1878, 8, 20, 1, 7, 9},  // n (110)
-    {1902, 9, 20, 0, 7, 9},  // o (111)
-    {1929, 8, 20, 1, 7, 10},  // p (112)
-    {1953, 9, 20, 0, 7, 10},  // q (113)
-    {1980, 5, 20, 1, 7, 6},  // r (114)
-    {1995, 8, 20, 0, 7, 8},  // s (115)
-    {2019, 5, 20, 0, 5, 5},  // t (116)
-    {2034, 8, 20, 1, 7, 9},  // u (117)
-    {2058, 9, 20, 0, 7, 9},  // v (118)
-    {2085, 13, 20, 0, 7, 13},  // w (119)
-    {2124, 9, 20, 0, 7, 9},  // x (120)
-    {2151, 9, 20, 0, 7, 9},  // y (121)
-    {2178, 8, 20, 0, 7, 9},  // z (122)
-    {2202, 5, 20, 1, 3, 7},  // { (123)
-    {2217, 2, 20, 2, 0, 5},  // | (124)
-    {2223, 6, 20, 0, 3, 7},  // } (125)
-    {2241, 9, 20, 1, 9, 10},  // ~ (126)
+    {6, 5, 20, 1, 4, 7},  // " (34)
+    {11, 10, 20, 0, 4, 10},  // # (35)
+    {31, 10, 20, 0, 2, 10},  // $ (36)
+    {52, 13, 20, 1, 4, 15},  // % (37)
+    {75, 10, 20, 0, 4, 10},  // & (38)
+    {95, 3, 20, 1, 4, 5},  // ' (39)
+    {97, 4, 20, 1, 3, 6},  // ( (40)
+    {104, 5, 20, 0, 3, 6},  // ) (41)
+    {111, 8, 20, 0, 4, 8},  // * (42)
+    {122, 8, 20, 1, 7, 10},  // + (43)
+    {131, 4, 20, 0, 14, 4},  // , (44)
+    {135, 6, 20, 1, 10, 7},  // - (45)
+    {141, 3, 20, 1, 14, 4},  // . (46)
+    {144, 6, 20, 0, 3, 6},  // / (47)
+    {150, 10, 20, 0, 4, 10},  // 0 (48)
+    {165, 5, 20, 0, 4, 6},  // 1 (49)
+    {171, 8, 20, 1, 4, 10},  // 2 (50)
+    {190, 9, 20, 0, 4, 10},  // 3 (51)
+    {209, 10, 20, 0, 4, 10},  // 4 (52)
+    {223, 9, 20, 0, 4, 9},  // 5 (53)
+    {243, 9, 20, 0, 4, 10},  // 6 (54)
+    {263, 9, 20, 0, 4, 9},  // 7 (55)
+    {275, 9, 20, 0, 4, 10},  // 8 (56)
+    {295, 9, 20, 0, 4, 10},  // 9 (57)
+    {316, 3, 20, 1, 8, 4},  // : (58)
+    {321, 4, 20, 0, 8, 5},  // ; (59)
+    {326, 8, 20, 1, 7, 10},  // < (60)
+    {340, 8, 20, 1, 9, 10},  // = (61)
+    {355, 9, 20, 1, 7, 10},  // > (62)
+    {368, 8, 20, 0, 4, 8},  // ? (63)
+    {380, 15, 20, 0, 4, 15},  // @ (64)
+    {418, 11, 20, 0, 4, 11},  // A (65)
+    {432, 9, 20, 1, 4, 10},  // B (66)
+    {455, 11, 20, 0, 4, 12},  // C (67)
+    {475, 10, 20, 1, 4, 11},  // D (68)
+    {495, 8, 20, 1, 4, 10},  // E (69)
+    {516, 8, 20, 1, 4, 9},  // F (70)
+    {531, 11, 20, 0, 4, 12},  // G (71)
+    {553, 10, 20, 1, 4, 12},  // H (72)
+    {566, 2, 20, 1, 4, 4},  // I (73)
+    {571, 8, 20, 0, 4, 9},  // J (74)
+    {582, 10, 20, 1, 4, 11},  // K (75)
+    {598, 8, 20, 1, 4, 9},  // L (76)
+    {608, 12, 20, 1, 4, 14},  // M (77)
+    {625, 10, 20, 1, 4, 12},  // N (78)
+    {640, 12, 20, 0, 4, 12},  // O (79)
+    {659, 9, 20, 1, 4, 10},  // P (80)
+    {675, 12, 20, 0, 4, 12},  // Q (81)
+    {695, 9, 20, 1, 4, 10},  // R (82)
+    {713, 10, 20, 0, 4, 10},  // S (83)
+    {735, 10, 20, 0, 4, 10},  // T (84)
+    {746, 10, 20, 1, 4, 12},  // U (85)
+    {759, 11, 20, 0, 4, 11},  // V (86)
+    {769, 16, 20, 0, 4, 16},  // W (87)
+    {784, 11, 20, 0, 4, 11},  // X (88)
+    {800, 11, 20, 0, 4, 11},  // Y (89)
+    {810, 10, 20, 0, 4, 10},  // Z (90)
+    {831, 4, 20, 1, 3, 6},  // [ (91)
+    {838, 6, 20, 0, 3, 6},  // backslash (92)
+    {844, 4, 20, 0, 3, 6},  // ] (93)
+    {851, 7, 20, 0, 4, 7},  // ^ (94)
+    {857, 8, 20, 0, 16, 7},  // _ (95)
+    {865, 3, 20, 1, 3, 5},  // ` (96)
+    {868, 8, 20, 0, 7, 9},  // a (97)
+    {886, 8, 20, 1, 4, 10},  // b (98)
+    {901, 9, 20, 0, 7, 9},  // c (99)
+    {915, 9, 20, 0, 4, 10},  // d (100)
+    {929, 9, 20, 0, 7, 9},  // e (101)
+    {948, 6, 20, 0, 3, 6},  // f (102)
+    {957, 9, 20, 0, 7, 10},  // g (103)
+    {977, 8, 20, 1, 4, 9},  // h (104)
+    {988, 3, 20, 0, 4, 4},  // i (105)
+    {995, 4, 20, -1, 4, 4},  // j (106)
+    {1004, 8, 20, 1, 4, 9},  // k (107)
+    {1017, 2, 20, 1, 4, 4},  // l (108)
+    {1022, 12, 20, 1, 7, 14},  // m (109)
+    {1040, 8, 20, 1, 7, 9},  // n (110)
+    {1051, 9, 20, 0, 7, 9},  // o (111)
+    {1065, 8, 20, 1, 7, 10},  // p (112)
+    {1080, 9, 20, 0, 7, 10},  // q (113)
+    {1094, 5, 20, 1, 7, 6},  // r (114)
+    {1101, 8, 20, 0, 7, 8},  // s (115)
+    {1117, 5, 20, 0, 5, 5},  // t (116)
+    {1126, 8, 20, 1, 7, 9},  // u (117)
+    {1136, 9, 20, 0, 7, 9},  // v (118)
+    {1144, 13, 20, 0, 7, 13},  // w (119)
+    {1156, 9, 20, 0, 7, 9},  // x (120)
+    {1169, 9, 20, 0, 7, 9},  // y (121)
+    {1180, 8, 20, 0, 7, 9},  // z (122)
+    {1196, 5, 20, 1, 3, 7},  // { (123)
+    {1205, 2, 20, 2, 0, 5},  // | (124)
+    {1209, 6, 20, 0, 3, 7},  // } (125)
+    {1218, 9, 20, 1, 9, 10},  // ~ (126)
+};
+
+static const uint16_t inter20_kern_index[] = {
+    0, 0, 0, 6, 6, 6, 6, 16, 22, 22, 22, 29, 
+    38, 49, 58, 69, 72, 75, 75, 75, 75, 77, 77, 80, 
+    103, 103, 106, 109, 112, 112, 122, 130, 131, 141, 164, 165, 
+    166, 176, 176, 191, 191, 191, 191, 195, 215, 229, 229, 229, 
+    239, 247, 257, 257, 257, 299, 303, 331, 352, 366, 397, 406, 
+    406, 429, 429, 436, 458, 458, 464, 470, 476, 476, 482, 489, 
+    490, 496, 496, 496, 502, 502, 508, 514, 520, 526, 527, 538, 
+    543, 544, 552, 565, 572, 574, 587, 588, 588, 588, 588, 597, 
+};
+
+static const font_kern_pair_t inter20_kern_pairs[] = {
+    {34, 38, -1},  // " &
+    {34, 44, -1},  // " ,
+    {34, 46, -1},  // " .
+    {34, 52, -1},  // " 4
+    {34, 65, -1},  // " A
+    {34, 74, -3},  // " J
+    {38, 34, -1},  // & "
+    {38, 39, -1},  // & '
+    {38, 84, -1},  // & T
+    {38, 86, -1},  // & V
+    {38, 87, -1},  // & W
+    {38, 89, -1},  // & Y
+    {38, 92, -1},  // & backslash
+    {38, 118, -1},  // & v
+    {38, 119, -1},  // & w
+    {38, 121, -1},  // & y
+    {39, 38, -1},  // ' &
+    {39, 44, -1},  // ' ,
+    {39, 46, -1},  // ' .
+    {39, 52, -1},  // ' 4
+    {39, 65, -1},  // ' A
+    {39, 74, -3},  // ' J
+    {42, 38, -1},  // * &
+    {42, 44, -2},  // * ,
+    {42, 46, -2},  // * .
+    {42, 52, -1},  // * 4
+    {42, 65, -1},  // * A
+    {42, 74, -2},  // * J
+    {42, 95, -1},  // * _
+    {43, 50, -1},  // + 2
+    {43, 65, -1},  // + A
+    {43, 74, -1},  // + J
+    {43, 84, -1},  // + T
+    {43, 86, -1},  // + V
+    {43, 87, -1},  // + W
+    {43, 88, -1},  // + X
+    {43, 89, -1},  // + Y
+    {43, 92, -1},  // + backslash
+    {44, 34, -1},  // , "
+    {44, 39, -1},  // , '
+    {44, 49, -1},  // , 1
+    {44, 63, -2},  // , ?
+    {44, 64, -1},  // , @
+    {44, 67, -1},  // , C
+    {44, 71, -1},  // , G
+    {44, 79, -1},  // , O
+    {44, 81, -1},  // , Q
+    {44, 84, -1},  // , T
+    {44, 89, -1},  // , Y
+    {45, 50, -1},  // - 2
+    {45, 65, -1},  // - A
+    {45, 74, -1},  // - J
+    {45, 84, -1},  // - T
+    {45, 86, -1},  // - V
+    {45, 87, -1},  // - W
+    {45, 88, -1},  // - X
+    {45, 89, -1},  // - Y
+    {45, 92, -1},  // - backslash
+    {46, 34, -1},  // . "
+    {46, 39, -1},  // . '
+    {46, 49, -1},  // . 1
+    {46, 63, -2},  // . ?
+    {46, 64, -1},  // . @
+    {46, 67, -1},  // . C
+    {46, 71, -1},  // . G
+    {46, 79, -1},  // . O
+    {46, 81, -1},  // . Q
+    {46, 84, -1},  // . T
+    {46, 89, -1},  // . Y
+    {47, 44, -1},  // / ,
+    {47, 46, -1},  // / .
+    {47, 74, -1},  // / J
+    {48, 88, -1},  // 0 X
+    {48, 89, -1},  // 0 Y
+    {48, 95, -1},  // 0 _
+    {52, 44, -1},  // 4 ,
+    {52, 46, -1},  // 4 .
+    {54, 44, -1},  // 6 ,
+    {54, 46, -1},  // 6 .
+    {54, 95, -1},  // 6 _
+    {55, 35, -1},  // 7 #
+    {55, 38, -1},  // 7 &
+    {55, 44, -2},  // 7 ,
+    {55, 46, -2},  // 7 .
+    {55, 52, -1},  // 7 4
+    {55, 58, -1},  // 7 :
+    {55, 59, -1},  // 7 ;
+    {55, 60, -1},  // 7 <
+    {55, 65, -2},  // 7 A
+    {55, 74, -2},  // 7 J
+    {55, 95, -3},  // 7 _
+    {55, 97, -1},  // 7 a
+    {55, 99, -1},  // 7 c
+    {55, 100, -1},  // 7 d
+    {55, 101, -1},  // 7 e
+    {55, 103, -1},  // 7 g
+    {55, 109, -1},  // 7 m
+    {55, 110, -1},  // 7 n
+    {55, 111, -1},  // 7 o
+    {55, 112, -1},  // 7 p
+    {55, 113, -1},  // 7 q
+    {55, 114, -1},  // 7 r
+    {55, 115, -1},  // 7 s
+    {57, 88, -1},  // 9 X
+    {57, 89, -1},  // 9 Y
+    {57, 95, -1},  // 9 _
+    {58, 84, -1},  // : T
+    {58, 86, -1},  // : V
+    {58, 92, -1},  // : backslash
+    {59, 84, -1},  // ; T
+    {59, 86, -1},  // ; V
+    {59, 92, -1},  // ; backslash
+    {61, 65, -1},  // = A
+    {61, 84, -1},  // = T
+    {61, 86, -1},  // = V
+    {61, 87, -1},  // = W
+    {61, 88, -1},  // = X
+    {61, 89, -2},  // = Y
+    {61, 92, -1},  // = backslash
+    {61, 118, -1},  // = v
+    {61, 120, -1},  // = x
+    {61, 121, -1},  // = y
+    {62, 55, -1},  // > 7
+    {62, 84, -1},  // > T
+    {62, 86, -1},  // > V
+    {62, 87, -1},  // > W
+    {62, 88, -1},  // > X
+    {62, 89, -1},  // > Y
+    {62, 90, -1},  // > Z
+    {62, 92, -1},  // > backslash
+    {63, 65, -1},  // ? A
+    {64, 44, -1},  // @ ,
+    {64, 46, -1},  // @ .
+    {64, 47, -1},  // @ /
+    {64, 65, -1},  // @ A
+    {64, 84, -1},  // @ T
+    {64, 86, -1},  // @ V
+    {64, 88, -1},  // @ X
+    {64, 89, -1},  // @ Y
+    {64, 92, -1},  // @ backslash
+    {64, 95, -1},  // @ _
+    {65, 34, -1},  // A "
+    {65, 39, -1},  // A '
+    {65, 42, -1},  // A *
+    {65, 43, -1},  // A +
+    {65, 45, -1},  // A -
+    {65, 49, -1},  // A 1
+    {65, 61, -1},  // A =
+    {65, 63, -1},  // A ?
+    {65, 64, -1},  // A @
+    {65, 67, -1},  // A C
+    {65, 71, -1},  // A G
+    {65, 79, -1},  // A O
+    {65, 81, -1},  // A Q
+    {65, 84, -1},  // A T
+    {65, 86, -1},  // A V
+    {65, 87, -1},  // A W
+    {65, 89, -1},  // A Y
+    {65, 92, -1},  // A backslash
+    {65, 94, -1},  // A ^
+    {65, 118, -1},  // A v
+    {65, 119, -1},  // A w
+    {65, 121, -1},  // A y
+    {65, 126, -1},  // A ~
+    {66, 84, -1},  // B T
+    {67, 95, -1},  // C _
+    {68, 44, -1},  // D ,
+    {68, 46, -1},  // D .
+    {68, 47, -1},  // D /
+    {68, 65, -1},  // D A
+    {68, 84, -1},  // D T
+    {68, 86, -1},  // D V
+    {68, 88, -1},  // D X
+    {68, 89, -1},  // D Y
+    {68, 92, -1},  // D backslash
+    {68, 95, -1},  // D _
+    {70, 44, -1},  // F ,
+    {70, 46, -1},  // F .
+    {70, 65, -1},  // F A
+    {70, 74, -1},  // F J
+    {70, 95, -1},  // F _
+    {70, 99, -1},  // F c
+    {70, 100, -1},  // F d
+    {70, 101, -1},  // F e
+    {70, 103, -1},  // F g
+    {70, 111, -1},  // F o
+    {70, 113, -1},  // F q
+    {70, 117, -1},  // F u
+    {70, 118, -1},  // F v
+    {70, 121, -1},  // F y
+    {70, 122, -1},  // F z
+    {74, 44, -1},  // J ,
+    {74, 46, -1},  // J .
+    {74, 47, -1},  // J /
+    {74, 95, -1},  // J _
+    {75, 43, -2},  // K +
+    {75, 45, -2},  // K -
+    {75, 60, -1},  // K <
+    {75, 61, -1},  // K =
+    {75, 64, -1},  // K @
+    {75, 67, -1},  // K C
+    {75, 71, -1},  // K G
+    {75, 79, -1},  // K O
+    {75, 81, -1},  // K Q
+    {75, 99, -1},  // K c
+    {75, 100, -1},  // K d
+    {75, 101, -1},  // K e
+    {75, 103, -1},  // K g
+    {75, 111, -1},  // K o
+    {75, 113, -1},  // K q
+    {75, 117, -1},  // K u
+    {75, 118, -1},  // K v
+    {75, 119, -1},  // K w
+    {75, 121, -1},  // K y
+    {75, 126, -2},  // K ~
+    {76, 34, -1},  // L "
+    {76, 39, -1},  // L '
+    {76, 42, -1},  // L *
+    {76, 43, -1},  // L +
+    {76, 45, -1},  // L -
+    {76, 49, -1},  // L 1
+    {76, 84, -2},  // L T
+    {76, 86, -1},  // L V
+    {76, 89, -1},  // L Y
+    {76, 92, -1},  // L backslash
+    {76, 94, -2},  // L ^
+    {76, 118, -1},  // L v
+    {76, 121, -1},  // L y
+    {76, 126, -1},  // L ~
+    {79, 44, -1},  // O ,
+    {79, 46, -1},  // O .
+    {79, 47, -1},  // O /
+    {79, 65, -1},  // O A
+    {79, 84, -1},  // O T
+    {79, 86, -1},  // O V
+    {79, 88, -1},  // O X
+    {79, 89, -1},  // O Y
+    {79, 92, -1},  // O backslash
+    {79, 95, -1},  // O _
+    {80, 38, -1},  // P &
+    {80, 43, -1},  // P +
+    {80, 44, -1},  // P ,
+    {80, 45, -1},  // P -
+    {80, 46, -1},  // P .
+    {80, 65, -1},  // P A
+    {80, 74, -2},  // P J
+    {80, 126, -1},  // P ~
+    {81, 44, -1},  // Q ,
+    {81, 46, -1},  // Q .
+    {81, 47, -1},  // Q /
+    {81, 65, -1},  // Q A
+    {81, 84, -1},  // Q T
+    {81, 86, -1},  // Q V
+    {81, 88, -1},  // Q X
+    {81, 89, -1},  // Q Y
+    {81, 92, -1},  // Q backslash
+    {81, 95, -1},  // Q _
+    {84, 38, -1},  // T &
+    {84, 43, -1},  // T +
+    {84, 44, -1},  // T ,
+    {84, 45, -1},  // T -
+    {84, 46, -1},  // T .
+    {84, 47, -1},  // T /
+    {84, 48, -1},  // T 0
+    {84, 52, -1},  // T 4
+    {84, 54, -1},  // T 6
+    {84, 55, -1},  // T 7
+    {84, 58, -1},  // T :
+    {84, 59, -1},  // T ;
+    {84, 60, -1},  // T <
+    {84, 61, -1},  // T =
+    {84, 64, -1},  // T @
+    {84, 65, -1},  // T A
+    {84, 67, -1},  // T C
+    {84, 71, -1},  // T G
+    {84, 74, -1},  // T J
+    {84, 79, -1},  // T O
+    {84, 81, -1},  // T Q
+    {84, 95, -1},  // T _
+    {84, 97, -1},  // T a
+    {84, 99, -1},  // T c
+    {84, 100, -1},  // T d
+    {84, 101, -1},  // T e
+    {84, 103, -1},  // T g
+    {84, 109, -1},  // T m
+    {84, 110, -1},  // T n
+    {84, 111, -1},  // T o
+    {84, 112, -1},  // T p
+    {84, 113, -1},  // T q
+    {84, 114, -1},  // T r
+    {84, 115, -1},  // T s
+    {84, 116, -1},  // T t
+    {84, 117, -1},  // T u
+    {84, 118, -1},  // T v
+    {84, 119, -1},  // T w
+    {84, 120, -1},  // T x
+    {84, 121, -1},  // T y
+    {84, 122, -1},  // T z
+    {84, 126, -1},  // T ~
+    {85, 44, -1},  // U ,
+    {85, 46, -1},  // U .
+    {85, 47, -1},  // U /
+    {85, 95, -1},  // U _
+    {86, 38, -1},  // V &
+    {86, 43, -1},  // V +
+    {86, 44, -2},  // V ,
+    {86, 45, -1},  // V -
+    {86, 46, -2},  // V .
+    {86, 47, -1},  // V /
+    {86, 52, -1},  // V 4
+    {86, 58, -1},  // V :
+    {86, 59, -1},  // V ;
+    {86, 60, -1},  // V <
+    {86, 61, -1},  // V =
+    {86, 64, -1},  // V @
+    {86, 65, -1},  // V A
+    {86, 67, -1},  // V C
+    {86, 71, -1},  // V G
+    {86, 74, -2},  // V J
+    {86, 79, -1},  // V O
+    {86, 81, -1},  // V Q
+    {86, 95, -1},  // V _
+    {86, 97, -1},  // V a
+    {86, 99, -1},  // V c
+    {86, 100, -1},  // V d
+    {86, 101, -1},  // V e
+    {86, 103, -1},  // V g
+    {86, 111, -1},  // V o
+    {86, 113, -1},  // V q
+    {86, 115, -1},  // V s
+    {86, 126, -1},  // V ~
+    {87, 38, -1},  // W &
+    {87, 43, -1},  // W +
+    {87, 44, -2},  // W ,
+    {87, 45, -1},  // W -
+    {87, 46, -2},  // W .
+    {87, 52, -1},  // W 4
+    {87, 58, -1},  // W :
+    {87, 59, -1},  // W ;
+    {87, 60, -1},  // W <
+    {87, 61, -1},  // W =
+    {87, 65, -1},  // W A
+    {87, 74, -1},  // W J
+    {87, 97, -1},  // W a
+    {87, 99, -1},  // W c
+    {87, 100, -1},  // W d
+    {87, 101, -1},  // W e
+    {87, 103, -1},  // W g
+    {87, 111, -1},  // W o
+    {87, 113, -1},  // W q
+    {87, 115, -1},  // W s
+    {87, 126, -1},  // W ~
+    {88, 43, -1},  // X +
+    {88, 45, -1},  // X -
+    {88, 48, -1},  // X 0
+    {88, 52, -1},  // X 4
+    {88, 54, -1},  // X 6
+    {88, 60, -1},  // X <
+    {88, 61, -1},  // X =
+    {88, 64, -1},  // X @
+    {88, 67, -1},  // X C
+    {88, 71, -1},  // X G
+    {88, 79, -1},  // X O
+    {88, 81, -1},  // X Q
+    {88, 97, -1},  // X a
+    {88, 126, -1},  // X ~
+    {89, 38, -1},  // Y &
+    {89, 43, -1},  // Y +
+    {89, 44, -1},  // Y ,
+    {89, 45, -1},  // Y -
+    {89, 46, -1},  // Y .
+    {89, 52, -1},  // Y 4
+    {89, 58, -1},  // Y :
+    {89, 59, -1},  // Y ;
+    {89, 60, -2},  // Y <
+    {89, 61, -2},  // Y =
+    {89, 64, -1},  // Y @
+    {89, 65, -1},  // Y A
+    {89, 67, -1},  // Y C
+    {89, 71, -1},  // Y G
+    {89, 74, -1},  // Y J
+    {89, 79, -1},  // Y O
+    {89, 81, -1},  // Y Q
+    {89, 97, -1},  // Y a
+    {89, 99, -1},  // Y c
+    {89, 100, -1},  // Y d
+    {89, 101, -1},  // Y e
+    {89, 103, -1},  // Y g
+    {89, 109, -1},  // Y m
+    {89, 110, -1},  // Y n
+    {89, 111, -1},  // Y o
+    {89, 112, -1},  // Y p
+    {89, 113, -1},  // Y q
+    {89, 114, -1},  // Y r
+    {89, 115, -1},  // Y s
+    {89, 117, -1},  // Y u
+    {89, 126, -1},  // Y ~
+    {90, 43, -1},  // Z +
+    {90, 45, -1},  // Z -
+    {90, 60, -1},  // Z <
+    {90, 64, -1},  // Z @
+    {90, 67, -1},  // Z C
+    {90, 71, -1},  // Z G
+    {90, 79, -1},  // Z O
+    {90, 81, -1},  // Z Q
+    {90, 126, -1},  // Z ~
+    {92, 34, -1},  // backslash "
+    {92, 39, -1},  // backslash '
+    {92, 42, -1},  // backslash *
+    {92, 43, -1},  // backslash +
+    {92, 45, -1},  // backslash -
+    {92, 49, -1},  // backslash 1
+    {92, 61, -1},  // backslash =
+    {92, 63, -1},  // backslash ?
+    {92, 64, -1},  // backslash @
+    {92, 67, -1},  // backslash C
+    {92, 71, -1},  // backslash G
+    {92, 79, -1},  // backslash O
+    {92, 81, -1},  // backslash Q
+    {92, 84, -1},  // backslash T
+    {92, 86, -1},  // backslash V
+    {92, 87, -1},  // backslash W
+    {92, 89, -1},  // backslash Y
+    {92, 92, -1},  // backslash backslash
+    {92, 94, -1},  // backslash ^
+    {92, 118, -1},  // backslash v
+    {92, 119, -1},  // backslash w
+    {92, 121, -1},  // backslash y
+    {92, 126, -1},  // backslash ~
+    {94, 38, -1},  // ^ &
+    {94, 44, -2},  // ^ ,
+    {94, 46, -2},  // ^ .
+    {94, 52, -1},  // ^ 4
+    {94, 65, -1},  // ^ A
+    {94, 74, -2},  // ^ J
+    {94, 95, -1},  // ^ _
+    {95, 42, -1},  // _ *
+    {95, 48, -1},  // _ 0
+    {95, 49, -2},  // _ 1
+    {95, 51, -1},  // _ 3
+    {95, 52, -1},  // _ 4
+    {95, 53, -1},  // _ 5
+    {95, 54, -1},  // _ 6
+    {95, 56, -1},  // _ 8
+    {95, 57, -1},  // _ 9
+    {95, 64, -1},  // _ @
+    {95, 67, -1},  // _ C
+    {95, 71, -1},  // _ G
+    {95, 79, -1},  // _ O
+    {95, 81, -1},  // _ Q
+    {95, 84, -1},  // _ T
+    {95, 85, -1},  // _ U
+    {95, 86, -1},  // _ V
+    {95, 92, -1},  // _ backslash
+    {95, 94, -1},  // _ ^
+    {95, 106, 2},  // _ j
+    {95, 118, -1},  // _ v
+    {95, 121, -1},  // _ y
+    {97, 49, -1},  // a 1
+    {97, 84, -1},  // a T
+    {97, 86, -1},  // a V
+    {97, 87, -1},  // a W
+    {97, 89, -1},  // a Y
+    {97, 92, -1},  // a backslash
+    {98, 49, -1},  // b 1
+    {98, 84, -1},  // b T
+    {98, 86, -1},  // b V
+    {98, 87, -1},  // b W
+    {98, 89, -1},  // b Y
+    {98, 92, -1},  // b backslash
+    {99, 49, -1},  // c 1
+    {99, 84, -1},  // c T
+    {99, 86, -1},  // c V
+    {99, 87, -1},  // c W
+    {99, 89, -1},  // c Y
+    {99, 92, -1},  // c backslash
+    {101, 49, -1},  // e 1
+    {101, 84, -1},  // e T
+    {101, 86, -1},  // e V
+    {101, 87, -1},  // e W
+    {101, 89, -1},  // e Y
+    {101, 92, -1},  // e backslash
+    {102, 44, -1},  // f ,
+    {102, 46, -1},  // f .
+    {102, 52, -1},  // f 4
+    {102, 65, -1},  // f A
+    {102, 74, -1},  // f J
+    {102, 102, -1},  // f f
+    {102, 116, -1},  // f t
+    {103, 84, -1},  // g T
+    {104, 49, -1},  // h 1
+    {104, 84, -1},  // h T
+    {104, 86, -1},  // h V
+    {104, 87, -1},  // h W
+    {104, 89, -1},  // h Y
+    {104, 92, -1},  // h backslash
+    {107, 43, -1},  // k +
+    {107, 45, -1},  // k -
+    {107, 52, -1},  // k 4
+    {107, 60, -1},  // k <
+    {107, 84, -1},  // k T
+    {107, 126, -1},  // k ~
+    {109, 49, -1},  // m 1
+    {109, 84, -1},  // m T
+    {109, 86, -1},  // m V
+    {109, 87, -1},  // m W
+    {109, 89, -1},  // m Y
+    {109, 92, -1},  // m backslash
+    {110, 49, -1},  // n 1
+    {110, 84, -1},  // n T
+    {110, 86, -1},  // n V
+    {110, 87, -1},  // n W
+    {110, 89, -1},  // n Y
+    {110, 92, -1},  // n backslash
+    {111, 49, -1},  // o 1
+    {111, 84, -1},  // o T
+    {111, 86, -1},  // o V
+    {111, 87, -1},  // o W
+    {111, 89, -1},  // o Y
+    {111, 92, -1},  // o backslash
+    {112, 49, -1},  // p 1
+    {112, 84, -1},  // p T
+    {112, 86, -1},  // p V
+    {112, 87, -1},  // p W
+    {112, 89, -1},  // p Y
+    {112, 92, -1},  // p backslash
+    {113, 84, -1},  // q T
+    {114, 43, -1},  // r +
+    {114, 44, -1},  // r ,
+    {114, 45, -1},  // r -
+    {114, 46, -1},  // r .
+    {114, 47, -1},  // r /
+    {114, 60, -1},  // r <
+    {114, 65, -1},  // r A
+    {114, 74, -1},  // r J
+    {114, 84, -1},  // r T
+    {114, 90, -1},  // r Z
+    {114, 126, -1},  // r ~
+    {115, 84, -1},  // s T
+    {115, 86, -1},  // s V
+    {115, 87, -1},  // s W
+    {115, 89, -1},  // s Y
+    {115, 92, -1},  // s backslash
+    {116, 84, -1},  // t T
+    {117, 43, -1},  // u +
+    {117, 45, -1},  // u -
+    {117, 47, -1},  // u /
+    {117, 60, -1},  // u <
+    {117, 84, -1},  // u T
+    {117, 89, -1},  // u Y
+    {117, 95, -1},  // u _
+    {117, 126, -1},  // u ~
+    {118, 43, -1},  // v +
+    {118, 44, -1},  // v ,
+    {118, 45, -1},  // v -
+    {118, 46, -1},  // v .
+    {118, 47, -1},  // v /
+    {118, 60, -1},  // v <
+    {118, 61, -1},  // v =
+    {118, 65, -1},  // v A
+    {118, 74, -1},  // v J
+    {118, 84, -1},  // v T
+    {118, 89, -1},  // v Y
+    {118, 95, -1},  // v _
+    {118, 126, -1},  // v ~
+    {119, 38, -1},  // w &
+    {119, 44, -1},  // w ,
+    {119, 46, -1},  // w .
+    {119, 65, -1},  // w A
+    {119, 74, -1},  // w J
+    {119, 84, -1},  // w T
+    {119, 90, -1},  // w Z
+    {120, 61, -1},  // x =
+    {120, 84, -1},  // x T
+    {121, 43, -1},  // y +
+    {121, 44, -1},  // y ,
+    {121, 45, -1},  // y -
+    {121, 46, -1},  // y .
+    {121, 47, -1},  // y /
+    {121, 60, -1},  // y <
+    {121, 61, -1},  // y =
+    {121, 65, -1},  // y A
+    {121, 74, -1},  // y J
+    {121, 84, -1},  // y T
+    {121, 89, -1},  // y Y
+    {121, 95, -1},  // y _
+    {121, 126, -1},  // y ~
+    {122, 84, -1},  // z T
+    {126, 50, -1},  // ~ 2
+    {126, 65, -1},  // ~ A
+    {126, 74, -1},  // ~ J
+    {126, 84, -1},  // ~ T
+    {126, 86, -1},  // ~ V
+    {126, 87, -1},  // ~ W
+    {126, 88, -1},  // ~ X
+    {126, 89, -1},  // ~ Y
+    {126, 92, -1},  // ~ backslash
 };
 
 const font_t font_inter_20 = {
@@ -433,4 +966,8 @@ const font_t font_inter_20 = {
     .last_char = 126,
     .line_height = 24,
     .baseline = 20,
+    .kern_index = inter20_kern_index,
+    .kern_pairs = inter20_kern_pairs,
+    .kern_count = 597,
+    .flags = FONT_FLAG_RLE,
 };
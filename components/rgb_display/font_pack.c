@@ -0,0 +1,133 @@
+/*
+ * Font Packs - fonts memory-mapped from the asset partition
+ *
+ * Pack files are produced by tools/generate_font.lua --pack and bundled
+ * with tools/pack_assets.lua. Glyph records and bitmaps are used in place
+ * from flash; loading a pack only validates the header.
+ */
+
+#include <string.h>
+#include <stddef.h>
+#include "fonts.h"
+#include "assets.h"
+#include "esp_log.h"
+
+static const char *TAG = "FONT_PACK";
+
+_Static_assert(sizeof(font_glyph_t) == 12, "font_glyph_t must match the pack glyph record");
+_Static_assert(offsetof(font_glyph_t, x_advance) == 8, "font_glyph_t must match the pack glyph record");
+_Static_assert(sizeof(font_pack_header_t) == 32, "font_pack_header_t must match the pack header");
+_Static_assert(sizeof(font_kern_pair_t) == 3, "font_kern_pair_t must match the pack kerning record");
+
+// Version 1 packs end the header before kern_offset
+#define FONT_PACK_V1_HEADER_SIZE 24
+
+typedef struct {
+    font_t font;
+    char name[ASSETS_NAME_LEN];
+    assets_map_t map;
+    bool loaded;
+} loaded_font_t;
+
+static loaded_font_t s_fonts[FONT_MAX_LOADED];
+
+static bool pack_has_kerning(const font_pack_header_t *hdr)
+{
+    return hdr->version >= 2 && hdr->kern_count > 0;
+}
+
+static bool pack_is_valid(const font_pack_header_t *hdr, size_t size)
+{
+    if (size < FONT_PACK_V1_HEADER_SIZE) return false;
+    if (memcmp(hdr->magic, FONT_PACK_MAGIC, 4) != 0) return false;
+    if (hdr->version < 1 || hdr->version > FONT_PACK_VERSION) return false;
+    if (hdr->version >= 2 && size < sizeof(*hdr)) return false;
+    if (hdr->last_char < hdr->first_char) return false;
+    if (hdr->glyph_count != hdr->last_char - hdr->first_char + 1) return false;
+    if (hdr->glyphs_offset & 3) return false;
+    if (hdr->glyphs_offset + (size_t)hdr->glyph_count * sizeof(font_glyph_t) > size) return false;
+    if (hdr->bitmap_offset + (size_t)hdr->bitmap_size > size) return false;
+    if (pack_has_kerning(hdr)) {
+        size_t kern_size = (hdr->glyph_count + 1) * sizeof(uint16_t) +
+                           (size_t)hdr->kern_count * sizeof(font_kern_pair_t);
+        if ((hdr->kern_offset & 1) || hdr->kern_offset + kern_size > size) return false;
+    }
+    if (hdr->version >= 2 && (hdr->flags & FONT_FLAG_RLE)) {
+        // Every glyph stream must start inside the bitmap and the last one
+        // must be terminated, so decoding can never run off the end
+        const uint8_t *base = (const uint8_t *)hdr;
+        const font_glyph_t *glyphs = (const font_glyph_t *)(base + hdr->glyphs_offset);
+        if (hdr->bitmap_size == 0 || base[hdr->bitmap_offset + hdr->bitmap_size - 1] != 0) return false;
+        for (int i = 0; i < hdr->glyph_count; i++) {
+            if (glyphs[i].width > 0 && glyphs[i].bitmap_offset >= hdr->bitmap_size) return false;
+        }
+    }
+    return true;
+}
+
+int font_pack_load(const char *name)
+{
+    if (!name) return -1;
+
+    int free_slot = -1;
+    for (int i = 0; i < FONT_MAX_LOADED; i++) {
+        if (s_fonts[i].loaded) {
+            if (strncmp(s_fonts[i].name, name, ASSETS_NAME_LEN) == 0) {
+                return FONT_COUNT + i;
+            }
+        } else if (free_slot < 0) {
+            free_slot = i;
+        }
+    }
+
+    if (free_slot < 0) {
+        ESP_LOGE(TAG, "Cannot load '%s': all %d font slots in use", name, FONT_MAX_LOADED);
+        return -1;
+    }
+
+    loaded_font_t *slot = &s_fonts[free_slot];
+    esp_err_t ret = assets_map(name, &slot->map);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Font pack '%s' not available: %s", name, esp_err_to_name(ret));
+        return -1;
+    }
+
+    const uint8_t *base = (const uint8_t *)slot->map.data;
+    const font_pack_header_t *hdr = (const font_pack_header_t *)base;
+    if (!pack_is_valid(hdr, slot->map.size)) {
+        ESP_LOGE(TAG, "Invalid font pack '%s'", name);
+        assets_unmap(&slot->map);
+        return -1;
+    }
+
+    slot->font = (font_t){
+        .bitmap = base + hdr->bitmap_offset,
+        .glyphs = (const font_glyph_t *)(base + hdr->glyphs_offset),
+        .first_char = hdr->first_char,
+        .last_char = hdr->last_char,
+        .line_height = hdr->line_height,
+        .baseline = hdr->baseline,
+    };
+    if (hdr->version >= 2) {
+        slot->font.flags = hdr->flags & FONT_FLAG_RLE;
+    }
+    if (pack_has_kerning(hdr)) {
+        slot->font.kern_index = (const uint16_t *)(base + hdr->kern_offset);
+        slot->font.kern_pairs = (const font_kern_pair_t *)(slot->font.kern_index + hdr->glyph_count + 1);
+        slot->font.kern_count = hdr->kern_count;
+    }
+    strncpy(slot->name, name, ASSETS_NAME_LEN - 1);
+    slot->name[ASSETS_NAME_LEN - 1] = '\0';
+    slot->loaded = true;
+
+    ESP_LOGI(TAG, "Loaded font pack '%s' (%u bytes) as font %d",
+             name, (unsigned)slot->map.size, FONT_COUNT + free_slot);
+    return FONT_COUNT + free_slot;
+}
+
+const font_t* font_pack_get(int id)
+{
+    int index = id - FONT_COUNT;
+    if (index < 0 || index >= FONT_MAX_LOADED) return NULL;
+    return s_fonts[index].loaded ? &s_fonts[index].font : NULL;
+}
@@ -5,6 +5,7 @@
 #include <string.h>
 #include "fonts.h"
 #include "rgb_display.h"
+#include "rgb_stats.h"
 
 // External font declarations
 extern const font_t font_inter_20;
@@ -17,6 +18,11 @@ static font_id_t current_font = FONT_DEFAULT;
 
 const font_t* font_get(font_id_t id)
 {
+    if ((int)id >= FONT_COUNT) {
+        const font_t *loaded = font_pack_get(id);
+        return loaded ? loaded : &font_inter_20;
+    }
+
     switch (id) {
         case FONT_INTER_20:
         case FONT_DEFAULT:
@@ -28,6 +34,12 @@ const font_t* font_get(font_id_t id)
     }
 }
 
+bool font_is_valid(int id)
+{
+    if (id >= 0 && id < FONT_COUNT) return true;
+    return font_pack_get(id) != NULL;
+}
+
 const font_glyph_t* font_get_glyph(const font_t *font, char c)
 {
     if (!font) return NULL;
@@ -35,31 +47,99 @@ const font_glyph_t* font_get_glyph(const font_t *font, char c)
     return &font->glyphs[c - font->first_char];
 }
 
-int font_string_width(const font_t *font, const char *str)
+// Small direct-mapped cache of recent kerning lookups. Text on the
+// dashboard repeats the same few pairs every frame, so most lookups
+// are a single compare instead of a binary search.
+#define KERN_CACHE_SIZE 64
+
+typedef struct {
+    const font_t *font;
+    uint16_t pair;
+    int8_t adjust;
+} kern_cache_entry_t;
+
+static kern_cache_entry_t kern_cache[KERN_CACHE_SIZE];
+
+static int kern_search(const font_t *font, uint8_t left, uint8_t right)
 {
-    if (!str) return 0;
-    
-    if (!font) {
-        // Default 8x16 font
-        return strlen(str) * 8;
+    if (left < font->first_char || left > font->last_char) return 0;
+
+    int lo = font->kern_index[left - font->first_char];
+    int hi = font->kern_index[left - font->first_char + 1] - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) >> 1;
+        uint8_t r = font->kern_pairs[mid].right;
+        if (r == right) return font->kern_pairs[mid].adjust;
+        if (r < right) lo = mid + 1;
+        else hi = mid - 1;
     }
+    return 0;
+}
+
+int font_get_kerning(const font_t *font, char left, char right)
+{
+    if (!font || !font->kern_count) return 0;
+
+    uint8_t l = (uint8_t)left, r = (uint8_t)right;
+    uint16_t pair = (l << 8) | r;
+    kern_cache_entry_t *entry = &kern_cache[(l * 31 + r) & (KERN_CACHE_SIZE - 1)];
+    if (entry->font == font && entry->pair == pair) return entry->adjust;
+
+    int adjust = kern_search(font, l, r);
+    entry->font = font;
+    entry->pair = pair;
+    entry->adjust = adjust;
+    return adjust;
+}
+
+void font_measure(const font_t *font, const char *str, font_metrics_t *out)
+{
+    out->width = 0;
+    out->height = 0;
+    out->lines = 0;
+    if (!str) return;
     
+    // Default 8x16 font when no font is given
+    int line_height = font ? font->line_height : 16;
     int width = 0;
-    while (*str) {
+    char prev = 0;
+    
+    out->lines = 1;
+    for (; *str; str++) {
+        if (*str == '\n' || *str == '\r') {
+            if (width > out->width) out->width = width;
+            if (*str == '\n') out->lines++;
+            width = 0;
+            prev = 0;
+            continue;
+        }
+        if (!font) {
+            width += 8;
+            continue;
+        }
         const font_glyph_t *glyph = font_get_glyph(font, *str);
+        if (prev) width += font_get_kerning(font, prev, *str);
         if (glyph) {
             width += glyph->x_advance;
         } else {
             width += font->line_height / 2;  // Fallback width
         }
-        str++;
+        prev = *str;
     }
-    return width;
+    if (width > out->width) out->width = width;
+    out->height = out->lines * line_height;
+}
+
+int font_string_width(const font_t *font, const char *str)
+{
+    font_metrics_t metrics;
+    font_measure(font, str, &metrics);
+    return metrics.width;
 }
 
 void rgb_display_set_font(font_id_t id)
 {
-    if (id < FONT_COUNT) {
+    if (font_is_valid(id)) {
         current_font = id;
     }
 }
@@ -69,6 +149,73 @@ font_id_t rgb_display_get_font(void)
     return current_font;
 }
 
+// Draw a run of set pixels from an RLE glyph, starting at pixel index
+// start (column-major), as one vertical span per column it covers
+static void draw_rle_run(const rgb_surface_t *target, const rgb_display_clip_t *clip, int x, int y,
+                         int height, int start, int len, uint16_t color)
+{
+    int col = start / height;
+    int row = start - col * height;
+
+    while (len > 0) {
+        int span = height - row;
+        if (span > len) span = len;
+
+        int px = x + col;
+        int y0 = y + row;
+        int y1 = y0 + span;
+        if (y0 < clip->y0) y0 = clip->y0;
+        if (y1 > clip->y1) y1 = clip->y1;
+        if (px >= clip->x0 && px < clip->x1 && y1 > y0) {
+            uint16_t *dst = &target->pixels[y0 * target->width + px];
+            for (int py = y0; py < y1; py++) {
+                *dst = color;
+                dst += target->width;
+            }
+            RGB_STATS_PIXELS(y1 - y0);
+        }
+
+        len -= span;
+        row = 0;
+        col++;
+    }
+}
+
+// Streaming decode of an RLE glyph straight into the drawing target
+// Each byte holds clear pixels (high 5 bits) and set pixels (low 3 bits);
+// set runs split across bytes are merged before drawing, 0x00 ends the glyph.
+static void draw_font_glyph_rle(int x, int y, const font_t *font, const font_glyph_t *glyph, uint16_t color)
+{
+    if (!font || !glyph || !font->bitmap || glyph->width == 0) return;
+
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (!target->pixels) return;
+
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    const uint8_t *p = &font->bitmap[glyph->bitmap_offset];
+    int pos = 0;
+    int run_start = 0;
+    int run_len = 0;
+    uint8_t code;
+
+    while ((code = *p++) != 0) {
+        int zeros = code >> 3;
+        if (zeros) {
+            if (run_len) {
+                draw_rle_run(target, clip, x, y, glyph->height, run_start, run_len, color);
+                run_len = 0;
+            }
+            pos += zeros;
+        }
+        if (!run_len) run_start = pos;
+        run_len += code & 0x07;
+        pos += code & 0x07;
+    }
+    if (run_len) {
+        draw_rle_run(target, clip, x, y, glyph->height, run_start, run_len, color);
+    }
+}
+
 // Column-based rendering for bitmap fonts
 // Supports fonts up to 24px tall (3 bytes per column)
 static void draw_font_glyph_col(int x, int y, const font_t *font, const font_glyph_t *glyph, uint16_t color)
@@ -106,18 +253,32 @@ void rgb_display_draw_text_font(int x, int y, const char *text, uint16_t color,
         return;
     }
     
+    RGB_STATS_BEGIN();
+    font_atlas_page_t *page = font_atlas_get_page(font, color);
     int cur_x = x;
+    char prev = 0;
     
     while (*text) {
         if (*text == '\n') {
             y += font->line_height;
             cur_x = x;
+            prev = 0;
         } else if (*text == '\r') {
             cur_x = x;
+            prev = 0;
         } else {
             const font_glyph_t *glyph = font_get_glyph(font, *text);
+            if (prev) cur_x += font_get_kerning(font, prev, *text);
+            prev = *text;
             if (glyph) {
-                draw_font_glyph_col(cur_x, y, font, glyph, color);
+                RGB_STATS_GLYPHS(1);
+                if (font_atlas_draw_glyph(page, cur_x, y, *text)) {
+                    // Drawn from the atlas
+                } else if (font->flags & FONT_FLAG_RLE) {
+                    draw_font_glyph_rle(cur_x, y, font, glyph, color);
+                } else {
+                    draw_font_glyph_col(cur_x, y, font, glyph, color);
+                }
                 cur_x += glyph->x_advance;
             } else {
                 // Unknown character - skip
@@ -126,4 +287,5 @@ void rgb_display_draw_text_font(int x, int y, const char *text, uint16_t color,
         }
         text++;
     }
+    RGB_STATS_END(RGB_STATS_TEXT_FONT);
 }
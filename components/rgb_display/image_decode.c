@@ -0,0 +1,580 @@
+/*
+ * Streaming Image Decoders
+ *
+ * Both decoders are byte-driven state machines, so a chunk boundary may
+ * fall anywhere. QOI ops are decoded straight into the current row. PNG
+ * chunks are parsed as they arrive; IDAT data goes through tinfl with a
+ * wrapping 32KB window, and each scanline is unfiltered against the
+ * previous one and converted as soon as its last byte is inflated.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "image_decode.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "miniz.h"
+
+static const char *TAG = "IMAGE_DECODE";
+
+#define QOI_HEADER_SIZE 14
+#define PNG_HEADER_SIZE 33      // Signature, IHDR chunk and its CRC
+#define PNG_IHDR_SIZE   13
+
+static const uint8_t s_png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+typedef enum {
+    PNG_SIGNATURE = 0,
+    PNG_CHUNK_HEAD,
+    PNG_CHUNK_DATA,
+    PNG_CHUNK_CRC,
+} png_stage_t;
+
+typedef struct {
+    png_stage_t stage;
+    uint32_t chunk_left;        // Bytes left in the current stage
+    uint32_t chunk_type;
+    uint8_t depth;              // Bits per sample
+    uint8_t color_type;
+    uint8_t channels;
+    uint8_t bpp;                // Bytes per complete pixel (at least 1)
+    size_t stride;              // Bytes per scanline, without the filter byte
+    size_t line_pos;            // Bytes of the current scanline received
+    uint8_t *line;              // Filter byte + current scanline
+    uint8_t *prev;              // Previous scanline (unfiltered)
+    uint16_t palette[256];
+    uint8_t palette_alpha[256];
+    int palette_pos;            // PLTE/tRNS bytes received
+    tinfl_decompressor *inflator;
+    uint8_t *window;            // TINFL_LZ_DICT_SIZE
+    size_t window_pos;
+    bool inflate_done;
+} png_state_t;
+
+typedef struct {
+    uint8_t index[64][4];       // RGBA
+    uint8_t px[4];
+    uint8_t op_len;             // Bytes needed for the pending op
+} qoi_state_t;
+
+struct image_decoder {
+    image_decode_format_t format;
+    image_decode_sink_t sink;
+    void *ctx;
+    int width;
+    int height;
+    int row;                    // Next row to deliver
+    int col;                    // Pixels of the row assembled so far
+    bool has_size;
+    bool row_alpha;             // A pixel of the row is not opaque
+    uint16_t *pixels;           // Row being assembled
+    uint8_t *alpha;
+    uint8_t hold[PNG_IHDR_SIZE];
+    size_t held;
+    union {
+        qoi_state_t qoi;
+        png_state_t png;
+    };
+};
+
+static inline uint32_t be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint16_t to565(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static void *alloc(size_t size)
+{
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+}
+
+// Allocate the row buffers once the size is known
+static esp_err_t set_size(image_decoder_t *dec, uint32_t width, uint32_t height)
+{
+    if (width == 0 || height == 0 || height > INT16_MAX) return ESP_ERR_INVALID_RESPONSE;
+    if (width > IMAGE_DECODE_MAX_WIDTH) {
+        ESP_LOGW(TAG, "Image too wide: %u", (unsigned)width);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    dec->pixels = alloc(width * sizeof(uint16_t));
+    dec->alpha = alloc(width);
+    if (!dec->pixels || !dec->alpha) return ESP_ERR_NO_MEM;
+    dec->width = width;
+    dec->height = height;
+    dec->has_size = true;
+    return ESP_OK;
+}
+
+static inline bool emit_done(const image_decoder_t *dec)
+{
+    return dec->has_size && dec->row >= dec->height;
+}
+
+// Append one pixel to the current row, delivering it when complete
+static inline void emit(image_decoder_t *dec, uint16_t color, uint8_t a)
+{
+    dec->pixels[dec->col] = color;
+    dec->alpha[dec->col] = a;
+    if (a != 0xFF) dec->row_alpha = true;
+    if (++dec->col == dec->width) {
+        dec->sink(dec->ctx, dec->row, dec->pixels, dec->row_alpha ? dec->alpha : NULL, dec->width);
+        dec->row++;
+        dec->col = 0;
+        dec->row_alpha = false;
+    }
+}
+
+// ===================== QOI =====================
+
+static esp_err_t qoi_feed(image_decoder_t *dec, const uint8_t *p, size_t len)
+{
+    qoi_state_t *q = &dec->qoi;
+
+    while (len > 0 && !emit_done(dec)) {
+        if (!dec->has_size) {
+            size_t take = QOI_HEADER_SIZE - dec->held;
+            if (take > len) take = len;
+            // Check the magic and keep width and height; channels and
+            // colorspace don't change the decoding
+            for (size_t i = 0; i < take; i++) {
+                size_t at = dec->held + i;
+                if (at < 4 && p[i] != "qoif"[at]) return ESP_ERR_INVALID_RESPONSE;
+                if (at >= 4 && at < 12) dec->hold[at - 4] = p[i];
+            }
+            dec->held += take;
+            p += take;
+            len -= take;
+            if (dec->held < QOI_HEADER_SIZE) return ESP_OK;
+
+            esp_err_t err = set_size(dec, be32(dec->hold), be32(dec->hold + 4));
+            if (err != ESP_OK) return err;
+            q->px[3] = 0xFF;
+            dec->held = 0;
+            continue;
+        }
+
+        // Collect a whole op (up to 5 bytes) before decoding it
+        if (dec->held == 0) {
+            uint8_t b = *p;
+            q->op_len = b == 0xFF ? 5 : b == 0xFE ? 4 : (b & 0xC0) == 0x80 ? 2 : 1;
+        }
+        size_t take = q->op_len - dec->held;
+        if (take > len) take = len;
+        memcpy(dec->hold + dec->held, p, take);
+        dec->held += take;
+        p += take;
+        len -= take;
+        if (dec->held < q->op_len) return ESP_OK;
+        dec->held = 0;
+
+        const uint8_t *op = dec->hold;
+        uint8_t *px = q->px;
+        int run = 1;
+        if (op[0] == 0xFE) {
+            px[0] = op[1]; px[1] = op[2]; px[2] = op[3];
+        } else if (op[0] == 0xFF) {
+            px[0] = op[1]; px[1] = op[2]; px[2] = op[3]; px[3] = op[4];
+        } else {
+            switch (op[0] >> 6) {
+                case 0:
+                    memcpy(px, q->index[op[0]], 4);
+                    break;
+                case 1:
+                    px[0] += ((op[0] >> 4) & 3) - 2;
+                    px[1] += ((op[0] >> 2) & 3) - 2;
+                    px[2] += (op[0] & 3) - 2;
+                    break;
+                case 2: {
+                    int dg = (op[0] & 0x3F) - 32;
+                    px[0] += dg - 8 + (op[1] >> 4);
+                    px[1] += dg;
+                    px[2] += dg - 8 + (op[1] & 0x0F);
+                    break;
+                }
+                default:
+                    run = (op[0] & 0x3F) + 1;
+                    break;
+            }
+        }
+        memcpy(q->index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) & 63], px, 4);
+
+        uint16_t color = to565(px[0], px[1], px[2]);
+        while (run-- > 0 && !emit_done(dec)) {
+            emit(dec, color, px[3]);
+        }
+    }
+    return ESP_OK;
+}
+
+// ===================== PNG =====================
+
+static inline uint8_t paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+// Sample i of a scanline with sub-byte depths, scaled to 8 bits unless raw
+static inline uint8_t sample(const uint8_t *line, int i, int depth, bool raw)
+{
+    int per_byte = 8 / depth;
+    int shift = 8 - depth - (i % per_byte) * depth;
+    int v = (line[i / per_byte] >> shift) & ((1 << depth) - 1);
+    return raw ? v : v * 255 / ((1 << depth) - 1);
+}
+
+// Unfilter the completed scanline in png->line and deliver it
+static esp_err_t png_scanline(image_decoder_t *dec)
+{
+    png_state_t *png = &dec->png;
+    uint8_t *cur = png->line + 1;
+    const uint8_t *prev = png->prev;
+    const int bpp = png->bpp;
+    const size_t n = png->stride;
+
+    switch (png->line[0]) {
+        case 0:
+            break;
+        case 1:
+            for (size_t i = bpp; i < n; i++) cur[i] += cur[i - bpp];
+            break;
+        case 2:
+            for (size_t i = 0; i < n; i++) cur[i] += prev[i];
+            break;
+        case 3:
+            for (size_t i = 0; i < n; i++) {
+                int left = i >= (size_t)bpp ? cur[i - bpp] : 0;
+                cur[i] += (left + prev[i]) >> 1;
+            }
+            break;
+        case 4:
+            for (size_t i = 0; i < n; i++) {
+                int left = i >= (size_t)bpp ? cur[i - bpp] : 0;
+                int upleft = i >= (size_t)bpp ? prev[i - bpp] : 0;
+                cur[i] += paeth(left, prev[i], upleft);
+            }
+            break;
+        default:
+            return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    // 16-bit samples use their high byte
+    const int step = png->depth == 16 ? 2 : 1;
+    for (int x = 0; x < dec->width; x++) {
+        const uint8_t *s = cur + x * png->channels * step;
+        switch (png->color_type) {
+            case 0: {
+                uint8_t v = png->depth < 8 ? sample(cur, x, png->depth, false) : s[0];
+                emit(dec, to565(v, v, v), 0xFF);
+                break;
+            }
+            case 2:
+                emit(dec, to565(s[0], s[step], s[2 * step]), 0xFF);
+                break;
+            case 3: {
+                uint8_t i = png->depth < 8 ? sample(cur, x, png->depth, true) : s[0];
+                emit(dec, png->palette[i], png->palette_alpha[i]);
+                break;
+            }
+            case 4:
+                emit(dec, to565(s[0], s[0], s[0]), s[step]);
+                break;
+            case 6:
+                emit(dec, to565(s[0], s[step], s[2 * step]), s[3 * step]);
+                break;
+        }
+    }
+
+    memcpy(png->prev, cur, n);
+    return ESP_OK;
+}
+
+static esp_err_t png_header(image_decoder_t *dec)
+{
+    png_state_t *png = &dec->png;
+    const uint8_t *h = dec->hold;
+    uint8_t depth = h[8];
+    uint8_t color_type = h[9];
+
+    if (h[10] != 0 || h[11] != 0) return ESP_ERR_INVALID_RESPONSE;
+    if (h[12] != 0) {
+        ESP_LOGW(TAG, "Interlaced PNG not supported");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    switch (color_type) {
+        case 0: png->channels = 1; break;
+        case 2: png->channels = 3; break;
+        case 3: png->channels = 1; break;
+        case 4: png->channels = 2; break;
+        case 6: png->channels = 4; break;
+        default: return ESP_ERR_INVALID_RESPONSE;
+    }
+    bool valid = depth == 8 || (depth == 16 && color_type != 3) ||
+                 ((depth == 1 || depth == 2 || depth == 4) && (color_type == 0 || color_type == 3));
+    if (!valid) return ESP_ERR_INVALID_RESPONSE;
+
+    esp_err_t err = set_size(dec, be32(h), be32(h + 4));
+    if (err != ESP_OK) return err;
+
+    int bits = png->channels * depth;
+    png->depth = depth;
+    png->color_type = color_type;
+    png->bpp = bits >= 8 ? bits / 8 : 1;
+    png->stride = ((size_t)dec->width * bits + 7) / 8;
+    png->line = alloc(png->stride + 1);
+    png->prev = calloc(1, png->stride);
+    png->inflator = alloc(sizeof(tinfl_decompressor));
+    png->window = alloc(TINFL_LZ_DICT_SIZE);
+    if (!png->line || !png->prev || !png->inflator || !png->window) return ESP_ERR_NO_MEM;
+    tinfl_init(png->inflator);
+    memset(png->palette_alpha, 0xFF, sizeof(png->palette_alpha));
+    return ESP_OK;
+}
+
+// Inflate IDAT data, passing scanlines on as they complete
+static esp_err_t png_inflate(image_decoder_t *dec, const uint8_t *p, size_t len)
+{
+    png_state_t *png = &dec->png;
+
+    while (!png->inflate_done) {
+        size_t in_bytes = len;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - png->window_pos;
+        tinfl_status status = tinfl_decompress(png->inflator, p, &in_bytes, png->window,
+                                               png->window + png->window_pos, &out_bytes,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+        p += in_bytes;
+        len -= in_bytes;
+
+        const uint8_t *out = png->window + png->window_pos;
+        png->window_pos = (png->window_pos + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        while (out_bytes > 0 && !emit_done(dec)) {
+            size_t take = png->stride + 1 - png->line_pos;
+            if (take > out_bytes) take = out_bytes;
+            memcpy(png->line + png->line_pos, out, take);
+            png->line_pos += take;
+            out += take;
+            out_bytes -= take;
+            if (png->line_pos == png->stride + 1) {
+                png->line_pos = 0;
+                esp_err_t err = png_scanline(dec);
+                if (err != ESP_OK) return err;
+            }
+        }
+
+        if (status < TINFL_STATUS_DONE) return ESP_ERR_INVALID_RESPONSE;
+        if (status == TINFL_STATUS_DONE) png->inflate_done = true;
+        if (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0) break;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t png_chunk_data(image_decoder_t *dec, const uint8_t *p, size_t len)
+{
+    png_state_t *png = &dec->png;
+
+    switch (png->chunk_type) {
+        case 0x49484452: {  // IHDR
+            size_t take = PNG_IHDR_SIZE - dec->held;
+            if (take > len) take = len;
+            memcpy(dec->hold + dec->held, p, take);
+            dec->held += take;
+            if (dec->held == PNG_IHDR_SIZE && !dec->has_size) return png_header(dec);
+            return ESP_OK;
+        }
+        case 0x504C5445:    // PLTE
+            for (size_t i = 0; i < len; i++, png->palette_pos++) {
+                dec->hold[png->palette_pos % 3] = p[i];
+                if (png->palette_pos % 3 == 2 && png->palette_pos / 3 < 256) {
+                    png->palette[png->palette_pos / 3] = to565(dec->hold[0], dec->hold[1], dec->hold[2]);
+                }
+            }
+            return ESP_OK;
+        case 0x74524E53:    // tRNS (palette images)
+            for (size_t i = 0; i < len; i++, png->palette_pos++) {
+                if (png->color_type == 3 && png->palette_pos < 256) {
+                    png->palette_alpha[png->palette_pos] = p[i];
+                }
+            }
+            return ESP_OK;
+        case 0x49444154:    // IDAT
+            if (!dec->has_size) return ESP_ERR_INVALID_RESPONSE;
+            return png_inflate(dec, p, len);
+        default:
+            return ESP_OK;
+    }
+}
+
+static esp_err_t png_feed(image_decoder_t *dec, const uint8_t *p, size_t len)
+{
+    png_state_t *png = &dec->png;
+
+    while (len > 0 && !emit_done(dec)) {
+        size_t take = png->chunk_left < len ? png->chunk_left : len;
+
+        switch (png->stage) {
+            case PNG_SIGNATURE:
+                for (size_t i = 0; i < take; i++) {
+                    if (p[i] != s_png_signature[8 - png->chunk_left + i]) return ESP_ERR_INVALID_RESPONSE;
+                }
+                break;
+            case PNG_CHUNK_HEAD:
+                memcpy(dec->hold + 8 - png->chunk_left, p, take);
+                break;
+            case PNG_CHUNK_DATA: {
+                esp_err_t err = png_chunk_data(dec, p, take);
+                if (err != ESP_OK) return err;
+                break;
+            }
+            case PNG_CHUNK_CRC:
+                break;
+        }
+        p += take;
+        len -= take;
+        png->chunk_left -= take;
+
+        // Advance through zero-length stages too
+        while (png->chunk_left == 0) {
+            if (png->stage == PNG_CHUNK_HEAD) {
+                png->chunk_left = be32(dec->hold);
+                png->chunk_type = be32(dec->hold + 4);
+                png->stage = PNG_CHUNK_DATA;
+                png->palette_pos = 0;
+                dec->held = 0;
+                if (!dec->has_size && png->chunk_type != 0x49484452) return ESP_ERR_INVALID_RESPONSE;
+                if (png->chunk_type == 0x49454E44) return ESP_ERR_INVALID_RESPONSE;   // IEND before the last row
+            } else if (png->stage == PNG_CHUNK_DATA) {
+                png->stage = PNG_CHUNK_CRC;
+                png->chunk_left = 4;
+            } else {
+                png->stage = PNG_CHUNK_HEAD;
+                png->chunk_left = 8;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+// ===================== Decoder =====================
+
+bool image_decode_sniff(const void *data, size_t len, image_decode_format_t *format)
+{
+    if (len < 4) return false;
+    if (memcmp(data, "qoif", 4) == 0) {
+        *format = IMAGE_DECODE_QOI;
+        return true;
+    }
+    if (memcmp(data, s_png_signature, 4) == 0) {
+        *format = IMAGE_DECODE_PNG;
+        return true;
+    }
+    return false;
+}
+
+size_t image_decode_header_size(image_decode_format_t format)
+{
+    return format == IMAGE_DECODE_QOI ? QOI_HEADER_SIZE : PNG_HEADER_SIZE;
+}
+
+image_decoder_t* image_decoder_create(image_decode_format_t format,
+                                      image_decode_sink_t sink, void *ctx)
+{
+    image_decoder_t *dec = calloc(1, sizeof(image_decoder_t));
+    if (!dec) return NULL;
+    dec->format = format;
+    dec->sink = sink;
+    dec->ctx = ctx;
+    if (format == IMAGE_DECODE_PNG) {
+        dec->png.stage = PNG_SIGNATURE;
+        dec->png.chunk_left = sizeof(s_png_signature);
+    }
+    return dec;
+}
+
+esp_err_t image_decoder_feed(image_decoder_t *dec, const void *data, size_t len)
+{
+    if (dec->format == IMAGE_DECODE_QOI) {
+        return qoi_feed(dec, data, len);
+    }
+    return png_feed(dec, data, len);
+}
+
+bool image_decoder_get_size(const image_decoder_t *dec, int *width, int *height)
+{
+    if (!dec->has_size) return false;
+    *width = dec->width;
+    *height = dec->height;
+    return true;
+}
+
+bool image_decoder_is_done(const image_decoder_t *dec)
+{
+    return emit_done(dec);
+}
+
+void image_decoder_free(image_decoder_t *dec)
+{
+    if (!dec) return;
+    heap_caps_free(dec->pixels);
+    heap_caps_free(dec->alpha);
+    if (dec->format == IMAGE_DECODE_PNG) {
+        heap_caps_free(dec->png.line);
+        free(dec->png.prev);
+        heap_caps_free(dec->png.inflator);
+        heap_caps_free(dec->png.window);
+    }
+    free(dec);
+}
+
+// ===================== Sinks =====================
+
+void image_decode_draw_row(void *ctx, int row, const uint16_t *pixels,
+                           const uint8_t *alpha, int width)
+{
+    const image_decode_target_t *t = ctx;
+    int y = t->y + row;
+
+    if (!alpha) {
+        rgb_display_draw_image(t->x, y, width, 1, pixels);
+        return;
+    }
+
+    const rgb_surface_t *target = rgb_display_get_target();
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    if (!target->pixels || y < clip->y0 || y >= clip->y1) return;
+
+    int x0 = t->x > clip->x0 ? t->x : clip->x0;
+    int x1 = t->x + width < clip->x1 ? t->x + width : clip->x1;
+    uint16_t *dst = &target->pixels[y * target->width];
+    for (int x = x0; x < x1; x++) {
+        uint32_t a = (alpha[x - t->x] + 4) >> 3;
+        if (a >= 32) {
+            dst[x] = pixels[x - t->x];
+        } else if (a) {
+            dst[x] = rgb565_blend(pixels[x - t->x], dst[x], a);
+        }
+    }
+}
+
+void image_decode_image_row(void *ctx, int row, const uint16_t *pixels,
+                            const uint8_t *alpha, int width)
+{
+    const image_decode_image_t *t = ctx;
+    rgb_image_t *image = t->image;
+    if (!image || row >= image->height) return;
+    if (width > image->width) width = image->width;
+
+    uint16_t *dst = (uint16_t *)(image->pixels + (size_t)row * image->stride);
+    for (int x = 0; x < width; x++) {
+        uint32_t a = alpha ? (alpha[x] + 4) >> 3 : 32;
+        dst[x] = a >= 32 ? pixels[x] : rgb565_blend(pixels[x], t->bg, a);
+    }
+}
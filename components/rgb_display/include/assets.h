@@ -0,0 +1,70 @@
+/*
+ * Asset Partition Access
+ *
+ * Read-only named blobs (font packs, images, ...) stored in the "spiffs" data
+ * partition and memory-mapped from flash on demand.
+ *
+ * Partition layout (little-endian):
+ *   assets_header_t
+ *   assets_entry_t[count]
+ *   blob data (each blob 16-byte aligned)
+ *
+ * Images are built with tools/pack_assets.lua.
+ */
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ASSETS_PARTITION_LABEL  "spiffs"
+#define ASSETS_MAGIC            "MDAS"
+#define ASSETS_VERSION          1
+#define ASSETS_NAME_LEN         24
+
+typedef struct {
+    char magic[4];           // "MDAS"
+    uint16_t version;        // ASSETS_VERSION
+    uint16_t count;          // Number of directory entries
+} assets_header_t;
+
+typedef struct {
+    char name[ASSETS_NAME_LEN];  // NUL-padded asset name
+    uint32_t offset;             // Blob offset from partition start
+    uint32_t size;               // Blob size in bytes
+} assets_entry_t;
+
+// A mapped asset; data stays valid until assets_unmap()
+typedef struct {
+    const void *data;
+    size_t size;
+    esp_partition_mmap_handle_t handle;
+} assets_map_t;
+
+/**
+ * Map a named asset from the asset partition into the data address space
+ *
+ * @param name Asset name (as stored in the directory)
+ * @param out Mapping descriptor, filled on success
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the partition or asset is missing,
+ *         ESP_ERR_INVALID_STATE if the partition holds no asset directory
+ */
+esp_err_t assets_map(const char *name, assets_map_t *out);
+
+/**
+ * Release a mapping created by assets_map()
+ */
+void assets_unmap(assets_map_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSETS_H
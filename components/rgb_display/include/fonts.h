@@ -8,6 +8,7 @@
 #define FONTS_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -21,9 +22,13 @@ typedef enum {
     FONT_COUNT
 } font_id_t;
 
+// Fonts loaded at runtime from font packs get IDs FONT_COUNT..FONT_COUNT+FONT_MAX_LOADED-1
+#define FONT_MAX_LOADED 8
+
 // Font glyph descriptor
+// Layout is shared with font pack files (12 bytes, little-endian)
 typedef struct {
-    uint16_t bitmap_offset;  // Offset into bitmap array
+    uint32_t bitmap_offset;  // Offset into bitmap array
     uint8_t width;           // Glyph width in pixels
     uint8_t height;          // Glyph height in pixels  
     int8_t x_offset;         // X offset for rendering
@@ -31,6 +36,16 @@ typedef struct {
     uint8_t x_advance;       // Horizontal advance to next char
 } font_glyph_t;
 
+// Kerning pair (3 bytes, shared with font pack files)
+typedef struct {
+    uint8_t left;            // Left character
+    uint8_t right;           // Right character
+    int8_t adjust;           // Pixels added to the left character's advance
+} font_kern_pair_t;
+
+// Font flags
+#define FONT_FLAG_RLE 0x01       // Bitmaps are run-length encoded (see generate_font.lua)
+
 // Font descriptor
 typedef struct {
     const uint8_t *bitmap;       // Glyph bitmap data
@@ -39,17 +54,99 @@ typedef struct {
     uint8_t last_char;           // Last ASCII character
     uint8_t line_height;         // Line height in pixels
     uint8_t baseline;            // Baseline offset from top
+    const uint16_t *kern_index;  // Pair range per left char (last_char - first_char + 2 entries)
+    const font_kern_pair_t *kern_pairs;  // Kerning pairs sorted by (left, right)
+    uint16_t kern_count;         // Number of kerning pairs (0 = no kerning)
+    uint8_t flags;               // FONT_FLAG_*
 } font_t;
 
+// Font pack file header (see tools/generate_font.lua --pack)
+// Followed by glyph_count font_glyph_t records at glyphs_offset and
+// bitmap_size bytes of bitmap data at bitmap_offset. When kern_count is
+// non-zero, kern_offset holds glyph_count + 1 uint16_t index entries
+// followed by kern_count font_kern_pair_t records.
+#define FONT_PACK_MAGIC   "MDFP"
+#define FONT_PACK_VERSION 2
+
+typedef struct {
+    char magic[4];           // "MDFP"
+    uint16_t version;        // FONT_PACK_VERSION
+    uint8_t first_char;
+    uint8_t last_char;
+    uint8_t line_height;
+    uint8_t baseline;
+    uint16_t glyph_count;    // last_char - first_char + 1
+    uint32_t glyphs_offset;  // From start of pack, 4-byte aligned
+    uint32_t bitmap_offset;  // From start of pack
+    uint32_t bitmap_size;
+    uint32_t kern_offset;    // From start of pack, 0 if no kerning (version 2+)
+    uint16_t kern_count;
+    uint16_t flags;          // FONT_FLAG_* (version 2+)
+} font_pack_header_t;
+
 // Get font by ID
 const font_t* font_get(font_id_t id);
 
+// Check whether an ID refers to a built-in or loaded font
+bool font_is_valid(int id);
+
+// Map a font pack from the asset partition (zero-copy)
+// Returns the new font ID, or -1 if the pack is missing or invalid.
+// Loading the same name twice returns the existing ID.
+int font_pack_load(const char *name);
+
+// Get a loaded font pack by ID (NULL if not loaded)
+const font_t* font_pack_get(int id);
+
 // Get glyph for a character
 const font_glyph_t* font_get_glyph(const font_t *font, char c);
 
-// Calculate string width in pixels
+// Kerning adjustment in pixels between two characters (0 if none)
+int font_get_kerning(const font_t *font, char left, char right);
+
+// Text metrics, as drawn by rgb_display_draw_text_font()
+typedef struct {
+    int width;               // Widest line in pixels
+    int height;              // lines * line_height
+    int lines;               // Number of lines ('\n' separated, 0 for NULL)
+} font_metrics_t;
+
+// Measure width, height and line count in one pass (font NULL = 8x16 default)
+void font_measure(const font_t *font, const char *str, font_metrics_t *out);
+
+// Calculate string width in pixels (widest line)
 int font_string_width(const font_t *font, const char *str);
 
+// Glyph atlas: glyphs pre-expanded to solid spans in internal RAM for the
+// most-used (font, color) pairs, so drawing them needs no bitmap decoding
+#define FONT_ATLAS_PAGES     4     // (font, color) pairs held at once
+#define FONT_ATLAS_SPANS     1024  // Spans per page (3 bytes each)
+#define FONT_ATLAS_GLYPHS    128   // Glyph slots per page (from first_char)
+#define FONT_ATLAS_MAX_GLYPH 64    // Larger glyphs are drawn from the bitmap
+
+typedef struct font_atlas_page font_atlas_page_t;
+
+typedef struct {
+    int pages;               // Pages in use
+    int glyphs;              // Glyphs cached across all pages
+    int spans_used;          // Spans stored across all pages
+    int spans_total;         // FONT_ATLAS_PAGES * FONT_ATLAS_SPANS
+    uint32_t hits;           // Glyphs drawn from the atlas
+    uint32_t misses;         // Glyphs expanded into the atlas, or drawn without it
+    uint32_t evictions;      // Pages reassigned to another (font, color)
+} font_atlas_stats_t;
+
+// Page for drawing a font in a color, claimed on first use (NULL if the
+// font can't be cached). Valid until the next font_atlas_get_page() call.
+font_atlas_page_t* font_atlas_get_page(const font_t *font, uint16_t color);
+
+// Draw a glyph from a page; returns false if the caller must draw it itself
+bool font_atlas_draw_glyph(font_atlas_page_t *page, int x, int y, char c);
+
+// Occupancy and hit counters (reset clears the hit, miss and eviction counts)
+void font_atlas_get_stats(font_atlas_stats_t *out);
+void font_atlas_reset_stats(void);
+
 // Set current font for text rendering
 void rgb_display_set_font(font_id_t id);
 
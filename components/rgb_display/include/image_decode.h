@@ -0,0 +1,93 @@
+/*
+ * Streaming Image Decoders (QOI, PNG)
+ *
+ * Compressed data is pushed in chunks of any size (an HTTP body as it
+ * arrives, or a buffer in flash) and each pixel row is handed to a sink
+ * as soon as it is complete, so no decoded copy of the image is ever
+ * held. The working set is a few rows plus, for PNG, the inflate state
+ * and its 32KB window from the ROM tinfl decoder.
+ *
+ * PNG support: bit depths 1-16, grayscale, RGB, palette (with tRNS) and
+ * alpha color types, not interlaced. Checksums are not verified.
+ */
+
+#ifndef IMAGE_DECODE_H
+#define IMAGE_DECODE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "rgb_display.h"
+#include "rgb_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Widest image accepted (bounds the row buffers)
+#define IMAGE_DECODE_MAX_WIDTH 2048
+
+typedef enum {
+    IMAGE_DECODE_QOI = 0,
+    IMAGE_DECODE_PNG,
+} image_decode_format_t;
+
+// Receives one decoded row: RGB565 pixels and alpha (NULL if the row is
+// fully opaque), width entries each
+typedef void (*image_decode_sink_t)(void *ctx, int row, const uint16_t *pixels,
+                                    const uint8_t *alpha, int width);
+
+typedef struct image_decoder image_decoder_t;
+
+// Detect the format from the first bytes (at least 4); false if unknown
+bool image_decode_sniff(const void *data, size_t len, image_decode_format_t *format);
+
+// Bytes up to and including the image size: feeding exactly this many
+// makes image_decoder_get_size() succeed before any row is delivered
+size_t image_decode_header_size(image_decode_format_t format);
+
+// Create a decoder passing rows to sink; NULL if out of memory
+image_decoder_t* image_decoder_create(image_decode_format_t format,
+                                      image_decode_sink_t sink, void *ctx);
+
+// Push compressed data
+// Returns ESP_OK (also once the image is complete; trailing data is
+// ignored), ESP_ERR_INVALID_RESPONSE for corrupt data,
+// ESP_ERR_NOT_SUPPORTED for unsupported variants or sizes, or
+// ESP_ERR_NO_MEM.
+esp_err_t image_decoder_feed(image_decoder_t *dec, const void *data, size_t len);
+
+// Image size once the header has been read (false before)
+bool image_decoder_get_size(const image_decoder_t *dec, int *width, int *height);
+
+// Whether every row has been delivered
+bool image_decoder_is_done(const image_decoder_t *dec);
+
+void image_decoder_free(image_decoder_t *dec);
+
+// Sink drawing rows into the current drawing target, blending alpha;
+// ctx is an image_decode_target_t
+typedef struct {
+    int x;                   // Top-left of the image on the target
+    int y;
+} image_decode_target_t;
+
+void image_decode_draw_row(void *ctx, int row, const uint16_t *pixels,
+                           const uint8_t *alpha, int width);
+
+// Sink writing rows into an RGB565 image of at least the decoded size,
+// with alpha blended over bg; ctx is an image_decode_image_t
+typedef struct {
+    rgb_image_t *image;
+    uint16_t bg;
+} image_decode_image_t;
+
+void image_decode_image_row(void *ctx, int row, const uint16_t *pixels,
+                            const uint8_t *alpha, int width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMAGE_DECODE_H
@@ -0,0 +1,65 @@
+/*
+ * Baseline JPEG Decoder (ROM TJpgDec)
+ *
+ * Data is pulled through a read callback (a buffer, a flash asset or an
+ * HTTP body) and decoded one MCU block at a time, optionally scaled by
+ * 1/2, 1/4 or 1/8. Each block is converted to RGB565 as it is written to
+ * its destination, so the only working memory is the decoder's pool in
+ * internal RAM (JPEG_DECODE_POOL_SIZE bytes).
+ *
+ * Progressive and arithmetic-coded JPEGs are not supported.
+ */
+
+#ifndef JPEG_DECODE_H
+#define JPEG_DECODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "rgb_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Work area of the ROM TJpgDec, including its 512 byte input buffer
+#define JPEG_DECODE_POOL_SIZE 3100
+
+typedef enum {
+    JPEG_SCALE_1 = 0,
+    JPEG_SCALE_1_2,
+    JPEG_SCALE_1_4,
+    JPEG_SCALE_1_8,
+} jpeg_scale_t;
+
+// Copies up to len bytes of JPEG data into buf, or skips len bytes when
+// buf is NULL; returns the bytes supplied (0 at the end or on error)
+typedef size_t (*jpeg_decode_read_t)(void *ctx, uint8_t *buf, size_t len);
+
+typedef struct jpeg_decoder jpeg_decoder_t;
+
+// Read the headers and prepare decoding
+// Returns ESP_OK, ESP_ERR_INVALID_RESPONSE for corrupt or truncated data,
+// ESP_ERR_NOT_SUPPORTED for progressive JPEGs or ESP_ERR_NO_MEM.
+esp_err_t jpeg_decoder_open(jpeg_decoder_t **out, jpeg_decode_read_t read, void *ctx);
+
+// Image size at a scale (rounded up)
+void jpeg_decoder_get_size(const jpeg_decoder_t *dec, jpeg_scale_t scale, int *width, int *height);
+
+// A decoder decodes once: call either jpeg_decoder_draw() or
+// jpeg_decoder_to_image(), then free it
+
+// Decode into the current drawing target with the top-left at (x, y),
+// honoring the clip
+esp_err_t jpeg_decoder_draw(jpeg_decoder_t *dec, jpeg_scale_t scale, int x, int y);
+
+// Decode into an RGB565 image (pixels beyond its size are dropped)
+esp_err_t jpeg_decoder_to_image(jpeg_decoder_t *dec, jpeg_scale_t scale, rgb_image_t *image);
+
+void jpeg_decoder_free(jpeg_decoder_t *dec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JPEG_DECODE_H
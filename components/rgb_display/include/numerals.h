@@ -0,0 +1,69 @@
+/*
+ * Large Numerals for RGB Display
+ *
+ * Digits, separators and currency signs for clock and price readouts,
+ * stored as run-length outlines (see tools/generate_numerals.lua) and
+ * rasterized by scanline at any cell height.
+ */
+
+#ifndef NUMERALS_H
+#define NUMERALS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Supported cell heights in pixels
+#define NUMERALS_MIN_SIZE 8
+#define NUMERALS_MAX_SIZE 240
+
+// Rendered cells kept in PSRAM, keyed by glyph, size and colors
+#define NUMERALS_CACHE_SIZE 32
+
+// Readouts tracked for partial redraw, and cells per readout
+#define NUMERALS_MAX_READOUTS 8
+#define NUMERALS_MAX_CELLS    24
+
+// Numeral glyph descriptor
+typedef struct {
+    uint16_t codepoint;      // Unicode codepoint
+    uint8_t advance;         // Cell width in master pixels
+    uint16_t runs_offset;    // Offset of the first outline row in runs
+} numeral_glyph_t;
+
+// Numeral outline set
+// Each glyph has height rows. A row is a run count n (0x00-0x7F) followed
+// by n (start, length) byte pairs, or 0x80 | n to repeat the previous row
+// n more times.
+typedef struct {
+    const uint8_t *runs;             // Outline rows for all glyphs
+    const numeral_glyph_t *glyphs;   // Glyph descriptors
+    uint8_t glyph_count;
+    uint8_t height;                  // Master cell height in pixels
+    uint8_t baseline;                // Baseline offset from top of cell
+} numeral_outline_t;
+
+// Width in pixels of text drawn at the given cell height
+int numerals_width(const char *text, int size);
+
+// Draw text with large numerals, cell top-left at (x, y)
+// Characters without a numeral glyph are drawn as blank cells. Calling
+// again with the same x, y and size redraws only the cells whose
+// character or position changed, until the next rgb_display_clear().
+// Returns the text width; cells_drawn (optional) receives the number of
+// cells actually rasterized or copied.
+int numerals_draw(int x, int y, const char *text, int size,
+                  uint16_t color, uint16_t bg_color, int *cells_drawn);
+
+// Forget all readouts so the next numerals_draw() redraws every cell
+// (needed when other drawing covers a readout without clearing the screen)
+void numerals_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NUMERALS_H
@@ -0,0 +1,158 @@
+/*
+ * Draw Command Lists for RGB Display
+ *
+ * Draw calls recorded as compact commands and executed in one pass, either
+ * in recording order or strip by strip so each band of the framebuffer is
+ * finished before the next one is touched, or diffed against the list of
+ * the previous frame so only what changed is drawn.
+ */
+
+#ifndef RGB_CMDLIST_H
+#define RGB_CMDLIST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "rgb_display.h"
+#include "rgb_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Default strip height for strip-ordered execution (25.6KB of framebuffer)
+#define RGB_CMDLIST_STRIP_HEIGHT 16
+
+typedef enum {
+    RGB_CMD_RECT = 0,
+    RGB_CMD_FILL_RECT,
+    RGB_CMD_LINE,
+    RGB_CMD_HLINE,
+    RGB_CMD_VLINE,
+    RGB_CMD_CIRCLE,
+    RGB_CMD_FILL_CIRCLE,
+    RGB_CMD_TEXT,
+    RGB_CMD_IMAGE,
+    RGB_CMD_PIXEL,
+    RGB_CMD_TRIANGLE,
+    RGB_CMD_FILL_TRIANGLE,
+    RGB_CMD_TEXT8,           // Built-in 8x16 font
+    RGB_CMD_TEXT8_BG,        // Built-in 8x16 font on a background color
+    RGB_CMD_NUMERALS,
+    RGB_CMD_CLEAR,
+    RGB_CMD_BITMAP,          // Retained image (rgb_image_t)
+    RGB_CMD_POLYLINE,        // Points in the arena
+    RGB_CMD_FILL_UNDER,
+} rgb_cmd_op_t;
+
+// One draw command; operands a-f are x, y, w, h (rect, image),
+// x0, y0, x1, y1 (line), x, y, length (hline, vline), cx, cy, r (circle),
+// x0, y0, x1, y1, x2, y2 (triangle), x, y, size, bg (numerals),
+// x, y, -, bg (text), x, y, w, h, tint entries, generation (bitmap),
+// count, baseline (polyline, fill under) or x, y (pixel)
+typedef struct {
+    uint8_t op;              // rgb_cmd_op_t
+    uint8_t font;            // Font ID (text)
+    uint16_t color;
+    int16_t a, b, c, d, e, f;
+    int16_t left, top;       // Bounding box of the pixels touched (inclusive)
+    int16_t right, bottom;
+    uint32_t hash;           // Of everything that affects the output
+    union {
+        uint32_t text;                // Offset into the arena (text, numerals, bitmap, points)
+        const uint16_t *pixels;       // RGB565 data, owned by the caller (image)
+    };
+} rgb_cmd_t;
+
+typedef struct {
+    rgb_cmd_t *cmds;
+    int count;
+    int capacity;
+    char *text;              // Arena: NUL-terminated strings of text commands,
+                             // image references and tints of bitmaps, and
+                             // points of polylines
+    size_t text_used;
+    size_t text_capacity;
+} rgb_cmdlist_t;
+
+// Initialize an empty list (no allocation until the first command)
+void rgb_cmdlist_init(rgb_cmdlist_t *list);
+
+// Free the list's storage
+void rgb_cmdlist_free(rgb_cmdlist_t *list);
+
+// Remove all commands, keeping the storage for reuse
+void rgb_cmdlist_reset(rgb_cmdlist_t *list);
+
+// Append commands; each returns false if the list could not grow
+bool rgb_cmdlist_rect(rgb_cmdlist_t *list, int x, int y, int w, int h, uint16_t color, bool filled);
+bool rgb_cmdlist_line(rgb_cmdlist_t *list, int x0, int y0, int x1, int y1, uint16_t color);
+bool rgb_cmdlist_hline(rgb_cmdlist_t *list, int x, int y, int w, uint16_t color);
+bool rgb_cmdlist_vline(rgb_cmdlist_t *list, int x, int y, int h, uint16_t color);
+bool rgb_cmdlist_circle(rgb_cmdlist_t *list, int cx, int cy, int r, uint16_t color, bool filled);
+bool rgb_cmdlist_pixel(rgb_cmdlist_t *list, int x, int y, uint16_t color);
+bool rgb_cmdlist_triangle(rgb_cmdlist_t *list, int x0, int y0, int x1, int y1, int x2, int y2,
+                          uint16_t color, bool filled);
+// points (x, y pairs, count of them) are copied
+bool rgb_cmdlist_polyline(rgb_cmdlist_t *list, const int16_t *points, int count, uint16_t color);
+bool rgb_cmdlist_fill_under(rgb_cmdlist_t *list, const int16_t *points, int count, int baseline,
+                            uint16_t color);
+bool rgb_cmdlist_text(rgb_cmdlist_t *list, int x, int y, const char *text, uint16_t color, int font_id);
+bool rgb_cmdlist_text8(rgb_cmdlist_t *list, int x, int y, const char *text, uint16_t color,
+                       bool use_bg, uint16_t bg_color);
+bool rgb_cmdlist_numerals(rgb_cmdlist_t *list, int x, int y, const char *text, int size,
+                          uint16_t color, uint16_t bg_color);
+
+// Fill the whole screen (within the clip, without counting as a clear)
+bool rgb_cmdlist_clear(rgb_cmdlist_t *list, uint16_t color);
+
+// The pixels are not copied and must stay valid until the list is executed
+bool rgb_cmdlist_image(rgb_cmdlist_t *list, int x, int y, int w, int h, const uint16_t *pixels);
+
+// Copy a surface as it is when the list is executed; a surface drawn
+// into since it was recorded does not match this command
+bool rgb_cmdlist_blit(rgb_cmdlist_t *list, const rgb_surface_t *src, int x, int y);
+
+// Draw a retained image
+// tint (image->palette_size entries) is copied; the image must stay valid
+// until the list is executed, and changing its palette makes the command
+// compare as changed.
+bool rgb_cmdlist_bitmap(rgb_cmdlist_t *list, const rgb_image_t *image, int x, int y,
+                        const uint16_t *tint, uint16_t color);
+
+// Append copies of all commands of src (image pixels are shared)
+bool rgb_cmdlist_append(rgb_cmdlist_t *list, const rgb_cmdlist_t *src);
+
+// Execute all commands within the current clip
+// strip_height 0 runs them in recording order; otherwise the screen is
+// drawn in bands of that many rows, each running the commands that touch
+// it (in recording order) clipped to the band. The result is the same
+// either way.
+void rgb_cmdlist_execute(const rgb_cmdlist_t *list, int strip_height);
+
+// Regions repainted by rgb_cmdlist_execute_diff()
+#define RGB_CMDLIST_MAX_DIRTY 16
+
+typedef struct {
+    int commands;            // Commands in the new list
+    int matched;             // Commands unchanged from the previous list
+    int dirty_rects;         // Regions repainted
+    int dirty_pixels;        // Total area of those regions
+    int executed;            // Command runs (one per region a command touches)
+} rgb_cmdlist_diff_t;
+
+// Bring a screen showing prev up to date with next
+// Commands are matched by hash, in order. The bounds of every unmatched
+// command in either list are repainted by running the commands of next
+// that touch them, clipped to each region; pixels outside them are
+// already correct. next must cover every pixel it owns (typically by
+// starting with a clear). prev NULL executes next in full. Numeral readouts are
+// reset when anything is repainted. stats is optional.
+void rgb_cmdlist_execute_diff(const rgb_cmdlist_t *prev, const rgb_cmdlist_t *next,
+                              rgb_cmdlist_diff_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGB_CMDLIST_H
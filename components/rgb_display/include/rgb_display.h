@@ -40,6 +40,15 @@ extern "C" {
 // Convert RGB888 to RGB565
 #define RGB565(r, g, b) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3))
 
+// Blend fg over bg, alpha 0-32; red/blue and green are computed in parallel
+static inline uint16_t rgb565_blend(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t r = (((f - b) * alpha >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)(r | (r >> 16));
+}
+
 /**
  * Initialize the RGB display
  * 
@@ -69,12 +78,111 @@ void rgb_display_set_backlight(uint8_t brightness);
 // ===================== Drawing Functions =====================
 
 /**
- * Clear the entire screen with a color
+ * Clear the entire drawing target with a color
  * 
  * @param color RGB565 color value
  */
 void rgb_display_clear(uint16_t color);
 
+/**
+ * Get the number of full-screen clears so far
+ * 
+ * Renderers that redraw incrementally compare this with the value seen
+ * at their last draw to detect that their pixels were wiped.
+ * 
+ * @return Clear counter
+ */
+uint32_t rgb_display_get_clear_count(void);
+
+/**
+ * Clip rectangle: x0/y0 inclusive, x1/y1 exclusive
+ */
+typedef struct {
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+} rgb_display_clip_t;
+
+/**
+ * Restrict drawing to a rectangle
+ * 
+ * The rectangle is intersected with the drawing target. All drawing
+ * functions honor the clip except rgb_display_clear().
+ * 
+ * @param x Left edge
+ * @param y Top edge
+ * @param w Width
+ * @param h Height
+ */
+void rgb_display_set_clip(int x, int y, int w, int h);
+
+/**
+ * Reset the clip rectangle to the whole drawing target
+ */
+void rgb_display_reset_clip(void);
+
+/**
+ * Get the current clip rectangle
+ * 
+ * @return Clip rectangle (always within the drawing target)
+ */
+const rgb_display_clip_t* rgb_display_get_clip(void);
+
+/**
+ * Offscreen RGB565 surface (rows of width pixels, no padding)
+ */
+typedef struct {
+    uint16_t *pixels;
+    int width;
+    int height;
+    uint32_t generation;    // Bumped each time it becomes the drawing target
+} rgb_surface_t;
+
+/**
+ * Allocate a surface (contents undefined)
+ * 
+ * @param w Width, at most RGB_DISPLAY_WIDTH
+ * @param h Height, at most RGB_DISPLAY_HEIGHT
+ * @param internal true for internal RAM, false for PSRAM
+ * @return Surface, or NULL if the size is invalid or allocation failed
+ */
+rgb_surface_t* rgb_surface_create(int w, int h, bool internal);
+
+/**
+ * Free a surface; if it is the drawing target, the screen becomes it
+ * 
+ * @param surface Surface from rgb_surface_create(), or NULL
+ */
+void rgb_surface_free(rgb_surface_t *surface);
+
+/**
+ * Redirect all drawing functions to a surface
+ * 
+ * The clip is reset to the whole new target.
+ * 
+ * @param surface Surface to draw into, NULL for the screen
+ */
+void rgb_display_set_target(rgb_surface_t *surface);
+
+/**
+ * Get the current drawing target
+ * 
+ * For the screen, pixels is the framebuffer (NULL before init).
+ * 
+ * @return Drawing target
+ */
+const rgb_surface_t* rgb_display_get_target(void);
+
+/**
+ * Copy a whole surface into the drawing target (clipped)
+ * 
+ * @param src Surface to copy, must not be the target
+ * @param x Top-left X coordinate
+ * @param y Top-left Y coordinate
+ */
+void rgb_display_blit(const rgb_surface_t *src, int x, int y);
+
 /**
  * Draw a single pixel
  * 
@@ -159,6 +267,28 @@ void rgb_display_draw_circle(int cx, int cy, int r, uint16_t color, bool filled)
 void rgb_display_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, 
                                 uint16_t color, bool filled);
 
+/**
+ * Draw connected line segments through a series of points
+ * 
+ * @param points x, y pairs
+ * @param count Number of points
+ * @param color RGB565 color value
+ */
+void rgb_display_draw_polyline(const int16_t *points, int count, uint16_t color);
+
+/**
+ * Fill the area between a series of points and a horizontal baseline
+ * 
+ * Each column from the first to the last point is filled from the line
+ * through the points (included) to the baseline, as in an area chart.
+ * 
+ * @param points x, y pairs
+ * @param count Number of points
+ * @param baseline Y coordinate the fill extends to
+ * @param color RGB565 color value
+ */
+void rgb_display_fill_under(const int16_t *points, int count, int baseline, uint16_t color);
+
 /**
  * Draw text using the built-in 8x16 font
  * 
@@ -0,0 +1,95 @@
+/*
+ * Retained Images for RGB Display
+ *
+ * Images own their pixels (in PSRAM) or reference them in place in the
+ * asset partition, so they are decoded or copied once and drawn straight
+ * from there on every frame.
+ *
+ * Asset image layout (little-endian):
+ *   rgb_image_header_t
+ *   uint16_t palette[palette_size]   (indexed formats)
+ *   pixel rows, stride bytes each
+ */
+
+#ifndef RGB_IMAGE_H
+#define RGB_IMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "assets.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RGB_IMAGE_MAGIC   "MDIM"
+#define RGB_IMAGE_VERSION 1
+
+// No transparent palette index
+#define RGB_IMAGE_NO_KEY  -1
+
+typedef enum {
+    RGB_IMAGE_RGB565 = 0,    // 2 bytes per pixel
+    RGB_IMAGE_INDEXED4,      // 2 pixels per byte, high nibble first
+    RGB_IMAGE_INDEXED8,      // 1 byte per pixel
+    RGB_IMAGE_A8,            // Coverage 0-255, blended in the draw color
+    RGB_IMAGE_FORMAT_COUNT,
+} rgb_image_format_t;
+
+typedef struct {
+    char magic[4];           // "MDIM"
+    uint8_t version;         // RGB_IMAGE_VERSION
+    uint8_t format;          // rgb_image_format_t
+    uint16_t width;
+    uint16_t height;
+    uint16_t palette_size;   // Entries, 0 for RGB565 and A8
+    int16_t key;             // Transparent palette index, RGB_IMAGE_NO_KEY for none
+    uint16_t reserved;
+} rgb_image_header_t;
+
+typedef struct {
+    uint8_t format;          // rgb_image_format_t
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;         // Bytes per row
+    uint16_t palette_size;
+    int16_t key;             // Transparent palette index, RGB_IMAGE_NO_KEY for none
+    uint32_t generation;     // Bumped when the palette or pixels change
+    uint8_t *pixels;         // Writable unless mapped
+    uint16_t *palette;       // RGB565 entries (PSRAM copy, also when mapped)
+    bool mapped;
+    assets_map_t map;
+} rgb_image_t;
+
+// Bytes per row of an image of the given format and width
+size_t rgb_image_stride(rgb_image_format_t format, int width);
+
+// Create an image in PSRAM
+// data (stride bytes per row) and palette are copied when given; with
+// data NULL the pixels are left for a decoder to fill through
+// image->pixels. Returns NULL on invalid arguments (including rows wider
+// than UINT16_MAX bytes) or allocation failure.
+rgb_image_t* rgb_image_create(rgb_image_format_t format, int width, int height,
+                              const void *data, const uint16_t *palette, int palette_size);
+
+// Map an image from the asset partition (pixels used in place from flash)
+// Returns NULL if the asset is missing or not a valid image.
+rgb_image_t* rgb_image_map(const char *name);
+
+// Free an image (and unmap it)
+void rgb_image_free(rgb_image_t *image);
+
+// Replace palette entries starting at first
+void rgb_image_set_palette(rgb_image_t *image, int first, const uint16_t *colors, int count);
+
+// Draw an image with its top-left at (x, y), honoring the clip
+// palette overrides the image's palette (indexed formats, NULL for the
+// image's own); color is the ink of A8 images, blended over the target.
+void rgb_image_draw(const rgb_image_t *image, int x, int y, const uint16_t *palette, uint16_t color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGB_IMAGE_H
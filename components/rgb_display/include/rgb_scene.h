@@ -0,0 +1,151 @@
+/*
+ * Retained Scene Graph
+ *
+ * A tree of group, rect, text and image nodes that keeps each node's
+ * measured size and laid-out box between renders. Setting a property marks
+ * the node dirty (for layout when a size or position can change, otherwise
+ * only for painting), and a render re-lays out and redraws just the parts
+ * of the tree that changed: damaged rectangles are collected from the old
+ * and new boxes of changed nodes and the tree is repainted clipped to each.
+ *
+ * Groups lay their visible children out in a row, a column, or stacked at
+ * their own x, y offsets. Nodes live in internal RAM; text is copied and
+ * images are referenced (the caller keeps them alive).
+ */
+
+#ifndef RGB_SCENE_H
+#define RGB_SCENE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "rgb_image.h"
+#include "fonts.h"
+#include "rgb_display.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Damaged rectangles kept per root before they are merged into one another
+#define RGB_SCENE_MAX_DAMAGE 16
+
+// Width or height taken from the content
+#define RGB_SCENE_AUTO -1
+
+typedef enum {
+    RGB_SCENE_GROUP,
+    RGB_SCENE_RECT,
+    RGB_SCENE_TEXT,
+    RGB_SCENE_IMAGE,
+} rgb_scene_type_t;
+
+typedef enum {
+    RGB_SCENE_STACK,         // Children at their x, y inside the padding
+    RGB_SCENE_ROW,
+    RGB_SCENE_COLUMN,
+} rgb_scene_layout_t;
+
+// Cross-axis alignment of children (and horizontal alignment of text)
+typedef enum {
+    RGB_SCENE_ALIGN_START,
+    RGB_SCENE_ALIGN_CENTER,
+    RGB_SCENE_ALIGN_END,
+    RGB_SCENE_ALIGN_STRETCH, // Auto-sized children fill the cross axis
+} rgb_scene_align_t;
+
+// Main-axis distribution of row and column children
+typedef enum {
+    RGB_SCENE_JUSTIFY_START,
+    RGB_SCENE_JUSTIFY_CENTER,
+    RGB_SCENE_JUSTIFY_END,
+    RGB_SCENE_JUSTIFY_BETWEEN,
+    RGB_SCENE_JUSTIFY_AROUND,
+} rgb_scene_justify_t;
+
+typedef struct {
+    int16_t x, y, width, height;
+} rgb_scene_rect_t;
+
+// Properties of a node; fields a node type doesn't use are ignored
+typedef struct {
+    int16_t x, y;            // Offset in a stacked group, or position of a root
+    int16_t width, height;   // Fixed size or RGB_SCENE_AUTO
+    bool visible;
+
+    uint16_t color;          // Rect fill or outline, text color, A8 image ink
+    bool filled;             // Rect: filled (true) or outline only
+
+    // Group
+    rgb_scene_layout_t layout;
+    int16_t gap;
+    int16_t padding;
+    rgb_scene_align_t align; // Also text alignment (start, center, end)
+    rgb_scene_justify_t justify;
+    bool has_bg;
+    uint16_t bg;             // Group background
+    bool has_border;
+    uint16_t border;         // Outline around a group or rect, over its fill
+
+    font_id_t font;          // Text
+} rgb_scene_props_t;
+
+typedef struct rgb_scene_node rgb_scene_node_t;
+
+// Create a detached node with default properties (visible, auto size,
+// white, filled, start alignment); NULL if out of memory
+rgb_scene_node_t* rgb_scene_node_create(rgb_scene_type_t type);
+
+// Free a node; it is detached from its parent and its children are left
+// detached (not freed)
+void rgb_scene_node_free(rgb_scene_node_t *node);
+
+rgb_scene_type_t rgb_scene_node_type(const rgb_scene_node_t *node);
+
+// Properties are read as a whole and written back as a whole, so a change
+// can be classified (layout or paint only) by comparing the two
+const rgb_scene_props_t* rgb_scene_get_props(const rgb_scene_node_t *node);
+void rgb_scene_set_props(rgb_scene_node_t *node, const rgb_scene_props_t *props);
+
+// Text of a text node (copied); false if out of memory
+bool rgb_scene_set_text(rgb_scene_node_t *node, const char *text);
+const char* rgb_scene_get_text(const rgb_scene_node_t *node);
+
+// Image of an image node (referenced, NULL for none); marks the node dirty
+// also when the image is the same but its pixels were changed
+void rgb_scene_set_image(rgb_scene_node_t *node, const rgb_image_t *image);
+
+// Tree structure: append a child (detaching it from any previous parent);
+// false if the child is the parent or one of its ancestors
+bool rgb_scene_append(rgb_scene_node_t *parent, rgb_scene_node_t *child);
+void rgb_scene_detach(rgb_scene_node_t *node);
+
+rgb_scene_node_t* rgb_scene_parent(const rgb_scene_node_t *node);
+rgb_scene_node_t* rgb_scene_first_child(const rgb_scene_node_t *node);
+rgb_scene_node_t* rgb_scene_next_sibling(const rgb_scene_node_t *node);
+
+// Box from the last render, in target coordinates
+rgb_scene_rect_t rgb_scene_get_box(const rgb_scene_node_t *node);
+
+// Lay out and draw a root node into the current target at its x, y.
+// Only damaged areas are repainted, unless the target changed, it is the
+// screen and was cleared, or rgb_scene_invalidate() was called since the
+// last render. Damage is repainted from the root down, so the root needs a
+// background to erase what moved away. Returns the number of rectangles
+// repainted; pixels (if not NULL) gets their total area.
+int rgb_scene_render(rgb_scene_node_t *root, int *pixels);
+
+// Whether a render into target (NULL for the current target) would draw
+// anything: false when nothing changed since the last render into it
+bool rgb_scene_needs_render(const rgb_scene_node_t *root, const rgb_surface_t *target);
+
+// Repaint the whole root at the next render
+void rgb_scene_invalidate(rgb_scene_node_t *root);
+
+// Topmost visible node under a point (from the last render), or NULL
+rgb_scene_node_t* rgb_scene_hit_test(rgb_scene_node_t *root, int x, int y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGB_SCENE_H
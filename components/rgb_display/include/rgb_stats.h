@@ -0,0 +1,94 @@
+/*
+ * Render Statistics
+ *
+ * Per-primitive counters for the drawing functions: calls, pixels written,
+ * glyphs drawn and CPU cycles spent. Calls made from inside another
+ * primitive (the rows of a filled rect, say) are charged to the outer one,
+ * so the counts describe what the caller asked for.
+ *
+ * The counters cost a cycle count read and a few adds per call. Build with
+ * RGB_DISPLAY_STATS defined to 0 to compile them out.
+ */
+
+#ifndef RGB_STATS_H
+#define RGB_STATS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef RGB_DISPLAY_STATS
+#define RGB_DISPLAY_STATS 1
+#endif
+
+typedef enum {
+    RGB_STATS_CLEAR,
+    RGB_STATS_PIXEL,
+    RGB_STATS_HLINE,
+    RGB_STATS_VLINE,
+    RGB_STATS_LINE,
+    RGB_STATS_RECT,
+    RGB_STATS_CIRCLE,
+    RGB_STATS_TRIANGLE,
+    RGB_STATS_POLYLINE,
+    RGB_STATS_FILL_UNDER,
+    RGB_STATS_TEXT,              // Built-in 8x16 font
+    RGB_STATS_TEXT_FONT,
+    RGB_STATS_BLIT,              // Raw RGB565 data and canvases
+    RGB_STATS_IMAGE,             // rgb_image_t
+    RGB_STATS_NUMERALS,
+    RGB_STATS_COUNT
+} rgb_stats_prim_t;
+
+typedef struct {
+    uint32_t calls;
+    uint32_t pixels;             // Pixels written (after clipping)
+    uint32_t glyphs;             // Characters or numeral cells drawn
+    uint64_t cycles;
+} rgb_stats_entry_t;
+
+// Name of a primitive as used by display.stats() ("fill_under", ...)
+const char* rgb_stats_name(rgb_stats_prim_t prim);
+
+// Copy the counters (all zero when compiled out); window_us is the time
+// since the last reset
+void rgb_stats_get(rgb_stats_entry_t out[RGB_STATS_COUNT], int64_t *window_us);
+void rgb_stats_reset(void);
+
+#if RGB_DISPLAY_STATS
+
+// Running totals the drawing code adds to; a primitive is charged the
+// difference over its call. Drawing happens on one task, so no locking.
+extern uint32_t rgb_stats_pixels;
+extern uint32_t rgb_stats_glyphs;
+
+typedef struct {
+    uint32_t cycles;
+    uint32_t pixels;
+    uint32_t glyphs;
+} rgb_stats_mark_t;
+
+void rgb_stats_begin(rgb_stats_mark_t *mark);
+void rgb_stats_end(rgb_stats_prim_t prim, const rgb_stats_mark_t *mark);
+
+#define RGB_STATS_BEGIN()        rgb_stats_mark_t stats_mark_; rgb_stats_begin(&stats_mark_)
+#define RGB_STATS_END(prim)      rgb_stats_end((prim), &stats_mark_)
+#define RGB_STATS_PIXELS(n)      (rgb_stats_pixels += (uint32_t)(n))
+#define RGB_STATS_GLYPHS(n)      (rgb_stats_glyphs += (uint32_t)(n))
+
+#else
+
+#define RGB_STATS_BEGIN()        do {} while (0)
+#define RGB_STATS_END(prim)      do {} while (0)
+#define RGB_STATS_PIXELS(n)      do {} while (0)
+#define RGB_STATS_GLYPHS(n)      do {} while (0)
+
+#endif // RGB_DISPLAY_STATS
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGB_STATS_H
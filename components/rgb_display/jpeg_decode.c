@@ -0,0 +1,155 @@
+/*
+ * Baseline JPEG Decoder
+ *
+ * Thin wrapper around the TJpgDec in the ESP32-S3 ROM. The ROM version
+ * outputs RGB888 blocks; the output callback converts each block while
+ * copying it into the destination rows, clipped, so no decoded copy is
+ * made and no second pass runs over the pixels.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "jpeg_decode.h"
+#include "rgb_display.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp32s3/rom/tjpgd.h"
+
+static const char *TAG = "JPEG_DECODE";
+
+// Where decoded blocks go: rows of stride pixels, clipped to x0..x1, y0..y1
+typedef struct {
+    uint16_t *pixels;
+    int stride;
+    int x, y;                   // Position of the image's top-left
+    int x0, y0, x1, y1;
+} jpeg_dest_t;
+
+struct jpeg_decoder {
+    JDEC jd;
+    void *pool;
+    jpeg_decode_read_t read;
+    void *ctx;
+    jpeg_dest_t dest;
+    bool used;
+};
+
+static esp_err_t to_esp_err(JRESULT res)
+{
+    switch (res) {
+        case JDR_OK:   return ESP_OK;
+        case JDR_MEM1:
+        case JDR_MEM2: return ESP_ERR_NO_MEM;
+        case JDR_FMT2:
+        case JDR_FMT3: return ESP_ERR_NOT_SUPPORTED;
+        default:       return ESP_ERR_INVALID_RESPONSE;
+    }
+}
+
+static uint32_t jpeg_input(JDEC *jd, uint8_t *buf, uint32_t len)
+{
+    jpeg_decoder_t *dec = jd->device;
+    return dec->read(dec->ctx, buf, len);
+}
+
+// Convert an RGB888 block into the destination; rect is inclusive
+static uint32_t jpeg_output(JDEC *jd, void *bitmap, JRECT *rect)
+{
+    const jpeg_decoder_t *dec = jd->device;
+    const jpeg_dest_t *d = &dec->dest;
+    const int w = rect->right - rect->left + 1;
+    const int left = d->x + rect->left;
+
+    int x0 = left > d->x0 ? left : d->x0;
+    int x1 = left + w < d->x1 ? left + w : d->x1;
+    if (x1 <= x0) return 1;
+
+    const uint8_t *src = bitmap;
+    for (int row = rect->top; row <= rect->bottom; row++, src += w * 3) {
+        int y = d->y + row;
+        if (y < d->y0 || y >= d->y1) continue;
+
+        const uint8_t *s = src + (x0 - left) * 3;
+        uint16_t *dst = &d->pixels[y * d->stride + x0];
+        for (int n = x1 - x0; n > 0; n--, s += 3) {
+            *dst++ = ((s[0] & 0xF8) << 8) | ((s[1] & 0xFC) << 3) | (s[2] >> 3);
+        }
+    }
+    return 1;
+}
+
+esp_err_t jpeg_decoder_open(jpeg_decoder_t **out, jpeg_decode_read_t read, void *ctx)
+{
+    *out = NULL;
+    jpeg_decoder_t *dec = calloc(1, sizeof(jpeg_decoder_t));
+    if (!dec) return ESP_ERR_NO_MEM;
+
+    // The pool holds the Huffman and quantization tables and is hit for
+    // every coefficient, so it stays in internal RAM
+    dec->pool = heap_caps_malloc(JPEG_DECODE_POOL_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!dec->pool) {
+        free(dec);
+        return ESP_ERR_NO_MEM;
+    }
+    dec->read = read;
+    dec->ctx = ctx;
+
+    JRESULT res = jd_prepare(&dec->jd, jpeg_input, dec->pool, JPEG_DECODE_POOL_SIZE, dec);
+    if (res != JDR_OK) {
+        ESP_LOGW(TAG, "JPEG header rejected: %d", res);
+        jpeg_decoder_free(dec);
+        return to_esp_err(res);
+    }
+    *out = dec;
+    return ESP_OK;
+}
+
+void jpeg_decoder_get_size(const jpeg_decoder_t *dec, jpeg_scale_t scale, int *width, int *height)
+{
+    int round = (1 << scale) - 1;
+    *width = (dec->jd.width + round) >> scale;
+    *height = (dec->jd.height + round) >> scale;
+}
+
+static esp_err_t decompress(jpeg_decoder_t *dec, jpeg_scale_t scale)
+{
+    if (dec->used || scale > JPEG_SCALE_1_8) return ESP_ERR_INVALID_STATE;
+    dec->used = true;
+    return to_esp_err(jd_decomp(&dec->jd, jpeg_output, scale));
+}
+
+esp_err_t jpeg_decoder_draw(jpeg_decoder_t *dec, jpeg_scale_t scale, int x, int y)
+{
+    const rgb_surface_t *target = rgb_display_get_target();
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    if (!target->pixels) return ESP_ERR_INVALID_STATE;
+
+    dec->dest = (jpeg_dest_t) {
+        .pixels = target->pixels,
+        .stride = target->width,
+        .x = x, .y = y,
+        .x0 = clip->x0, .y0 = clip->y0, .x1 = clip->x1, .y1 = clip->y1,
+    };
+    return decompress(dec, scale);
+}
+
+esp_err_t jpeg_decoder_to_image(jpeg_decoder_t *dec, jpeg_scale_t scale, rgb_image_t *image)
+{
+    if (image->format != RGB_IMAGE_RGB565 || image->mapped) return ESP_ERR_INVALID_ARG;
+
+    dec->dest = (jpeg_dest_t) {
+        .pixels = (uint16_t *)image->pixels,
+        .stride = image->stride / sizeof(uint16_t),
+        .x1 = image->width, .y1 = image->height,
+    };
+    esp_err_t err = decompress(dec, scale);
+    image->generation++;
+    return err;
+}
+
+void jpeg_decoder_free(jpeg_decoder_t *dec)
+{
+    if (!dec) return;
+    heap_caps_free(dec->pool);
+    free(dec);
+}
@@ -0,0 +1,360 @@
+/*
+ * Large Numerals - scanline rasterizer with cell cache
+ *
+ * Glyph outlines are scaled from a single master (numerals_inter.c) with
+ * 4x4 supersampling and blended between the foreground and background
+ * colors. Rendered cells are memoized per glyph, size and colors in PSRAM
+ * and copied into the framebuffer row by row. Readouts remember which
+ * cells they drew so a ticking clock only touches the digits that changed.
+ */
+
+#include <string.h>
+#include "numerals.h"
+#include "rgb_display.h"
+#include "rgb_stats.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "NUMERALS";
+
+extern const numeral_outline_t numerals_inter;
+
+#define SUBSAMPLES 4
+
+typedef struct {
+    const numeral_glyph_t *glyph;   // NULL = blank cell
+    uint16_t size;
+    uint16_t color;
+    uint16_t bg_color;
+    uint16_t width;
+    uint32_t last_used;
+    uint16_t *pixels;               // width * size RGB565
+    size_t capacity;                // Allocated pixels
+} cell_cache_entry_t;
+
+typedef struct {
+    bool used;
+    int16_t x;
+    int16_t y;
+    uint16_t size;
+    uint16_t color;
+    uint16_t bg_color;
+    uint16_t width;
+    uint8_t count;
+    uint32_t clear_count;
+    uint32_t last_used;
+    const numeral_glyph_t *glyphs[NUMERALS_MAX_CELLS];
+    int16_t cell_x[NUMERALS_MAX_CELLS];
+} readout_t;
+
+typedef struct {
+    const uint8_t *next;    // Next encoded row
+    const uint8_t *row;     // Current row (run count byte)
+    int y;                  // Current row index
+    int repeat;             // Pending repeats of the current row
+} outline_cursor_t;
+
+static const numeral_outline_t *s_outline = &numerals_inter;
+static cell_cache_entry_t s_cache[NUMERALS_CACHE_SIZE];
+static readout_t s_readouts[NUMERALS_MAX_READOUTS];
+static uint32_t s_use_counter = 0;
+
+static const numeral_glyph_t *find_glyph(uint32_t codepoint)
+{
+    for (int i = 0; i < s_outline->glyph_count; i++) {
+        if (s_outline->glyphs[i].codepoint == codepoint) {
+            return &s_outline->glyphs[i];
+        }
+    }
+    return NULL;
+}
+
+// Decode one UTF-8 sequence; invalid bytes decode as U+FFFD
+static uint32_t next_codepoint(const char **text)
+{
+    const uint8_t *s = (const uint8_t *)*text;
+    uint32_t cp = 0xFFFD;
+    int len = 1;
+
+    if (s[0] < 0x80) {
+        cp = s[0];
+    } else if ((s[0] & 0xE0) == 0xC0 && (s[1] & 0xC0) == 0x80) {
+        cp = ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        len = 2;
+    } else if ((s[0] & 0xF0) == 0xE0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        cp = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        len = 3;
+    }
+    *text += len;
+    return cp;
+}
+
+static int cell_width(const numeral_glyph_t *glyph, int size)
+{
+    int advance;
+    if (glyph) {
+        advance = glyph->advance;
+    } else {
+        // Blank cells are half a digit wide
+        const numeral_glyph_t *zero = find_glyph('0');
+        advance = zero ? zero->advance / 2 : s_outline->height / 4;
+    }
+    int width = (advance * size + s_outline->height / 2) / s_outline->height;
+    return width < RGB_DISPLAY_WIDTH ? width : RGB_DISPLAY_WIDTH;
+}
+
+// Lay out text as cells; returns the number of cells and the total width
+static int layout_cells(const char *text, int size, const numeral_glyph_t **glyphs,
+                        int16_t *cell_x, int *width)
+{
+    int count = 0;
+    int x = 0;
+    while (*text && count < NUMERALS_MAX_CELLS) {
+        const numeral_glyph_t *glyph = find_glyph(next_codepoint(&text));
+        glyphs[count] = glyph;
+        cell_x[count] = x;
+        x += cell_width(glyph, size);
+        count++;
+    }
+    *width = x;
+    return count;
+}
+
+// Advance to outline row target (targets must not decrease)
+static const uint8_t *cursor_seek(outline_cursor_t *cur, int target)
+{
+    while (cur->y < target) {
+        if (cur->repeat > 0) {
+            cur->repeat--;
+            cur->y++;
+            continue;
+        }
+        uint8_t code = *cur->next;
+        if (code & 0x80) {
+            cur->repeat = code & 0x7F;
+            cur->next++;
+            continue;
+        }
+        cur->row = cur->next;
+        cur->next += 1 + code * 2;
+        cur->y++;
+    }
+    return cur->row;
+}
+
+static inline uint16_t blend565(uint16_t fg, uint16_t bg, int alpha)
+{
+    // alpha in 0..SUBSAMPLES*SUBSAMPLES
+    const int max = SUBSAMPLES * SUBSAMPLES;
+    int r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * (max - alpha)) / max;
+    int g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (max - alpha)) / max;
+    int b = ((fg & 0x1F) * alpha + (bg & 0x1F) * (max - alpha)) / max;
+    return (r << 11) | (g << 5) | b;
+}
+
+// Rasterize one glyph into a width x size RGB565 cell
+static void rasterize_cell(const numeral_glyph_t *glyph, int width, int size,
+                           uint16_t color, uint16_t bg_color, uint16_t *out)
+{
+    static uint8_t coverage[RGB_DISPLAY_WIDTH];
+    const int master = s_outline->height;
+    const int sub_rows = size * SUBSAMPLES;
+
+    if (!glyph) {
+        for (int i = 0; i < width * size; i++) out[i] = bg_color;
+        return;
+    }
+
+    outline_cursor_t cur = {
+        .next = s_outline->runs + glyph->runs_offset,
+        .row = NULL,
+        .y = -1,
+        .repeat = 0,
+    };
+
+    for (int y = 0; y < size; y++) {
+        memset(coverage, 0, width);
+
+        for (int s = 0; s < SUBSAMPLES; s++) {
+            // Sample the master row under the center of this sub-scanline
+            int src_y = ((y * SUBSAMPLES + s) * 2 + 1) * master / (sub_rows * 2);
+            const uint8_t *row = cursor_seek(&cur, src_y);
+            int runs = row[0];
+
+            for (int r = 0; r < runs; r++) {
+                int start = row[1 + r * 2];
+                int end = start + row[2 + r * 2];
+                // Span in quarter pixels of the output cell
+                int q0 = (start * size * SUBSAMPLES + master / 2) / master;
+                int q1 = (end * size * SUBSAMPLES + master / 2) / master;
+                if (q1 > width * SUBSAMPLES) q1 = width * SUBSAMPLES;
+                for (int q = q0; q < q1; q++) {
+                    coverage[q / SUBSAMPLES]++;
+                }
+            }
+        }
+
+        uint16_t *dst = &out[y * width];
+        for (int x = 0; x < width; x++) {
+            int a = coverage[x];
+            dst[x] = a == 0 ? bg_color : a == SUBSAMPLES * SUBSAMPLES ? color : blend565(color, bg_color, a);
+        }
+    }
+}
+
+// Find or render a cell; returns NULL if it could not be allocated
+static const cell_cache_entry_t *get_cell(const numeral_glyph_t *glyph, int size,
+                                          uint16_t color, uint16_t bg_color)
+{
+    cell_cache_entry_t *victim = &s_cache[0];
+    for (int i = 0; i < NUMERALS_CACHE_SIZE; i++) {
+        cell_cache_entry_t *e = &s_cache[i];
+        if (e->pixels && e->glyph == glyph && e->size == size &&
+            e->color == color && e->bg_color == bg_color) {
+            e->last_used = ++s_use_counter;
+            return e;
+        }
+        if (e->last_used < victim->last_used) victim = e;
+    }
+
+    int width = cell_width(glyph, size);
+    size_t needed = (size_t)width * size;
+    if (needed > victim->capacity) {
+        heap_caps_free(victim->pixels);
+        victim->pixels = heap_caps_malloc(needed * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+        victim->capacity = victim->pixels ? needed : 0;
+        if (!victim->pixels) {
+            ESP_LOGE(TAG, "Failed to allocate %dx%d cell", width, size);
+            victim->last_used = 0;
+            return NULL;
+        }
+    }
+
+    rasterize_cell(glyph, width, size, color, bg_color, victim->pixels);
+    victim->glyph = glyph;
+    victim->size = size;
+    victim->color = color;
+    victim->bg_color = bg_color;
+    victim->width = width;
+    victim->last_used = ++s_use_counter;
+    return victim;
+}
+
+static void blit_cell(int x, int y, const cell_cache_entry_t *cell)
+{
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (!target->pixels) return;
+
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    int x0 = x < clip->x0 ? clip->x0 : x;
+    int x1 = x + cell->width > clip->x1 ? clip->x1 : x + cell->width;
+    if (x1 <= x0) return;
+
+    for (int row = 0; row < cell->size; row++) {
+        int py = y + row;
+        if (py < clip->y0 || py >= clip->y1) continue;
+        memcpy(&target->pixels[py * target->width + x0], &cell->pixels[row * cell->width + (x0 - x)],
+               (x1 - x0) * sizeof(uint16_t));
+        RGB_STATS_PIXELS(x1 - x0);
+    }
+}
+
+static readout_t *find_readout(int x, int y, int size)
+{
+    readout_t *victim = &s_readouts[0];
+    for (int i = 0; i < NUMERALS_MAX_READOUTS; i++) {
+        readout_t *r = &s_readouts[i];
+        if (r->used && r->x == x && r->y == y && r->size == size) {
+            return r;
+        }
+        if (r->last_used < victim->last_used) victim = r;
+    }
+    victim->used = false;
+    victim->x = x;
+    victim->y = y;
+    victim->size = size;
+    return victim;
+}
+
+int numerals_width(const char *text, int size)
+{
+    if (!text || size < NUMERALS_MIN_SIZE || size > NUMERALS_MAX_SIZE) return 0;
+
+    const numeral_glyph_t *glyphs[NUMERALS_MAX_CELLS];
+    int16_t cell_x[NUMERALS_MAX_CELLS];
+    int width;
+    layout_cells(text, size, glyphs, cell_x, &width);
+    return width;
+}
+
+static int draw_readout(int x, int y, const char *text, int size,
+                        uint16_t color, uint16_t bg_color, int *cells_drawn)
+{
+    if (cells_drawn) *cells_drawn = 0;
+    if (!text || size < NUMERALS_MIN_SIZE || size > NUMERALS_MAX_SIZE) return 0;
+
+    const numeral_glyph_t *glyphs[NUMERALS_MAX_CELLS];
+    int16_t cell_x[NUMERALS_MAX_CELLS];
+    int width;
+    int count = layout_cells(text, size, glyphs, cell_x, &width);
+
+    // Cells are only skipped on the screen, and only remembered when the
+    // clip let the whole readout through: a cell it hid was never drawn
+    const rgb_surface_t *target = rgb_display_get_target();
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    bool on_screen = target->pixels == rgb_display_get_framebuffer();
+    bool whole = on_screen && x >= clip->x0 && y >= clip->y0 &&
+                 x + width <= clip->x1 && y + size <= clip->y1;
+
+    readout_t *r = find_readout(x, y, size);
+    uint32_t clear_count = rgb_display_get_clear_count();
+    bool valid = on_screen && r->used && r->clear_count == clear_count &&
+                 r->color == color && r->bg_color == bg_color;
+    int drawn = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (valid && i < r->count && r->glyphs[i] == glyphs[i] && r->cell_x[i] == cell_x[i]) {
+            continue;
+        }
+        const cell_cache_entry_t *cell = get_cell(glyphs[i], size, color, bg_color);
+        if (!cell) {
+            r->used = false;
+            return width;
+        }
+        blit_cell(x + cell_x[i], y, cell);
+        RGB_STATS_GLYPHS(1);
+        drawn++;
+    }
+
+    // Erase whatever the previous, longer text left behind
+    if (valid && r->width > width) {
+        rgb_display_draw_rect(x + width, y, r->width - width, size, bg_color, true);
+    }
+
+    r->used = whole;
+    r->color = color;
+    r->bg_color = bg_color;
+    r->width = width;
+    r->count = count;
+    r->clear_count = clear_count;
+    r->last_used = ++s_use_counter;
+    memcpy(r->glyphs, glyphs, count * sizeof(glyphs[0]));
+    memcpy(r->cell_x, cell_x, count * sizeof(cell_x[0]));
+
+    if (cells_drawn) *cells_drawn = drawn;
+    return width;
+}
+
+int numerals_draw(int x, int y, const char *text, int size,
+                  uint16_t color, uint16_t bg_color, int *cells_drawn)
+{
+    RGB_STATS_BEGIN();
+    int width = draw_readout(x, y, text, size, color, bg_color, cells_drawn);
+    RGB_STATS_END(RGB_STATS_NUMERALS);
+    return width;
+}
+
+void numerals_reset(void)
+{
+    memset(s_readouts, 0, sizeof(s_readouts));
+}
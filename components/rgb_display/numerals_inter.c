@@ -0,0 +1,366 @@
+/*
+ * Large Numerals - Run-length outlines
+ * Generated from: fonts/Inter/Inter24-SemiBold.ttf
+ * Master size: 120 (cell height 120, baseline 100)
+ */
+
+#include "numerals.h"
+
+static const uint8_t numerals_inter_runs[] = {
+    // 0 (U+0030) - 321 bytes
+    0x00, 0x8A, 0x01, 0x24, 0x06, 0x01, 0x1E, 0x12, 0x01, 0x1B, 0x18, 0x01, 
+    0x19, 0x1C, 0x01, 0x17, 0x20, 0x01, 0x15, 0x24, 0x01, 0x14, 0x26, 0x01, 
+    0x13, 0x28, 0x01, 0x12, 0x2A, 0x01, 0x11, 0x2C, 0x01, 0x10, 0x2E, 0x01, 
+    0x0F, 0x30, 0x01, 0x0E, 0x32, 0x02, 0x0D, 0x17, 0x29, 0x17, 0x02, 0x0D, 
+    0x14, 0x2D, 0x14, 0x02, 0x0C, 0x13, 0x2F, 0x13, 0x02, 0x0B, 0x13, 0x30, 
+    0x12, 0x02, 0x0B, 0x11, 0x31, 0x12, 0x02, 0x0A, 0x11, 0x32, 0x11, 0x02, 
+    0x0A, 0x11, 0x33, 0x11, 0x02, 0x09, 0x11, 0x34, 0x10, 0x02, 0x09, 0x10, 
+    0x34, 0x11, 0x02, 0x09, 0x10, 0x35, 0x10, 0x02, 0x08, 0x10, 0x35, 0x10, 
+    0x02, 0x08, 0x10, 0x36, 0x10, 0x02, 0x08, 0x0F, 0x36, 0x10, 0x02, 0x07, 
+    0x10, 0x37, 0x0F, 0x02, 0x07, 0x10, 0x37, 0x10, 0x02, 0x07, 0x0F, 0x37, 
+    0x10, 0x02, 0x07, 0x0F, 0x38, 0x0F, 0x02, 0x06, 0x10, 0x38, 0x0F, 0x81, 
+    0x02, 0x06, 0x0F, 0x38, 0x10, 0x02, 0x06, 0x0F, 0x39, 0x0F, 0x83, 0x02, 
+    0x05, 0x10, 0x39, 0x0F, 0x02, 0x05, 0x0F, 0x39, 0x0F, 0x81, 0x02, 0x05, 
+    0x0F, 0x39, 0x10, 0x82, 0x02, 0x05, 0x0F, 0x3A, 0x0F, 0x84, 0x02, 0x05, 
+    0x0F, 0x39, 0x10, 0x81, 0x02, 0x05, 0x0F, 0x39, 0x0F, 0x82, 0x02, 0x05, 
+    0x10, 0x39, 0x0F, 0x02, 0x06, 0x0F, 0x39, 0x0F, 0x83, 0x02, 0x06, 0x0F, 
+    0x38, 0x10, 0x02, 0x06, 0x10, 0x38, 0x0F, 0x81, 0x02, 0x07, 0x0F, 0x38, 
+    0x0F, 0x02, 0x07, 0x0F, 0x37, 0x10, 0x02, 0x07, 0x10, 0x37, 0x10, 0x02, 
+    0x07, 0x10, 0x37, 0x0F, 0x02, 0x08, 0x0F, 0x36, 0x10, 0x02, 0x08, 0x10, 
+    0x36, 0x10, 0x02, 0x08, 0x10, 0x35, 0x10, 0x02, 0x09, 0x10, 0x35, 0x10, 
+    0x02, 0x09, 0x10, 0x34, 0x11, 0x02, 0x0A, 0x10, 0x34, 0x10, 0x02, 0x0A, 
+    0x11, 0x33, 0x11, 0x02, 0x0A, 0x12, 0x32, 0x11, 0x02, 0x0B, 0x12, 0x31, 
+    0x12, 0x02, 0x0C, 0x12, 0x30, 0x12, 0x02, 0x0C, 0x13, 0x2E, 0x14, 0x02, 
+    0x0D, 0x15, 0x2C, 0x15, 0x01, 0x0D, 0x33, 0x01, 0x0E, 0x32, 0x01, 0x0F, 
+    0x30, 0x01, 0x10, 0x2E, 0x01, 0x11, 0x2C, 0x01, 0x12, 0x2A, 0x01, 0x13, 
+    0x28, 0x01, 0x14, 0x26, 0x01, 0x16, 0x22, 0x01, 0x17, 0x1F, 0x01, 0x19, 
+    0x1C, 0x01, 0x1C, 0x16, 0x01, 0x1F, 0x10, 0x00, 0x92, 
+    // 1 (U+0031) - 120 bytes
+    0x00, 0x8C, 0x01, 0x26, 0x11, 0x01, 0x25, 0x12, 0x01, 0x23, 0x14, 0x01, 
+    0x22, 0x15, 0x01, 0x20, 0x17, 0x01, 0x1F, 0x18, 0x01, 0x1D, 0x1A, 0x01, 
+    0x1C, 0x1B, 0x01, 0x1A, 0x1D, 0x01, 0x19, 0x1E, 0x01, 0x17, 0x20, 0x01, 
+    0x16, 0x21, 0x01, 0x14, 0x23, 0x01, 0x13, 0x24, 0x02, 0x13, 0x14, 0x28, 
+    0x0F, 0x02, 0x13, 0x12, 0x28, 0x0F, 0x02, 0x13, 0x11, 0x28, 0x0F, 0x02, 
+    0x13, 0x0F, 0x28, 0x0F, 0x02, 0x13, 0x0E, 0x28, 0x0F, 0x02, 0x13, 0x0C, 
+    0x28, 0x0F, 0x02, 0x13, 0x0B, 0x28, 0x0F, 0x02, 0x13, 0x09, 0x28, 0x0F, 
+    0x02, 0x13, 0x08, 0x28, 0x0F, 0x02, 0x13, 0x07, 0x28, 0x0F, 0x02, 0x13, 
+    0x05, 0x28, 0x0F, 0x02, 0x13, 0x04, 0x28, 0x0F, 0x02, 0x13, 0x02, 0x28, 
+    0x0F, 0x02, 0x13, 0x01, 0x28, 0x0F, 0x01, 0x28, 0x0F, 0xBA, 0x00, 0x93, 
+    // 2 (U+0032) - 239 bytes
+    0x00, 0x8A, 0x01, 0x24, 0x06, 0x01, 0x1E, 0x12, 0x01, 0x1B, 0x19, 0x01, 
+    0x18, 0x1E, 0x01, 0x16, 0x22, 0x01, 0x15, 0x25, 0x01, 0x13, 0x28, 0x01, 
+    0x12, 0x2A, 0x01, 0x11, 0x2C, 0x01, 0x10, 0x2E, 0x01, 0x0F, 0x30, 0x01, 
+    0x0E, 0x32, 0x01, 0x0E, 0x33, 0x02, 0x0D, 0x16, 0x2B, 0x16, 0x02, 0x0D, 
+    0x13, 0x2E, 0x14, 0x02, 0x0C, 0x12, 0x30, 0x12, 0x02, 0x0C, 0x11, 0x31, 
+    0x12, 0x02, 0x0B, 0x11, 0x32, 0x11, 0x02, 0x0B, 0x10, 0x33, 0x10, 0x02, 
+    0x0A, 0x10, 0x34, 0x10, 0x81, 0x02, 0x0A, 0x0F, 0x35, 0x0F, 0x81, 0x02, 
+    0x09, 0x0F, 0x35, 0x10, 0x02, 0x09, 0x0F, 0x36, 0x0F, 0x84, 0x02, 0x09, 
+    0x0E, 0x36, 0x0F, 0x01, 0x36, 0x0E, 0x01, 0x35, 0x0F, 0x82, 0x01, 0x34, 
+    0x10, 0x01, 0x34, 0x0F, 0x01, 0x33, 0x10, 0x01, 0x33, 0x0F, 0x01, 0x32, 
+    0x10, 0x01, 0x31, 0x10, 0x01, 0x30, 0x11, 0x01, 0x2F, 0x11, 0x81, 0x01, 
+    0x2E, 0x11, 0x01, 0x2D, 0x11, 0x01, 0x2C, 0x11, 0x01, 0x2B, 0x12, 0x01, 
+    0x2A, 0x12, 0x01, 0x29, 0x12, 0x01, 0x27, 0x13, 0x01, 0x26, 0x13, 0x01, 
+    0x25, 0x13, 0x01, 0x24, 0x13, 0x01, 0x23, 0x13, 0x01, 0x22, 0x13, 0x01, 
+    0x21, 0x13, 0x01, 0x20, 0x13, 0x01, 0x1F, 0x13, 0x01, 0x1E, 0x13, 0x01, 
+    0x1D, 0x13, 0x01, 0x1C, 0x13, 0x01, 0x1A, 0x14, 0x01, 0x19, 0x14, 0x01, 
+    0x18, 0x14, 0x01, 0x17, 0x13, 0x01, 0x16, 0x13, 0x01, 0x15, 0x13, 0x01, 
+    0x14, 0x13, 0x01, 0x13, 0x13, 0x01, 0x12, 0x13, 0x01, 0x11, 0x13, 0x01, 
+    0x10, 0x13, 0x01, 0x0F, 0x13, 0x01, 0x0D, 0x14, 0x01, 0x0C, 0x14, 0x01, 
+    0x0B, 0x14, 0x01, 0x0A, 0x3B, 0x01, 0x09, 0x3D, 0x8B, 0x00, 0x93, 
+    // 3 (U+0033) - 300 bytes
+    0x00, 0x8A, 0x01, 0x24, 0x05, 0x01, 0x1D, 0x13, 0x01, 0x1A, 0x19, 0x01, 
+    0x17, 0x1F, 0x01, 0x15, 0x23, 0x01, 0x14, 0x25, 0x01, 0x12, 0x29, 0x01, 
+    0x11, 0x2B, 0x01, 0x10, 0x2D, 0x01, 0x0F, 0x2F, 0x01, 0x0E, 0x31, 0x01, 
+    0x0D, 0x33, 0x01, 0x0C, 0x34, 0x02, 0x0C, 0x15, 0x2B, 0x16, 0x02, 0x0B, 
+    0x14, 0x2E, 0x13, 0x02, 0x0B, 0x12, 0x30, 0x12, 0x02, 0x0A, 0x11, 0x31, 
+    0x11, 0x02, 0x0A, 0x10, 0x32, 0x11, 0x02, 0x09, 0x11, 0x33, 0x10, 0x02, 
+    0x09, 0x10, 0x33, 0x10, 0x02, 0x09, 0x0F, 0x34, 0x0F, 0x02, 0x09, 0x0F, 
+    0x34, 0x10, 0x02, 0x08, 0x10, 0x35, 0x0F, 0x02, 0x08, 0x0F, 0x35, 0x0F, 
+    0x82, 0x02, 0x09, 0x0E, 0x35, 0x0F, 0x01, 0x35, 0x0F, 0x81, 0x01, 0x34, 
+    0x0F, 0x82, 0x01, 0x33, 0x0F, 0x01, 0x32, 0x10, 0x01, 0x31, 0x10, 0x01, 
+    0x30, 0x11, 0x01, 0x2E, 0x12, 0x01, 0x2C, 0x13, 0x01, 0x1E, 0x20, 0x01, 
+    0x1D, 0x20, 0x01, 0x1D, 0x1E, 0x01, 0x1D, 0x1D, 0x01, 0x1D, 0x1A, 0x01, 
+    0x1D, 0x17, 0x01, 0x1D, 0x19, 0x01, 0x1D, 0x1D, 0x01, 0x1D, 0x1F, 0x01, 
+    0x1D, 0x21, 0x01, 0x1D, 0x22, 0x01, 0x1D, 0x23, 0x01, 0x28, 0x19, 0x01, 
+    0x2D, 0x15, 0x01, 0x2F, 0x14, 0x01, 0x31, 0x13, 0x01, 0x33, 0x11, 0x01, 
+    0x34, 0x11, 0x01, 0x35, 0x10, 0x01, 0x35, 0x11, 0x01, 0x36, 0x10, 0x81, 
+    0x01, 0x37, 0x0F, 0x01, 0x37, 0x10, 0x81, 0x02, 0x06, 0x10, 0x37, 0x10, 
+    0x81, 0x02, 0x07, 0x0F, 0x37, 0x10, 0x81, 0x02, 0x07, 0x10, 0x37, 0x10, 
+    0x02, 0x07, 0x10, 0x36, 0x10, 0x81, 0x02, 0x08, 0x10, 0x35, 0x11, 0x02, 
+    0x08, 0x11, 0x35, 0x11, 0x02, 0x08, 0x11, 0x34, 0x11, 0x02, 0x09, 0x11, 
+    0x33, 0x12, 0x02, 0x09, 0x13, 0x31, 0x14, 0x02, 0x0A, 0x13, 0x30, 0x14, 
+    0x02, 0x0A, 0x16, 0x2D, 0x16, 0x02, 0x0B, 0x1B, 0x27, 0x1C, 0x01, 0x0C, 
+    0x36, 0x01, 0x0C, 0x35, 0x01, 0x0D, 0x33, 0x01, 0x0E, 0x31, 0x01, 0x0F, 
+    0x2F, 0x01, 0x10, 0x2D, 0x01, 0x12, 0x2A, 0x01, 0x13, 0x27, 0x01, 0x15, 
+    0x23, 0x01, 0x17, 0x1F, 0x01, 0x1A, 0x19, 0x01, 0x1E, 0x11, 0x00, 0x92, 
+    // 4 (U+0034) - 244 bytes
+    0x00, 0x8C, 0x01, 0x2B, 0x13, 0x01, 0x2A, 0x14, 0x01, 0x29, 0x15, 0x01, 
+    0x28, 0x16, 0x81, 0x01, 0x27, 0x17, 0x01, 0x26, 0x18, 0x81, 0x01, 0x25, 
+    0x19, 0x01, 0x24, 0x1A, 0x81, 0x01, 0x23, 0x1B, 0x01, 0x22, 0x1C, 0x81, 
+    0x01, 0x21, 0x1D, 0x01, 0x20, 0x1E, 0x81, 0x02, 0x1F, 0x0F, 0x30, 0x0E, 
+    0x02, 0x1E, 0x10, 0x30, 0x0E, 0x02, 0x1E, 0x0F, 0x30, 0x0E, 0x02, 0x1D, 
+    0x0F, 0x30, 0x0E, 0x02, 0x1C, 0x10, 0x30, 0x0E, 0x02, 0x1C, 0x0F, 0x30, 
+    0x0E, 0x02, 0x1B, 0x0F, 0x30, 0x0E, 0x02, 0x1A, 0x10, 0x30, 0x0E, 0x02, 
+    0x1A, 0x0F, 0x30, 0x0E, 0x02, 0x19, 0x0F, 0x30, 0x0E, 0x02, 0x18, 0x10, 
+    0x30, 0x0E, 0x02, 0x18, 0x0F, 0x30, 0x0E, 0x02, 0x17, 0x0F, 0x30, 0x0E, 
+    0x02, 0x16, 0x10, 0x30, 0x0E, 0x02, 0x16, 0x0F, 0x30, 0x0E, 0x02, 0x15, 
+    0x0F, 0x30, 0x0E, 0x02, 0x14, 0x10, 0x30, 0x0E, 0x02, 0x14, 0x0F, 0x30, 
+    0x0E, 0x02, 0x13, 0x0F, 0x30, 0x0E, 0x02, 0x12, 0x0F, 0x30, 0x0E, 0x81, 
+    0x02, 0x11, 0x0F, 0x30, 0x0E, 0x02, 0x10, 0x0F, 0x30, 0x0E, 0x02, 0x0F, 
+    0x10, 0x30, 0x0E, 0x02, 0x0F, 0x0F, 0x30, 0x0E, 0x02, 0x0E, 0x0F, 0x30, 
+    0x0E, 0x02, 0x0D, 0x10, 0x30, 0x0E, 0x02, 0x0D, 0x0F, 0x30, 0x0E, 0x02, 
+    0x0C, 0x0F, 0x30, 0x0E, 0x02, 0x0B, 0x10, 0x30, 0x0E, 0x02, 0x0B, 0x0F, 
+    0x30, 0x0E, 0x02, 0x0A, 0x0F, 0x30, 0x0E, 0x02, 0x09, 0x10, 0x30, 0x0E, 
+    0x02, 0x09, 0x0F, 0x30, 0x0E, 0x02, 0x08, 0x0F, 0x30, 0x0E, 0x02, 0x07, 
+    0x10, 0x30, 0x0E, 0x02, 0x07, 0x0F, 0x30, 0x0E, 0x02, 0x06, 0x0F, 0x30, 
+    0x0E, 0x02, 0x05, 0x10, 0x30, 0x0E, 0x01, 0x05, 0x45, 0x8C, 0x01, 0x2F, 
+    0x0F, 0x91, 0x00, 0x93, 
+    // 5 (U+0035) - 228 bytes
+    0x00, 0x8C, 0x01, 0x0D, 0x34, 0x83, 0x01, 0x0C, 0x35, 0x88, 0x01, 0x0C, 
+    0x0E, 0x83, 0x01, 0x0B, 0x0F, 0x83, 0x01, 0x0B, 0x0E, 0x87, 0x02, 0x0B, 
+    0x0E, 0x24, 0x0D, 0x02, 0x0B, 0x0E, 0x20, 0x14, 0x02, 0x0A, 0x0F, 0x1E, 
+    0x18, 0x02, 0x0A, 0x0E, 0x1C, 0x1C, 0x02, 0x0A, 0x0E, 0x1B, 0x1F, 0x02, 
+    0x0A, 0x0E, 0x1A, 0x21, 0x02, 0x0A, 0x0E, 0x19, 0x23, 0x01, 0x0A, 0x34, 
+    0x01, 0x0A, 0x35, 0x81, 0x01, 0x0A, 0x36, 0x01, 0x0A, 0x37, 0x02, 0x0A, 
+    0x18, 0x2B, 0x17, 0x02, 0x0A, 0x15, 0x2E, 0x14, 0x02, 0x0A, 0x13, 0x30, 
+    0x13, 0x02, 0x0A, 0x11, 0x31, 0x12, 0x02, 0x09, 0x11, 0x32, 0x12, 0x02, 
+    0x09, 0x10, 0x33, 0x11, 0x02, 0x09, 0x0F, 0x34, 0x10, 0x02, 0x13, 0x05, 
+    0x35, 0x10, 0x01, 0x35, 0x10, 0x01, 0x36, 0x0F, 0x81, 0x01, 0x36, 0x10, 
+    0x01, 0x37, 0x0F, 0x88, 0x02, 0x08, 0x0F, 0x37, 0x0F, 0x81, 0x02, 0x08, 
+    0x0F, 0x36, 0x10, 0x02, 0x08, 0x10, 0x36, 0x0F, 0x02, 0x08, 0x10, 0x35, 
+    0x10, 0x02, 0x09, 0x0F, 0x35, 0x10, 0x02, 0x09, 0x10, 0x34, 0x10, 0x02, 
+    0x09, 0x11, 0x34, 0x10, 0x02, 0x0A, 0x11, 0x33, 0x11, 0x02, 0x0A, 0x12, 
+    0x32, 0x11, 0x02, 0x0A, 0x13, 0x31, 0x12, 0x02, 0x0B, 0x13, 0x2F, 0x13, 
+    0x02, 0x0C, 0x15, 0x2D, 0x15, 0x02, 0x0C, 0x19, 0x29, 0x18, 0x01, 0x0D, 
+    0x33, 0x01, 0x0E, 0x32, 0x01, 0x0F, 0x30, 0x01, 0x10, 0x2E, 0x01, 0x11, 
+    0x2C, 0x01, 0x12, 0x29, 0x01, 0x13, 0x27, 0x01, 0x15, 0x24, 0x01, 0x17, 
+    0x20, 0x01, 0x19, 0x1C, 0x01, 0x1B, 0x17, 0x01, 0x1F, 0x0F, 0x00, 0x92, 
+    // 6 (U+0036) - 349 bytes
+    0x00, 0x8A, 0x01, 0x26, 0x05, 0x01, 0x1F, 0x12, 0x01, 0x1C, 0x18, 0x01, 
+    0x1A, 0x1D, 0x01, 0x18, 0x20, 0x01, 0x17, 0x23, 0x01, 0x15, 0x26, 0x01, 
+    0x14, 0x29, 0x01, 0x13, 0x2B, 0x01, 0x12, 0x2D, 0x01, 0x11, 0x2F, 0x01, 
+    0x10, 0x30, 0x01, 0x0F, 0x32, 0x02, 0x0F, 0x16, 0x2B, 0x17, 0x02, 0x0E, 
+    0x14, 0x2F, 0x13, 0x02, 0x0D, 0x13, 0x30, 0x13, 0x02, 0x0D, 0x11, 0x32, 
+    0x11, 0x02, 0x0C, 0x11, 0x33, 0x11, 0x02, 0x0C, 0x10, 0x34, 0x10, 0x02, 
+    0x0B, 0x10, 0x34, 0x10, 0x02, 0x0B, 0x0F, 0x35, 0x10, 0x02, 0x0A, 0x10, 
+    0x36, 0x0F, 0x02, 0x0A, 0x0F, 0x36, 0x0F, 0x81, 0x02, 0x09, 0x0F, 0x37, 
+    0x0F, 0x01, 0x09, 0x0F, 0x01, 0x09, 0x0E, 0x01, 0x08, 0x0F, 0x81, 0x01, 
+    0x08, 0x0E, 0x82, 0x02, 0x07, 0x0F, 0x23, 0x0F, 0x02, 0x07, 0x0F, 0x20, 
+    0x15, 0x02, 0x07, 0x0E, 0x1E, 0x19, 0x02, 0x07, 0x0E, 0x1C, 0x1D, 0x02, 
+    0x07, 0x0E, 0x1B, 0x20, 0x02, 0x07, 0x0E, 0x1A, 0x22, 0x02, 0x07, 0x0E, 
+    0x19, 0x24, 0x02, 0x06, 0x0F, 0x18, 0x26, 0x02, 0x06, 0x0F, 0x17, 0x28, 
+    0x02, 0x06, 0x0F, 0x16, 0x2A, 0x01, 0x06, 0x3B, 0x01, 0x06, 0x3C, 0x02, 
+    0x06, 0x1C, 0x2C, 0x16, 0x02, 0x06, 0x1A, 0x2F, 0x14, 0x02, 0x06, 0x18, 
+    0x30, 0x13, 0x02, 0x06, 0x17, 0x32, 0x12, 0x02, 0x06, 0x16, 0x33, 0x11, 
+    0x02, 0x06, 0x15, 0x34, 0x11, 0x02, 0x06, 0x14, 0x34, 0x11, 0x02, 0x06, 
+    0x13, 0x35, 0x10, 0x02, 0x06, 0x13, 0x36, 0x10, 0x02, 0x06, 0x12, 0x36, 
+    0x10, 0x02, 0x06, 0x12, 0x37, 0x0F, 0x81, 0x02, 0x06, 0x11, 0x37, 0x0F, 
+    0x02, 0x07, 0x10, 0x37, 0x0F, 0x81, 0x02, 0x07, 0x10, 0x38, 0x0E, 0x82, 
+    0x02, 0x07, 0x10, 0x37, 0x0F, 0x02, 0x08, 0x0F, 0x37, 0x0F, 0x82, 0x02, 
+    0x08, 0x10, 0x37, 0x0F, 0x02, 0x09, 0x0F, 0x36, 0x10, 0x02, 0x09, 0x10, 
+    0x36, 0x10, 0x02, 0x09, 0x10, 0x35, 0x10, 0x02, 0x0A, 0x10, 0x35, 0x10, 
+    0x02, 0x0A, 0x10, 0x34, 0x11, 0x02, 0x0B, 0x10, 0x33, 0x11, 0x02, 0x0B, 
+    0x11, 0x32, 0x12, 0x02, 0x0C, 0x12, 0x31, 0x12, 0x02, 0x0C, 0x13, 0x2F, 
+    0x14, 0x02, 0x0D, 0x14, 0x2D, 0x15, 0x02, 0x0D, 0x18, 0x29, 0x19, 0x01, 
+    0x0E, 0x33, 0x01, 0x0F, 0x31, 0x01, 0x10, 0x2F, 0x01, 0x11, 0x2D, 0x01, 
+    0x12, 0x2B, 0x01, 0x13, 0x29, 0x01, 0x14, 0x27, 0x01, 0x16, 0x23, 0x01, 
+    0x17, 0x20, 0x01, 0x19, 0x1C, 0x01, 0x1C, 0x17, 0x01, 0x20, 0x0F, 0x00, 
+    0x92, 
+    // 7 (U+0037) - 168 bytes
+    0x00, 0x8C, 0x01, 0x09, 0x3B, 0x8C, 0x01, 0x34, 0x10, 0x01, 0x33, 0x10, 
+    0x81, 0x01, 0x32, 0x10, 0x81, 0x01, 0x31, 0x10, 0x81, 0x01, 0x30, 0x10, 
+    0x81, 0x01, 0x2F, 0x10, 0x81, 0x01, 0x2E, 0x10, 0x81, 0x01, 0x2D, 0x10, 
+    0x81, 0x01, 0x2C, 0x10, 0x81, 0x01, 0x2B, 0x10, 0x81, 0x01, 0x2A, 0x10, 
+    0x81, 0x01, 0x29, 0x10, 0x81, 0x01, 0x28, 0x10, 0x81, 0x01, 0x27, 0x10, 
+    0x81, 0x01, 0x26, 0x10, 0x81, 0x01, 0x25, 0x10, 0x81, 0x01, 0x24, 0x10, 
+    0x81, 0x01, 0x23, 0x10, 0x81, 0x01, 0x22, 0x10, 0x81, 0x01, 0x21, 0x10, 
+    0x81, 0x01, 0x20, 0x10, 0x81, 0x01, 0x1F, 0x10, 0x81, 0x01, 0x1E, 0x10, 
+    0x81, 0x01, 0x1D, 0x10, 0x81, 0x01, 0x1C, 0x10, 0x81, 0x01, 0x1B, 0x10, 
+    0x81, 0x01, 0x1A, 0x10, 0x81, 0x01, 0x19, 0x10, 0x81, 0x01, 0x18, 0x10, 
+    0x81, 0x01, 0x17, 0x10, 0x01, 0x16, 0x11, 0x01, 0x16, 0x10, 0x01, 0x15, 
+    0x11, 0x01, 0x15, 0x10, 0x01, 0x14, 0x11, 0x01, 0x14, 0x10, 0x01, 0x13, 
+    0x11, 0x01, 0x13, 0x10, 0x01, 0x12, 0x11, 0x01, 0x12, 0x10, 0x01, 0x11, 
+    0x10, 0x81, 0x01, 0x10, 0x10, 0x81, 0x01, 0x0F, 0x10, 0x81, 0x00, 0x93, 
+    // 8 (U+0038) - 334 bytes
+    0x00, 0x8A, 0x01, 0x24, 0x06, 0x01, 0x1E, 0x13, 0x01, 0x1A, 0x1A, 0x01, 
+    0x18, 0x1E, 0x01, 0x16, 0x22, 0x01, 0x14, 0x26, 0x01, 0x13, 0x28, 0x01, 
+    0x12, 0x2B, 0x01, 0x11, 0x2D, 0x01, 0x10, 0x2F, 0x01, 0x0F, 0x31, 0x01, 
+    0x0E, 0x32, 0x01, 0x0D, 0x34, 0x02, 0x0D, 0x14, 0x2D, 0x15, 0x02, 0x0C, 
+    0x13, 0x2F, 0x13, 0x02, 0x0C, 0x12, 0x31, 0x12, 0x02, 0x0B, 0x12, 0x32, 
+    0x11, 0x02, 0x0B, 0x11, 0x33, 0x10, 0x02, 0x0B, 0x10, 0x33, 0x11, 0x02, 
+    0x0B, 0x0F, 0x34, 0x10, 0x02, 0x0A, 0x10, 0x34, 0x10, 0x02, 0x0A, 0x10, 
+    0x35, 0x0F, 0x02, 0x0A, 0x0F, 0x35, 0x0F, 0x85, 0x02, 0x0B, 0x0E, 0x35, 
+    0x0F, 0x02, 0x0B, 0x0F, 0x35, 0x0F, 0x02, 0x0B, 0x0F, 0x34, 0x0F, 0x02, 
+    0x0B, 0x10, 0x34, 0x0F, 0x02, 0x0C, 0x0F, 0x33, 0x0F, 0x02, 0x0C, 0x10, 
+    0x32, 0x10, 0x02, 0x0D, 0x10, 0x31, 0x10, 0x02, 0x0E, 0x10, 0x30, 0x11, 
+    0x02, 0x0E, 0x12, 0x2F, 0x11, 0x02, 0x0F, 0x13, 0x2C, 0x13, 0x01, 0x10, 
+    0x2E, 0x01, 0x11, 0x2C, 0x01, 0x13, 0x28, 0x01, 0x15, 0x25, 0x01, 0x17, 
+    0x20, 0x01, 0x1A, 0x1B, 0x01, 0x17, 0x21, 0x01, 0x14, 0x26, 0x01, 0x12, 
+    0x2A, 0x01, 0x10, 0x2E, 0x01, 0x0F, 0x30, 0x01, 0x0E, 0x32, 0x02, 0x0D, 
+    0x16, 0x2B, 0x16, 0x02, 0x0C, 0x14, 0x2F, 0x13, 0x02, 0x0B, 0x13, 0x31, 
+    0x12, 0x02, 0x0B, 0x11, 0x32, 0x12, 0x02, 0x0A, 0x11, 0x33, 0x11, 0x02, 
+    0x09, 0x11, 0x34, 0x11, 0x02, 0x09, 0x10, 0x35, 0x10, 0x02, 0x09, 0x10, 
+    0x36, 0x10, 0x02, 0x08, 0x10, 0x36, 0x10, 0x02, 0x08, 0x10, 0x37, 0x10, 
+    0x02, 0x08, 0x0F, 0x37, 0x10, 0x02, 0x07, 0x10, 0x37, 0x10, 0x81, 0x02, 
+    0x07, 0x10, 0x38, 0x0F, 0x82, 0x02, 0x07, 0x10, 0x37, 0x10, 0x82, 0x02, 
+    0x07, 0x11, 0x37, 0x10, 0x02, 0x08, 0x10, 0x36, 0x11, 0x02, 0x08, 0x11, 
+    0x36, 0x11, 0x02, 0x08, 0x11, 0x35, 0x11, 0x02, 0x08, 0x12, 0x34, 0x12, 
+    0x02, 0x09, 0x12, 0x33, 0x13, 0x02, 0x09, 0x14, 0x32, 0x13, 0x02, 0x0A, 
+    0x14, 0x30, 0x14, 0x02, 0x0B, 0x16, 0x2D, 0x17, 0x01, 0x0B, 0x38, 0x01, 
+    0x0C, 0x36, 0x01, 0x0D, 0x34, 0x01, 0x0E, 0x32, 0x01, 0x0F, 0x30, 0x01, 
+    0x10, 0x2E, 0x01, 0x12, 0x2B, 0x01, 0x13, 0x28, 0x01, 0x15, 0x24, 0x01, 
+    0x17, 0x20, 0x01, 0x1A, 0x1A, 0x01, 0x1E, 0x12, 0x00, 0x92, 
+    // 9 (U+0039) - 344 bytes
+    0x00, 0x8A, 0x01, 0x22, 0x07, 0x01, 0x1C, 0x12, 0x01, 0x19, 0x19, 0x01, 
+    0x16, 0x1E, 0x01, 0x14, 0x22, 0x01, 0x13, 0x24, 0x01, 0x11, 0x28, 0x01, 
+    0x10, 0x2A, 0x01, 0x0F, 0x2C, 0x01, 0x0E, 0x2E, 0x01, 0x0D, 0x30, 0x01, 
+    0x0C, 0x32, 0x01, 0x0B, 0x34, 0x02, 0x0B, 0x17, 0x29, 0x16, 0x02, 0x0A, 
+    0x15, 0x2C, 0x14, 0x02, 0x0A, 0x13, 0x2E, 0x13, 0x02, 0x09, 0x12, 0x2F, 
+    0x12, 0x02, 0x09, 0x11, 0x31, 0x11, 0x02, 0x08, 0x11, 0x32, 0x10, 0x02, 
+    0x08, 0x10, 0x32, 0x10, 0x02, 0x07, 0x11, 0x33, 0x10, 0x02, 0x07, 0x10, 
+    0x34, 0x0F, 0x02, 0x07, 0x10, 0x34, 0x10, 0x02, 0x07, 0x0F, 0x35, 0x0F, 
+    0x81, 0x02, 0x06, 0x10, 0x35, 0x10, 0x02, 0x06, 0x0F, 0x35, 0x10, 0x02, 
+    0x06, 0x0F, 0x36, 0x0F, 0x82, 0x02, 0x06, 0x0F, 0x36, 0x10, 0x82, 0x02, 
+    0x06, 0x0F, 0x35, 0x11, 0x02, 0x06, 0x10, 0x35, 0x11, 0x81, 0x02, 0x07, 
+    0x0F, 0x35, 0x11, 0x02, 0x07, 0x10, 0x34, 0x12, 0x81, 0x02, 0x07, 0x11, 
+    0x33, 0x13, 0x02, 0x08, 0x10, 0x32, 0x14, 0x02, 0x08, 0x11, 0x31, 0x15, 
+    0x02, 0x08, 0x12, 0x30, 0x16, 0x02, 0x09, 0x12, 0x2F, 0x17, 0x02, 0x09, 
+    0x14, 0x2E, 0x18, 0x02, 0x0A, 0x15, 0x2C, 0x1A, 0x02, 0x0B, 0x17, 0x28, 
+    0x1E, 0x01, 0x0B, 0x3B, 0x02, 0x0C, 0x2B, 0x38, 0x0E, 0x02, 0x0D, 0x29, 
+    0x38, 0x0E, 0x02, 0x0E, 0x27, 0x38, 0x0E, 0x02, 0x0F, 0x26, 0x38, 0x0E, 
+    0x02, 0x10, 0x24, 0x38, 0x0E, 0x02, 0x11, 0x21, 0x37, 0x0F, 0x02, 0x13, 
+    0x1E, 0x37, 0x0F, 0x02, 0x14, 0x1B, 0x37, 0x0F, 0x02, 0x16, 0x18, 0x37, 
+    0x0E, 0x02, 0x19, 0x12, 0x37, 0x0E, 0x02, 0x1D, 0x0A, 0x37, 0x0E, 0x01, 
+    0x37, 0x0E, 0x01, 0x36, 0x0F, 0x01, 0x36, 0x0E, 0x81, 0x01, 0x35, 0x0F, 
+    0x81, 0x01, 0x35, 0x0E, 0x02, 0x07, 0x0F, 0x34, 0x0F, 0x81, 0x02, 0x07, 
+    0x10, 0x33, 0x0F, 0x81, 0x02, 0x08, 0x10, 0x32, 0x10, 0x02, 0x08, 0x10, 
+    0x31, 0x10, 0x02, 0x08, 0x11, 0x30, 0x11, 0x02, 0x09, 0x11, 0x2F, 0x11, 
+    0x02, 0x09, 0x12, 0x2E, 0x12, 0x02, 0x0A, 0x12, 0x2C, 0x13, 0x02, 0x0A, 
+    0x15, 0x2A, 0x14, 0x01, 0x0B, 0x33, 0x01, 0x0C, 0x31, 0x01, 0x0C, 0x30, 
+    0x01, 0x0D, 0x2E, 0x01, 0x0E, 0x2C, 0x01, 0x0F, 0x2A, 0x01, 0x10, 0x28, 
+    0x01, 0x11, 0x26, 0x01, 0x13, 0x23, 0x01, 0x15, 0x1F, 0x01, 0x16, 0x1C, 
+    0x01, 0x19, 0x17, 0x01, 0x1C, 0x10, 0x00, 0x92, 
+    // : (U+003A) - 96 bytes
+    0x00, 0xA6, 0x01, 0x0C, 0x08, 0x01, 0x0B, 0x0B, 0x01, 0x0A, 0x0D, 0x01, 
+    0x09, 0x0F, 0x01, 0x08, 0x11, 0x81, 0x01, 0x07, 0x12, 0x01, 0x07, 0x13, 
+    0x82, 0x01, 0x07, 0x12, 0x01, 0x08, 0x11, 0x81, 0x01, 0x08, 0x10, 0x01, 
+    0x09, 0x0F, 0x01, 0x0A, 0x0D, 0x01, 0x0B, 0x0A, 0x01, 0x0D, 0x06, 0x00, 
+    0x99, 0x01, 0x0C, 0x08, 0x01, 0x0B, 0x0B, 0x01, 0x0A, 0x0D, 0x01, 0x09, 
+    0x0F, 0x01, 0x08, 0x11, 0x81, 0x01, 0x07, 0x12, 0x01, 0x07, 0x13, 0x82, 
+    0x01, 0x07, 0x12, 0x01, 0x08, 0x11, 0x81, 0x01, 0x08, 0x10, 0x01, 0x09, 
+    0x0F, 0x01, 0x0A, 0x0D, 0x01, 0x0B, 0x0A, 0x01, 0x0D, 0x06, 0x00, 0x92, 
+    // . (U+002E) - 49 bytes
+    0x00, 0xD2, 0x01, 0x0C, 0x08, 0x01, 0x0B, 0x0B, 0x01, 0x0A, 0x0D, 0x01, 
+    0x09, 0x0F, 0x01, 0x08, 0x11, 0x81, 0x01, 0x07, 0x12, 0x01, 0x07, 0x13, 
+    0x82, 0x01, 0x07, 0x12, 0x01, 0x08, 0x11, 0x81, 0x01, 0x08, 0x10, 0x01, 
+    0x09, 0x0F, 0x01, 0x0A, 0x0D, 0x01, 0x0B, 0x0A, 0x01, 0x0D, 0x06, 0x00, 
+    0x92, 
+    // , (U+002C) - 53 bytes
+    0x00, 0xD6, 0x01, 0x0A, 0x0F, 0x01, 0x09, 0x0F, 0x82, 0x01, 0x09, 0x0E, 
+    0x83, 0x01, 0x08, 0x0E, 0x82, 0x01, 0x08, 0x0D, 0x82, 0x01, 0x07, 0x0E, 
+    0x01, 0x07, 0x0D, 0x82, 0x01, 0x07, 0x0C, 0x82, 0x01, 0x06, 0x0D, 0x01, 
+    0x06, 0x0C, 0x82, 0x01, 0x06, 0x0B, 0x82, 0x01, 0x05, 0x0C, 0x01, 0x05, 
+    0x0B, 0x82, 0x01, 0x05, 0x0A, 
+    // - (U+002D) - 14 bytes
+    0x00, 0xB9, 0x01, 0x08, 0x26, 0x01, 0x07, 0x28, 0x8A, 0x01, 0x08, 0x26, 
+    0x00, 0xB0, 
+    // $ (U+0024) - 374 bytes
+    0x01, 0x23, 0x08, 0x01, 0x22, 0x09, 0x89, 0x01, 0x22, 0x0A, 0x01, 0x1D, 
+    0x14, 0x01, 0x19, 0x1C, 0x01, 0x17, 0x20, 0x01, 0x14, 0x25, 0x01, 0x13, 
+    0x28, 0x01, 0x11, 0x2B, 0x01, 0x10, 0x2E, 0x01, 0x0F, 0x30, 0x01, 0x0E, 
+    0x32, 0x01, 0x0D, 0x34, 0x01, 0x0C, 0x35, 0x01, 0x0B, 0x37, 0x01, 0x0A, 
+    0x39, 0x03, 0x0A, 0x16, 0x22, 0x09, 0x2D, 0x16, 0x03, 0x09, 0x14, 0x22, 
+    0x09, 0x30, 0x14, 0x03, 0x09, 0x13, 0x22, 0x09, 0x32, 0x12, 0x03, 0x08, 
+    0x12, 0x22, 0x09, 0x33, 0x12, 0x03, 0x08, 0x11, 0x22, 0x09, 0x34, 0x11, 
+    0x03, 0x08, 0x10, 0x22, 0x09, 0x35, 0x11, 0x03, 0x07, 0x11, 0x22, 0x09, 
+    0x36, 0x10, 0x03, 0x07, 0x10, 0x22, 0x09, 0x36, 0x10, 0x03, 0x07, 0x10, 
+    0x22, 0x09, 0x37, 0x0F, 0x81, 0x03, 0x07, 0x10, 0x22, 0x09, 0x37, 0x10, 
+    0x03, 0x07, 0x10, 0x22, 0x09, 0x38, 0x0F, 0x81, 0x02, 0x07, 0x10, 0x22, 
+    0x09, 0x82, 0x02, 0x07, 0x11, 0x22, 0x09, 0x02, 0x07, 0x12, 0x22, 0x09, 
+    0x02, 0x08, 0x12, 0x22, 0x09, 0x02, 0x08, 0x14, 0x22, 0x09, 0x02, 0x08, 
+    0x15, 0x22, 0x09, 0x02, 0x09, 0x17, 0x22, 0x09, 0x01, 0x09, 0x22, 0x01, 
+    0x0A, 0x21, 0x01, 0x0B, 0x21, 0x01, 0x0B, 0x24, 0x01, 0x0C, 0x27, 0x01, 
+    0x0D, 0x29, 0x01, 0x0E, 0x2A, 0x01, 0x10, 0x2B, 0x01, 0x11, 0x2C, 0x01, 
+    0x13, 0x2B, 0x01, 0x15, 0x2B, 0x01, 0x17, 0x2A, 0x01, 0x1A, 0x28, 0x01, 
+    0x1D, 0x26, 0x01, 0x21, 0x23, 0x01, 0x22, 0x23, 0x81, 0x02, 0x22, 0x09, 
+    0x2D, 0x19, 0x02, 0x22, 0x09, 0x30, 0x16, 0x02, 0x22, 0x09, 0x32, 0x15, 
+    0x02, 0x22, 0x09, 0x34, 0x13, 0x02, 0x22, 0x09, 0x36, 0x12, 0x02, 0x22, 
+    0x09, 0x37, 0x11, 0x81, 0x02, 0x22, 0x09, 0x38, 0x10, 0x81, 0x03, 0x05, 
+    0x0F, 0x22, 0x09, 0x39, 0x0F, 0x82, 0x03, 0x05, 0x10, 0x22, 0x09, 0x39, 
+    0x0F, 0x82, 0x03, 0x06, 0x10, 0x22, 0x09, 0x38, 0x10, 0x81, 0x03, 0x06, 
+    0x11, 0x22, 0x09, 0x37, 0x11, 0x03, 0x06, 0x12, 0x22, 0x09, 0x36, 0x11, 
+    0x03, 0x07, 0x12, 0x22, 0x09, 0x35, 0x12, 0x03, 0x07, 0x13, 0x22, 0x09, 
+    0x34, 0x13, 0x03, 0x08, 0x14, 0x22, 0x09, 0x33, 0x13, 0x03, 0x08, 0x16, 
+    0x22, 0x09, 0x31, 0x15, 0x03, 0x09, 0x18, 0x22, 0x0A, 0x2D, 0x18, 0x01, 
+    0x09, 0x3C, 0x01, 0x0A, 0x3A, 0x01, 0x0B, 0x38, 0x01, 0x0C, 0x36, 0x01, 
+    0x0D, 0x34, 0x01, 0x0E, 0x32, 0x01, 0x0F, 0x30, 0x01, 0x10, 0x2E, 0x01, 
+    0x12, 0x2A, 0x01, 0x14, 0x26, 0x01, 0x16, 0x22, 0x01, 0x19, 0x1C, 0x01, 
+    0x1D, 0x14, 0x01, 0x22, 0x0A, 0x01, 0x22, 0x09, 0x89, 0x01, 0x23, 0x08, 
+    0x00, 0x86, 
+    // £ (U+00A3) - 175 bytes
+    0x00, 0x8A, 0x01, 0x28, 0x02, 0x01, 0x21, 0x10, 0x01, 0x1D, 0x17, 0x01, 
+    0x1B, 0x1C, 0x01, 0x19, 0x1F, 0x01, 0x18, 0x22, 0x01, 0x16, 0x25, 0x01, 
+    0x15, 0x27, 0x01, 0x14, 0x29, 0x01, 0x13, 0x2B, 0x01, 0x12, 0x2D, 0x01, 
+    0x11, 0x2F, 0x81, 0x02, 0x10, 0x18, 0x2A, 0x17, 0x02, 0x10, 0x13, 0x2F, 
+    0x13, 0x02, 0x0F, 0x12, 0x31, 0x11, 0x02, 0x0F, 0x11, 0x32, 0x10, 0x02, 
+    0x0E, 0x11, 0x33, 0x10, 0x02, 0x0E, 0x10, 0x34, 0x0F, 0x81, 0x02, 0x0D, 
+    0x10, 0x35, 0x0F, 0x81, 0x02, 0x0D, 0x0F, 0x35, 0x0F, 0x02, 0x0D, 0x0F, 
+    0x36, 0x0E, 0x81, 0x02, 0x0D, 0x0F, 0x36, 0x0F, 0x02, 0x0D, 0x0F, 0x36, 
+    0x0D, 0x01, 0x0D, 0x0F, 0x8C, 0x01, 0x05, 0x2E, 0x8A, 0x01, 0x0E, 0x0F, 
+    0x90, 0x01, 0x0E, 0x0E, 0x02, 0x0E, 0x0E, 0x37, 0x0E, 0x81, 0x02, 0x0E, 
+    0x0D, 0x37, 0x0E, 0x02, 0x0D, 0x0E, 0x37, 0x0E, 0x02, 0x0C, 0x0E, 0x37, 
+    0x0E, 0x02, 0x0B, 0x0D, 0x36, 0x0F, 0x02, 0x09, 0x0E, 0x35, 0x10, 0x01, 
+    0x05, 0x40, 0x01, 0x05, 0x3F, 0x82, 0x01, 0x05, 0x3E, 0x81, 0x01, 0x05, 
+    0x3D, 0x81, 0x01, 0x05, 0x3C, 0x01, 0x05, 0x3B, 0x01, 0x05, 0x39, 0x01, 
+    0x05, 0x37, 0x01, 0x05, 0x34, 0x00, 0x93, 
+    // € (U+20AC) - 246 bytes
+    0x00, 0x8B, 0x01, 0x2A, 0x11, 0x01, 0x26, 0x19, 0x01, 0x24, 0x1D, 0x01, 
+    0x22, 0x21, 0x01, 0x20, 0x25, 0x01, 0x1E, 0x29, 0x01, 0x1D, 0x2B, 0x01, 
+    0x1C, 0x2D, 0x01, 0x1B, 0x2E, 0x01, 0x1A, 0x2F, 0x01, 0x19, 0x30, 0x01, 
+    0x18, 0x30, 0x01, 0x17, 0x31, 0x02, 0x16, 0x1C, 0x34, 0x13, 0x02, 0x15, 
+    0x17, 0x39, 0x0E, 0x02, 0x15, 0x14, 0x3C, 0x0A, 0x02, 0x14, 0x14, 0x3E, 
+    0x08, 0x02, 0x14, 0x12, 0x40, 0x05, 0x02, 0x13, 0x12, 0x41, 0x04, 0x02, 
+    0x12, 0x12, 0x43, 0x01, 0x01, 0x12, 0x11, 0x01, 0x12, 0x10, 0x01, 0x11, 
+    0x11, 0x01, 0x11, 0x10, 0x01, 0x10, 0x11, 0x01, 0x10, 0x10, 0x81, 0x01, 
+    0x0F, 0x10, 0x82, 0x01, 0x0F, 0x0F, 0x01, 0x06, 0x39, 0x01, 0x05, 0x39, 
+    0x81, 0x01, 0x05, 0x38, 0x01, 0x04, 0x39, 0x81, 0x01, 0x03, 0x39, 0x81, 
+    0x01, 0x03, 0x38, 0x01, 0x0D, 0x10, 0x88, 0x01, 0x05, 0x32, 0x01, 0x05, 
+    0x31, 0x81, 0x01, 0x04, 0x31, 0x81, 0x01, 0x04, 0x30, 0x01, 0x03, 0x31, 
+    0x01, 0x03, 0x30, 0x81, 0x01, 0x0F, 0x0F, 0x01, 0x0F, 0x10, 0x82, 0x01, 
+    0x10, 0x10, 0x81, 0x01, 0x10, 0x11, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 
+    0x01, 0x12, 0x11, 0x81, 0x02, 0x13, 0x11, 0x43, 0x01, 0x02, 0x13, 0x12, 
+    0x41, 0x03, 0x02, 0x14, 0x13, 0x40, 0x05, 0x02, 0x14, 0x14, 0x3E, 0x07, 
+    0x02, 0x15, 0x15, 0x3C, 0x0A, 0x02, 0x16, 0x17, 0x39, 0x0D, 0x01, 0x16, 
+    0x31, 0x01, 0x17, 0x30, 0x01, 0x18, 0x30, 0x01, 0x19, 0x2F, 0x01, 0x1A, 
+    0x2F, 0x01, 0x1B, 0x2E, 0x01, 0x1C, 0x2D, 0x01, 0x1D, 0x2B, 0x01, 0x1F, 
+    0x27, 0x01, 0x20, 0x25, 0x01, 0x22, 0x21, 0x01, 0x24, 0x1D, 0x01, 0x27, 
+    0x17, 0x01, 0x2B, 0x0F, 0x00, 0x92, 
+};
+
+static const numeral_glyph_t numerals_inter_glyphs[] = {
+    {0x0030, 78, 0},  // 0
+    {0x0031, 78, 321},  // 1
+    {0x0032, 78, 441},  // 2
+    {0x0033, 78, 680},  // 3
+    {0x0034, 78, 980},  // 4
+    {0x0035, 78, 1224},  // 5
+    {0x0036, 78, 1452},  // 6
+    {0x0037, 78, 1801},  // 7
+    {0x0038, 78, 1969},  // 8
+    {0x0039, 78, 2303},  // 9
+    {0x003A, 33, 2647},  // :
+    {0x002E, 33, 2743},  // .
+    {0x002C, 33, 2792},  // ,
+    {0x002D, 54, 2845},  // -
+    {0x0024, 77, 2859},  // $
+    {0x00A3, 74, 3233},  // £
+    {0x20AC, 80, 3408},  // €
+};
+
+const numeral_outline_t numerals_inter = {
+    .runs = numerals_inter_runs,
+    .glyphs = numerals_inter_glyphs,
+    .glyph_count = 17,
+    .height = 120,
+    .baseline = 100,
+};
@@ -0,0 +1,701 @@
+/*
+ * Draw Command Lists
+ *
+ * Commands are kept in PSRAM and grown by doubling. Each records the box
+ * of pixels it can touch and a hash of its parameters, so strip-ordered
+ * execution can skip commands outside a band and frame diffing can match
+ * commands without comparing them field by field.
+ */
+
+#include <string.h>
+#include "rgb_cmdlist.h"
+#include "rgb_display.h"
+#include "fonts.h"
+#include "numerals.h"
+#include "rgb_stats.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "CMDLIST";
+
+#define INITIAL_COMMANDS 64
+#define INITIAL_TEXT     512
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+static inline int16_t clamp16(int v)
+{
+    return v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : v;
+}
+
+static inline int min3(int a, int b, int c)
+{
+    int m = a < b ? a : b;
+    return m < c ? m : c;
+}
+
+static inline int max3(int a, int b, int c)
+{
+    int m = a > b ? a : b;
+    return m > c ? m : c;
+}
+
+static void *grow(void *ptr, size_t size)
+{
+    void *p = heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM);
+    if (!p) {
+        ESP_LOGE(TAG, "Failed to grow command list to %u bytes", (unsigned)size);
+    }
+    return p;
+}
+
+static inline uint32_t fnv(uint32_t h, const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * FNV_PRIME;
+    }
+    return h;
+}
+
+static bool has_text(const rgb_cmd_t *cmd)
+{
+    return cmd->op == RGB_CMD_TEXT || cmd->op == RGB_CMD_TEXT8 ||
+           cmd->op == RGB_CMD_TEXT8_BG || cmd->op == RGB_CMD_NUMERALS;
+}
+
+// Bitmap commands keep the image pointer and their tint (e entries) in
+// the arena, so the pointer compares and hashes like text does
+typedef struct {
+    const rgb_image_t *image;
+    uint16_t tint[];
+} bitmap_ref_t;
+
+static bool has_points(const rgb_cmd_t *cmd)
+{
+    return cmd->op == RGB_CMD_POLYLINE || cmd->op == RGB_CMD_FILL_UNDER;
+}
+
+// Bytes of arena data a command references (0 for none)
+static size_t arena_size(const rgb_cmdlist_t *list, const rgb_cmd_t *cmd)
+{
+    if (has_text(cmd)) return strlen(list->text + cmd->text) + 1;
+    if (cmd->op == RGB_CMD_BITMAP) return sizeof(bitmap_ref_t) + cmd->e * sizeof(uint16_t);
+    if (has_points(cmd)) return cmd->a * 2 * sizeof(int16_t);
+    return 0;
+}
+
+// Alignment of a command's arena data
+static size_t arena_align(const rgb_cmd_t *cmd)
+{
+    if (cmd->op == RGB_CMD_BITMAP) return sizeof(void *);
+    if (has_points(cmd)) return sizeof(int16_t);
+    return 1;
+}
+
+// Append a command with operands a-f and bounding box (hashed by seal())
+static rgb_cmd_t *push(rgb_cmdlist_t *list, rgb_cmd_op_t op, uint16_t color,
+                       int a, int b, int c, int d, int e, int f,
+                       int left, int top, int right, int bottom)
+{
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : INITIAL_COMMANDS;
+        rgb_cmd_t *cmds = grow(list->cmds, capacity * sizeof(rgb_cmd_t));
+        if (!cmds) return NULL;
+        list->cmds = cmds;
+        list->capacity = capacity;
+    }
+
+    rgb_cmd_t *cmd = &list->cmds[list->count++];
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->op = op;
+    cmd->color = color;
+    cmd->a = clamp16(a);
+    cmd->b = clamp16(b);
+    cmd->c = clamp16(c);
+    cmd->d = clamp16(d);
+    cmd->e = clamp16(e);
+    cmd->f = clamp16(f);
+    cmd->left = clamp16(left);
+    cmd->top = clamp16(top);
+    cmd->right = clamp16(right);
+    cmd->bottom = clamp16(bottom);
+    return cmd;
+}
+
+// Hash the fixed fields (after font, text and pixels are set)
+static void seal(const rgb_cmdlist_t *list, rgb_cmd_t *cmd)
+{
+    uint32_t h = fnv(FNV_OFFSET, &cmd->op, offsetof(rgb_cmd_t, left) - offsetof(rgb_cmd_t, op));
+    size_t size = arena_size(list, cmd);
+    if (size) {
+        h = fnv(h, list->text + cmd->text, size);
+    } else if (cmd->op == RGB_CMD_IMAGE) {
+        h = fnv(h, &cmd->pixels, sizeof(cmd->pixels));
+    }
+    cmd->hash = h;
+}
+
+// Copy data into the arena at a multiple of align; returns its offset or -1
+static long store(rgb_cmdlist_t *list, const void *data, size_t len, size_t align)
+{
+    size_t start = (list->text_used + align - 1) & ~(align - 1);
+    if (start + len > list->text_capacity) {
+        size_t capacity = list->text_capacity ? list->text_capacity : INITIAL_TEXT;
+        while (capacity < start + len) capacity *= 2;
+        char *buf = grow(list->text, capacity);
+        if (!buf) return -1;
+        list->text = buf;
+        list->text_capacity = capacity;
+    }
+
+    memcpy(list->text + start, data, len);
+    list->text_used = start + len;
+    return (long)start;
+}
+
+static long store_text(rgb_cmdlist_t *list, const char *text)
+{
+    return store(list, text, strlen(text) + 1, 1);
+}
+
+void rgb_cmdlist_init(rgb_cmdlist_t *list)
+{
+    memset(list, 0, sizeof(*list));
+}
+
+void rgb_cmdlist_free(rgb_cmdlist_t *list)
+{
+    heap_caps_free(list->cmds);
+    heap_caps_free(list->text);
+    memset(list, 0, sizeof(*list));
+}
+
+void rgb_cmdlist_reset(rgb_cmdlist_t *list)
+{
+    list->count = 0;
+    list->text_used = 0;
+}
+
+bool rgb_cmdlist_rect(rgb_cmdlist_t *list, int x, int y, int w, int h, uint16_t color, bool filled)
+{
+    rgb_cmd_t *cmd = push(list, filled ? RGB_CMD_FILL_RECT : RGB_CMD_RECT, color,
+                          x, y, w, h, 0, 0, x, y, x + w - 1, y + h - 1);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_line(rgb_cmdlist_t *list, int x0, int y0, int x1, int y1, uint16_t color)
+{
+    rgb_cmd_t *cmd = push(list, RGB_CMD_LINE, color, x0, y0, x1, y1, 0, 0,
+                          x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                          x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_hline(rgb_cmdlist_t *list, int x, int y, int w, uint16_t color)
+{
+    rgb_cmd_t *cmd = push(list, RGB_CMD_HLINE, color, x, y, w, 0, 0, 0, x, y, x + w - 1, y);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_vline(rgb_cmdlist_t *list, int x, int y, int h, uint16_t color)
+{
+    rgb_cmd_t *cmd = push(list, RGB_CMD_VLINE, color, x, y, h, 0, 0, 0, x, y, x, y + h - 1);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_circle(rgb_cmdlist_t *list, int cx, int cy, int r, uint16_t color, bool filled)
+{
+    rgb_cmd_t *cmd = push(list, filled ? RGB_CMD_FILL_CIRCLE : RGB_CMD_CIRCLE, color,
+                          cx, cy, r, 0, 0, 0, cx - r, cy - r, cx + r, cy + r);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_pixel(rgb_cmdlist_t *list, int x, int y, uint16_t color)
+{
+    rgb_cmd_t *cmd = push(list, RGB_CMD_PIXEL, color, x, y, 0, 0, 0, 0, x, y, x, y);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_triangle(rgb_cmdlist_t *list, int x0, int y0, int x1, int y1, int x2, int y2,
+                          uint16_t color, bool filled)
+{
+    rgb_cmd_t *cmd = push(list, filled ? RGB_CMD_FILL_TRIANGLE : RGB_CMD_TRIANGLE, color,
+                          x0, y0, x1, y1, x2, y2,
+                          min3(x0, x1, x2), min3(y0, y1, y2), max3(x0, x1, x2), max3(y0, y1, y2));
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+// Store the points and push a command bounded by them (and the baseline)
+static bool push_points(rgb_cmdlist_t *list, rgb_cmd_op_t op, const int16_t *points, int count,
+                        int baseline, uint16_t color)
+{
+    if (count <= 0) return true;
+    if (count > INT16_MAX) count = INT16_MAX;
+
+    int left = points[0], right = points[0];
+    int top = points[1], bottom = points[1];
+    for (int i = 1; i < count; i++) {
+        int x = points[2 * i], y = points[2 * i + 1];
+        if (x < left) left = x;
+        if (x > right) right = x;
+        if (y < top) top = y;
+        if (y > bottom) bottom = y;
+    }
+    if (op == RGB_CMD_FILL_UNDER) {
+        if (baseline < top) top = baseline;
+        if (baseline > bottom) bottom = baseline;
+    }
+
+    long offset = store(list, points, count * 2 * sizeof(int16_t), sizeof(int16_t));
+    if (offset < 0) return false;
+
+    rgb_cmd_t *cmd = push(list, op, color, count, baseline, 0, 0, 0, 0, left, top, right, bottom);
+    if (!cmd) return false;
+    cmd->text = offset;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_polyline(rgb_cmdlist_t *list, const int16_t *points, int count, uint16_t color)
+{
+    return push_points(list, RGB_CMD_POLYLINE, points, count, 0, color);
+}
+
+bool rgb_cmdlist_fill_under(rgb_cmdlist_t *list, const int16_t *points, int count, int baseline,
+                            uint16_t color)
+{
+    return push_points(list, RGB_CMD_FILL_UNDER, points, count, baseline, color);
+}
+
+bool rgb_cmdlist_text(rgb_cmdlist_t *list, int x, int y, const char *text, uint16_t color, int font_id)
+{
+    if (!text) return true;
+
+    long offset = store_text(list, text);
+    if (offset < 0) return false;
+
+    // Glyph bitmaps may overhang their advance, so pad the measured width
+    const font_t *font = font_get((font_id_t)font_id);
+    font_metrics_t metrics;
+    font_measure(font, text, &metrics);
+    int pad = font ? font->line_height : 0;
+
+    rgb_cmd_t *cmd = push(list, RGB_CMD_TEXT, color, x, y, 0, 0, 0, 0,
+                          x, y, x + metrics.width + pad - 1, y + metrics.height - 1);
+    if (!cmd) return false;
+    cmd->font = font_id;
+    cmd->text = offset;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_text8(rgb_cmdlist_t *list, int x, int y, const char *text, uint16_t color,
+                       bool use_bg, uint16_t bg_color)
+{
+    if (!text) return true;
+
+    long offset = store_text(list, text);
+    if (offset < 0) return false;
+
+    font_metrics_t metrics;
+    font_measure(NULL, text, &metrics);
+
+    rgb_cmd_t *cmd = push(list, use_bg ? RGB_CMD_TEXT8_BG : RGB_CMD_TEXT8, color,
+                          x, y, 0, use_bg ? (int16_t)bg_color : 0, 0, 0,
+                          x, y, x + metrics.width - 1, y + metrics.height - 1);
+    if (!cmd) return false;
+    cmd->text = offset;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_numerals(rgb_cmdlist_t *list, int x, int y, const char *text, int size,
+                          uint16_t color, uint16_t bg_color)
+{
+    if (!text) return true;
+
+    long offset = store_text(list, text);
+    if (offset < 0) return false;
+
+    int width = numerals_width(text, size);
+    rgb_cmd_t *cmd = push(list, RGB_CMD_NUMERALS, color, x, y, size, (int16_t)bg_color, 0, 0,
+                          x, y, x + width - 1, y + size - 1);
+    if (!cmd) return false;
+    cmd->text = offset;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_clear(rgb_cmdlist_t *list, uint16_t color)
+{
+    rgb_cmd_t *cmd = push(list, RGB_CMD_CLEAR, color, 0, 0, 0, 0, 0, 0,
+                          0, 0, RGB_DISPLAY_WIDTH - 1, RGB_DISPLAY_HEIGHT - 1);
+    if (!cmd) return false;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_image(rgb_cmdlist_t *list, int x, int y, int w, int h, const uint16_t *pixels)
+{
+    rgb_cmd_t *cmd = push(list, RGB_CMD_IMAGE, 0, x, y, w, h, 0, 0, x, y, x + w - 1, y + h - 1);
+    if (!cmd) return false;
+    cmd->pixels = pixels;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_blit(rgb_cmdlist_t *list, const rgb_surface_t *src, int x, int y)
+{
+    // An image command with the generation in e and f, so a surface drawn
+    // into since the last frame compares as changed
+    int w = src->width;
+    int h = src->height;
+    rgb_cmd_t *cmd = push(list, RGB_CMD_IMAGE, 0, x, y, w, h,
+                          (int16_t)(src->generation & 0xFFFF), (int16_t)(src->generation >> 16),
+                          x, y, x + w - 1, y + h - 1);
+    if (!cmd) return false;
+    cmd->pixels = src->pixels;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_bitmap(rgb_cmdlist_t *list, const rgb_image_t *image, int x, int y,
+                        const uint16_t *tint, uint16_t color)
+{
+    if (!image) return true;
+
+    // The tint is copied, so it may be a temporary
+    int entries = tint ? image->palette_size : 0;
+    long offset = store(list, &image, sizeof(bitmap_ref_t), sizeof(void *));
+    if (offset < 0 || (entries && store(list, tint, entries * sizeof(uint16_t), 1) < 0)) return false;
+
+    int w = image->width;
+    int h = image->height;
+    rgb_cmd_t *cmd = push(list, RGB_CMD_BITMAP, color, x, y, w, h, entries, (int16_t)image->generation,
+                          x, y, x + w - 1, y + h - 1);
+    if (!cmd) return false;
+    cmd->text = offset;
+    seal(list, cmd);
+    return true;
+}
+
+bool rgb_cmdlist_append(rgb_cmdlist_t *list, const rgb_cmdlist_t *src)
+{
+    for (int i = 0; i < src->count; i++) {
+        const rgb_cmd_t *from = &src->cmds[i];
+        size_t size = arena_size(src, from);
+        long offset = 0;
+        if (size) {
+            offset = store(list, src->text + from->text, size, arena_align(from));
+            if (offset < 0) return false;
+        }
+        rgb_cmd_t *cmd = push(list, from->op, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        if (!cmd) return false;
+        *cmd = *from;
+        if (size) cmd->text = offset;
+    }
+    return true;
+}
+
+static void run_command(const rgb_cmdlist_t *list, const rgb_cmd_t *cmd)
+{
+    switch (cmd->op) {
+        case RGB_CMD_RECT:
+        case RGB_CMD_FILL_RECT:
+            rgb_display_draw_rect(cmd->a, cmd->b, cmd->c, cmd->d, cmd->color, cmd->op == RGB_CMD_FILL_RECT);
+            break;
+        case RGB_CMD_LINE:
+            rgb_display_draw_line(cmd->a, cmd->b, cmd->c, cmd->d, cmd->color);
+            break;
+        case RGB_CMD_HLINE:
+            rgb_display_draw_hline(cmd->a, cmd->b, cmd->c, cmd->color);
+            break;
+        case RGB_CMD_VLINE:
+            rgb_display_draw_vline(cmd->a, cmd->b, cmd->c, cmd->color);
+            break;
+        case RGB_CMD_CIRCLE:
+        case RGB_CMD_FILL_CIRCLE:
+            rgb_display_draw_circle(cmd->a, cmd->b, cmd->c, cmd->color, cmd->op == RGB_CMD_FILL_CIRCLE);
+            break;
+        case RGB_CMD_TEXT:
+            rgb_display_draw_text_font(cmd->a, cmd->b, list->text + cmd->text, cmd->color, (font_id_t)cmd->font);
+            break;
+        case RGB_CMD_IMAGE:
+            rgb_display_draw_image(cmd->a, cmd->b, cmd->c, cmd->d, cmd->pixels);
+            break;
+        case RGB_CMD_BITMAP: {
+            const bitmap_ref_t *ref = (const bitmap_ref_t *)(list->text + cmd->text);
+            rgb_image_draw(ref->image, cmd->a, cmd->b, cmd->e ? ref->tint : NULL, cmd->color);
+            break;
+        }
+        case RGB_CMD_PIXEL:
+            rgb_display_draw_pixel(cmd->a, cmd->b, cmd->color);
+            break;
+        case RGB_CMD_TRIANGLE:
+        case RGB_CMD_FILL_TRIANGLE:
+            rgb_display_draw_triangle(cmd->a, cmd->b, cmd->c, cmd->d, cmd->e, cmd->f, cmd->color,
+                                      cmd->op == RGB_CMD_FILL_TRIANGLE);
+            break;
+        case RGB_CMD_TEXT8:
+            rgb_display_draw_text(cmd->a, cmd->b, list->text + cmd->text, cmd->color);
+            break;
+        case RGB_CMD_TEXT8_BG:
+            rgb_display_draw_text_bg(cmd->a, cmd->b, list->text + cmd->text, cmd->color, (uint16_t)cmd->d);
+            break;
+        case RGB_CMD_NUMERALS:
+            numerals_draw(cmd->a, cmd->b, list->text + cmd->text, cmd->c, cmd->color, (uint16_t)cmd->d, NULL);
+            break;
+        case RGB_CMD_CLEAR: {
+            // Filled within the clip, but counted as the clear it stands for
+            RGB_STATS_BEGIN();
+            rgb_display_draw_rect(0, 0, RGB_DISPLAY_WIDTH, RGB_DISPLAY_HEIGHT, cmd->color, true);
+            RGB_STATS_END(RGB_STATS_CLEAR);
+            break;
+        }
+        case RGB_CMD_POLYLINE:
+            rgb_display_draw_polyline((const int16_t *)(list->text + cmd->text), cmd->a, cmd->color);
+            break;
+        case RGB_CMD_FILL_UNDER:
+            rgb_display_fill_under((const int16_t *)(list->text + cmd->text), cmd->a, cmd->b, cmd->color);
+            break;
+    }
+}
+
+// Run the commands touching the box in recording order; returns how many ran
+static int run_box(const rgb_cmdlist_t *list, int x0, int y0, int x1, int y1)
+{
+    const rgb_cmd_t *cmd = list->cmds;
+    const rgb_cmd_t *end = cmd + list->count;
+    int ran = 0;
+    for (; cmd < end; cmd++) {
+        if (cmd->bottom < y0 || cmd->top >= y1 || cmd->right < x0 || cmd->left >= x1) continue;
+        run_command(list, cmd);
+        ran++;
+    }
+    return ran;
+}
+
+void rgb_cmdlist_execute(const rgb_cmdlist_t *list, int strip_height)
+{
+    if (!list || list->count == 0) return;
+
+    rgb_display_clip_t saved = *rgb_display_get_clip();
+
+    if (strip_height <= 0) {
+        run_box(list, saved.x0, saved.y0, saved.x1, saved.y1);
+        return;
+    }
+
+    for (int y = saved.y0; y < saved.y1; y += strip_height) {
+        int y1 = y + strip_height < saved.y1 ? y + strip_height : saved.y1;
+        rgb_display_set_clip(saved.x0, y, saved.x1 - saved.x0, y1 - y);
+        run_box(list, saved.x0, y, saved.x1, y1);
+    }
+    rgb_display_set_clip(saved.x0, saved.y0, saved.x1 - saved.x0, saved.y1 - saved.y0);
+}
+
+// ===================== Frame diffing =====================
+
+typedef struct {
+    int x0, y0, x1, y1;     // x1/y1 exclusive
+} box_t;
+
+typedef struct {
+    box_t boxes[RGB_CMDLIST_MAX_DIRTY];
+    int count;
+    box_t bounds;           // Screen area considered (the clip)
+} dirty_t;
+
+// Matching scratch, grown to the largest previous list seen
+static int *s_bucket_head;
+static int *s_chain;
+static uint8_t *s_used;
+static int s_scratch_cmds;
+static int s_scratch_buckets;
+
+static bool same_command(const rgb_cmdlist_t *la, const rgb_cmd_t *a,
+                         const rgb_cmdlist_t *lb, const rgb_cmd_t *b)
+{
+    if (a->hash != b->hash) return false;
+    if (memcmp(&a->op, &b->op, offsetof(rgb_cmd_t, left) - offsetof(rgb_cmd_t, op)) != 0) return false;
+    size_t size = arena_size(la, a);
+    if (size) return memcmp(la->text + a->text, lb->text + b->text, size) == 0;
+    if (a->op == RGB_CMD_IMAGE) return a->pixels == b->pixels;
+    return true;
+}
+
+static bool reserve_scratch(int cmds, int buckets)
+{
+    if (cmds > s_scratch_cmds) {
+        int *chain = grow(s_chain, cmds * sizeof(int));
+        if (chain) s_chain = chain;
+        uint8_t *used = grow(s_used, cmds);
+        if (used) s_used = used;
+        if (!chain || !used) return false;
+        s_scratch_cmds = cmds;
+    }
+    if (buckets > s_scratch_buckets) {
+        int *head = grow(s_bucket_head, buckets * sizeof(int));
+        if (!head) return false;
+        s_bucket_head = head;
+        s_scratch_buckets = buckets;
+    }
+    return true;
+}
+
+static inline int box_area(const box_t *b)
+{
+    return (b->x1 - b->x0) * (b->y1 - b->y0);
+}
+
+static inline box_t box_union(const box_t *a, const box_t *b)
+{
+    box_t u = {
+        a->x0 < b->x0 ? a->x0 : b->x0, a->y0 < b->y0 ? a->y0 : b->y0,
+        a->x1 > b->x1 ? a->x1 : b->x1, a->y1 > b->y1 ? a->y1 : b->y1,
+    };
+    return u;
+}
+
+// Overlapping or edge-adjacent
+static inline bool box_touches(const box_t *a, const box_t *b)
+{
+    return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+// Merge every region the box touches into it, repeating as it grows
+static void dirty_absorb(dirty_t *dirty, box_t *box)
+{
+    for (int i = 0; i < dirty->count; ) {
+        if (box_touches(box, &dirty->boxes[i])) {
+            *box = box_union(box, &dirty->boxes[i]);
+            dirty->boxes[i] = dirty->boxes[--dirty->count];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+}
+
+static void dirty_add(dirty_t *dirty, const rgb_cmd_t *cmd)
+{
+    box_t box = { cmd->left, cmd->top, cmd->right + 1, cmd->bottom + 1 };
+    if (box.x0 < dirty->bounds.x0) box.x0 = dirty->bounds.x0;
+    if (box.y0 < dirty->bounds.y0) box.y0 = dirty->bounds.y0;
+    if (box.x1 > dirty->bounds.x1) box.x1 = dirty->bounds.x1;
+    if (box.y1 > dirty->bounds.y1) box.y1 = dirty->bounds.y1;
+    if (box.x1 <= box.x0 || box.y1 <= box.y0) return;
+
+    dirty_absorb(dirty, &box);
+
+    if (dirty->count == RGB_CMDLIST_MAX_DIRTY) {
+        // Full: merge into the region that grows least
+        int best = 0;
+        int best_growth = 0;
+        for (int i = 0; i < dirty->count; i++) {
+            box_t u = box_union(&box, &dirty->boxes[i]);
+            int growth = box_area(&u) - box_area(&dirty->boxes[i]);
+            if (i == 0 || growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        box = box_union(&box, &dirty->boxes[best]);
+        dirty->boxes[best] = dirty->boxes[--dirty->count];
+        dirty_absorb(dirty, &box);
+    }
+
+    dirty->boxes[dirty->count++] = box;
+}
+
+void rgb_cmdlist_execute_diff(const rgb_cmdlist_t *prev, const rgb_cmdlist_t *next,
+                              rgb_cmdlist_diff_t *stats)
+{
+    rgb_cmdlist_diff_t local;
+    if (!stats) stats = &local;
+    memset(stats, 0, sizeof(*stats));
+    stats->commands = next->count;
+
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    dirty_t dirty = { .count = 0, .bounds = { clip->x0, clip->y0, clip->x1, clip->y1 } };
+
+    int buckets = 16;
+    while (prev && buckets < prev->count * 2) buckets <<= 1;
+
+    if (!prev || !reserve_scratch(prev->count, buckets)) {
+        // Nothing to compare against: repaint everything
+        dirty.boxes[0] = dirty.bounds;
+        dirty.count = 1;
+    } else {
+        // Chains list previous commands per bucket in ascending order
+        for (int i = 0; i < buckets; i++) s_bucket_head[i] = -1;
+        for (int i = prev->count - 1; i >= 0; i--) {
+            int bucket = prev->cmds[i].hash & (buckets - 1);
+            s_chain[i] = s_bucket_head[bucket];
+            s_bucket_head[bucket] = i;
+            s_used[i] = 0;
+        }
+
+        // Greedy in-order matching: each command takes the first equal,
+        // unused previous command after the last match. Matches never
+        // cross, so unchanged commands keep their stacking order.
+        int last = -1;
+        for (int i = 0; i < next->count; i++) {
+            const rgb_cmd_t *cmd = &next->cmds[i];
+            int j = s_bucket_head[cmd->hash & (buckets - 1)];
+            while (j >= 0 && (j <= last || s_used[j] || !same_command(prev, &prev->cmds[j], next, cmd))) {
+                j = s_chain[j];
+            }
+            if (j >= 0) {
+                s_used[j] = 1;
+                last = j;
+                stats->matched++;
+            } else {
+                dirty_add(&dirty, cmd);
+            }
+        }
+        for (int j = 0; j < prev->count; j++) {
+            if (!s_used[j]) dirty_add(&dirty, &prev->cmds[j]);
+        }
+    }
+
+    if (dirty.count == 0) return;
+
+    // Scattered changes cost a pass over the list per region; past most
+    // of the screen one full pass is cheaper
+    int area = 0;
+    for (int i = 0; i < dirty.count; i++) area += box_area(&dirty.boxes[i]);
+    if (area * 4 > box_area(&dirty.bounds) * 3) {
+        dirty.boxes[0] = dirty.bounds;
+        dirty.count = 1;
+    }
+
+    rgb_display_clip_t saved = *clip;
+    for (int i = 0; i < dirty.count; i++) {
+        const box_t *box = &dirty.boxes[i];
+        // Each region repaints the cells in it from scratch, so none may be
+        // skipped as unchanged by an earlier region
+        numerals_reset();
+        rgb_display_set_clip(box->x0, box->y0, box->x1 - box->x0, box->y1 - box->y0);
+        stats->executed += run_box(next, box->x0, box->y0, box->x1, box->y1);
+        stats->dirty_pixels += box_area(box);
+    }
+    stats->dirty_rects = dirty.count;
+    rgb_display_set_clip(saved.x0, saved.y0, saved.x1 - saved.x0, saved.y1 - saved.y0);
+}
@@ -7,9 +7,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include "rgb_display.h"
-
-// External framebuffer access
-extern uint16_t* rgb_display_get_framebuffer(void);
+#include "rgb_stats.h"
+#include "esp_heap_caps.h"
 
 // Simple 8x16 bitmap font (ASCII 32-127)
 // Each character is 8 pixels wide and 16 pixels tall
@@ -317,71 +316,186 @@ static inline int min_int(int a, int b) { return a < b ? a : b; }
 static inline int max_int(int a, int b) { return a > b ? a : b; }
 static inline void swap_int(int *a, int *b) { int t = *a; *a = *b; *b = t; }
 
+// Incremented on every full-screen clear
+static uint32_t s_clear_count = 0;
+
+uint32_t rgb_display_get_clear_count(void)
+{
+    return s_clear_count;
+}
+
+// Drawing target; the screen's pixels are looked up when it is fetched
+static rgb_surface_t s_screen = { NULL, RGB_DISPLAY_WIDTH, RGB_DISPLAY_HEIGHT, 0 };
+static rgb_surface_t *s_target = &s_screen;
+
+// Drawing clip, always within the target
+static rgb_display_clip_t s_clip = { 0, 0, RGB_DISPLAY_WIDTH, RGB_DISPLAY_HEIGHT };
+
+rgb_surface_t* rgb_surface_create(int w, int h, bool internal)
+{
+    if (w <= 0 || h <= 0 || w > RGB_DISPLAY_WIDTH || h > RGB_DISPLAY_HEIGHT) return NULL;
+    
+    rgb_surface_t *surface = calloc(1, sizeof(rgb_surface_t));
+    if (!surface) return NULL;
+    
+    uint32_t caps = internal ? MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT : MALLOC_CAP_SPIRAM;
+    surface->pixels = heap_caps_malloc((size_t)w * h * sizeof(uint16_t), caps);
+    if (!surface->pixels) {
+        free(surface);
+        return NULL;
+    }
+    surface->width = w;
+    surface->height = h;
+    return surface;
+}
+
+void rgb_surface_free(rgb_surface_t *surface)
+{
+    if (!surface) return;
+    if (s_target == surface) rgb_display_set_target(NULL);
+    heap_caps_free(surface->pixels);
+    free(surface);
+}
+
+void rgb_display_set_target(rgb_surface_t *surface)
+{
+    s_target = surface ? surface : &s_screen;
+    if (surface) surface->generation++;
+    rgb_display_reset_clip();
+}
+
+const rgb_surface_t* rgb_display_get_target(void)
+{
+    s_screen.pixels = rgb_display_get_framebuffer();
+    return s_target;
+}
+
+void rgb_display_blit(const rgb_surface_t *src, int x, int y)
+{
+    // Copying a surface onto itself would overlap
+    if (!src || src == s_target) return;
+    rgb_display_draw_image(x, y, src->width, src->height, src->pixels);
+}
+
+void rgb_display_set_clip(int x, int y, int w, int h)
+{
+    s_clip.x0 = clamp(x, 0, s_target->width);
+    s_clip.y0 = clamp(y, 0, s_target->height);
+    s_clip.x1 = clamp(x + w, s_clip.x0, s_target->width);
+    s_clip.y1 = clamp(y + h, s_clip.y0, s_target->height);
+}
+
+void rgb_display_reset_clip(void)
+{
+    rgb_display_set_clip(0, 0, s_target->width, s_target->height);
+}
+
+const rgb_display_clip_t* rgb_display_get_clip(void)
+{
+    return &s_clip;
+}
+
 void rgb_display_clear(uint16_t color)
 {
-    uint16_t *fb = rgb_display_get_framebuffer();
+    const rgb_surface_t *target = rgb_display_get_target();
+    uint16_t *fb = target->pixels;
     if (!fb) return;
     
-    int total_pixels = RGB_DISPLAY_WIDTH * RGB_DISPLAY_HEIGHT;
+    RGB_STATS_BEGIN();
+    // Only the screen holds incrementally drawn readouts
+    if (target == &s_screen) s_clear_count++;
+    int total_pixels = target->width * target->height;
     for (int i = 0; i < total_pixels; i++) {
         fb[i] = color;
     }
+    RGB_STATS_PIXELS(total_pixels);
+    RGB_STATS_END(RGB_STATS_CLEAR);
 }
 
-void rgb_display_draw_pixel(int x, int y, uint16_t color)
+// Uncounted versions of the pixel, hline and vline primitives, for use by
+// the other primitives (which are counted as a whole)
+static void draw_pixel(int x, int y, uint16_t color)
 {
-    if (x < 0 || x >= RGB_DISPLAY_WIDTH || y < 0 || y >= RGB_DISPLAY_HEIGHT) return;
+    if (x < s_clip.x0 || x >= s_clip.x1 || y < s_clip.y0 || y >= s_clip.y1) return;
     
-    uint16_t *fb = rgb_display_get_framebuffer();
-    if (fb) {
-        fb[y * RGB_DISPLAY_WIDTH + x] = color;
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (target->pixels) {
+        target->pixels[y * target->width + x] = color;
+        RGB_STATS_PIXELS(1);
     }
 }
 
 uint16_t rgb_display_read_pixel(int x, int y)
 {
-    if (x < 0 || x >= RGB_DISPLAY_WIDTH || y < 0 || y >= RGB_DISPLAY_HEIGHT) return 0;
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (x < 0 || x >= target->width || y < 0 || y >= target->height) return 0;
     
-    uint16_t *fb = rgb_display_get_framebuffer();
-    if (fb) {
-        return fb[y * RGB_DISPLAY_WIDTH + x];
+    if (target->pixels) {
+        return target->pixels[y * target->width + x];
     }
     return 0;
 }
 
-void rgb_display_draw_hline(int x, int y, int w, uint16_t color)
+static void draw_hline(int x, int y, int w, uint16_t color)
 {
-    if (y < 0 || y >= RGB_DISPLAY_HEIGHT || w <= 0) return;
+    if (y < s_clip.y0 || y >= s_clip.y1 || w <= 0) return;
     
-    int x_start = clamp(x, 0, RGB_DISPLAY_WIDTH - 1);
-    int x_end = clamp(x + w - 1, 0, RGB_DISPLAY_WIDTH - 1);
+    int x_start = max_int(x, s_clip.x0);
+    int x_end = min_int(x + w, s_clip.x1) - 1;
+    if (x_end < x_start) return;
     
-    uint16_t *fb = rgb_display_get_framebuffer();
-    if (!fb) return;
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (!target->pixels) return;
     
-    uint16_t *row = &fb[y * RGB_DISPLAY_WIDTH + x_start];
+    uint16_t *row = &target->pixels[y * target->width + x_start];
     int len = x_end - x_start + 1;
     for (int i = 0; i < len; i++) {
         row[i] = color;
     }
+    RGB_STATS_PIXELS(len);
 }
 
-void rgb_display_draw_vline(int x, int y, int h, uint16_t color)
+static void draw_vline(int x, int y, int h, uint16_t color)
 {
-    if (x < 0 || x >= RGB_DISPLAY_WIDTH || h <= 0) return;
+    if (x < s_clip.x0 || x >= s_clip.x1 || h <= 0) return;
     
-    int y_start = clamp(y, 0, RGB_DISPLAY_HEIGHT - 1);
-    int y_end = clamp(y + h - 1, 0, RGB_DISPLAY_HEIGHT - 1);
+    int y_start = max_int(y, s_clip.y0);
+    int y_end = min_int(y + h, s_clip.y1) - 1;
+    if (y_end < y_start) return;
     
-    uint16_t *fb = rgb_display_get_framebuffer();
-    if (!fb) return;
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (!target->pixels) return;
     
+    uint16_t *dst = &target->pixels[y_start * target->width + x];
     for (int cy = y_start; cy <= y_end; cy++) {
-        fb[cy * RGB_DISPLAY_WIDTH + x] = color;
+        *dst = color;
+        dst += target->width;
     }
+    RGB_STATS_PIXELS(y_end - y_start + 1);
 }
 
-void rgb_display_draw_line(int x0, int y0, int x1, int y1, uint16_t color)
+void rgb_display_draw_pixel(int x, int y, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    draw_pixel(x, y, color);
+    RGB_STATS_END(RGB_STATS_PIXEL);
+}
+
+void rgb_display_draw_hline(int x, int y, int w, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    draw_hline(x, y, w, color);
+    RGB_STATS_END(RGB_STATS_HLINE);
+}
+
+void rgb_display_draw_vline(int x, int y, int h, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    draw_vline(x, y, h, color);
+    RGB_STATS_END(RGB_STATS_VLINE);
+}
+
+static void draw_line(int x0, int y0, int x1, int y1, uint16_t color)
 {
     // Bresenham's line algorithm
     int dx = abs(x1 - x0);
@@ -391,7 +505,7 @@ void rgb_display_draw_line(int x0, int y0, int x1, int y1, uint16_t color)
     int err = dx - dy;
     
     while (1) {
-        rgb_display_draw_pixel(x0, y0, color);
+        draw_pixel(x0, y0, color);
         
         if (x0 == x1 && y0 == y1) break;
         
@@ -407,22 +521,34 @@ void rgb_display_draw_line(int x0, int y0, int x1, int y1, uint16_t color)
     }
 }
 
+void rgb_display_draw_line(int x0, int y0, int x1, int y1, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    draw_line(x0, y0, x1, y1, color);
+    RGB_STATS_END(RGB_STATS_LINE);
+}
+
 void rgb_display_draw_rect(int x, int y, int w, int h, uint16_t color, bool filled)
 {
+    RGB_STATS_BEGIN();
     if (filled) {
-        for (int cy = y; cy < y + h; cy++) {
-            rgb_display_draw_hline(x, cy, w, color);
+        int y_start = max_int(y, s_clip.y0);
+        int y_end = min_int(y + h, s_clip.y1);
+        for (int cy = y_start; cy < y_end; cy++) {
+            draw_hline(x, cy, w, color);
         }
     } else {
-        rgb_display_draw_hline(x, y, w, color);           // Top
-        rgb_display_draw_hline(x, y + h - 1, w, color);   // Bottom
-        rgb_display_draw_vline(x, y, h, color);           // Left
-        rgb_display_draw_vline(x + w - 1, y, h, color);   // Right
+        draw_hline(x, y, w, color);           // Top
+        draw_hline(x, y + h - 1, w, color);   // Bottom
+        draw_vline(x, y, h, color);           // Left
+        draw_vline(x + w - 1, y, h, color);   // Right
     }
+    RGB_STATS_END(RGB_STATS_RECT);
 }
 
 void rgb_display_draw_circle(int cx, int cy, int r, uint16_t color, bool filled)
 {
+    RGB_STATS_BEGIN();
     // Midpoint circle algorithm
     int x = 0;
     int y = r;
@@ -430,19 +556,19 @@ void rgb_display_draw_circle(int cx, int cy, int r, uint16_t color, bool filled)
     
     while (x <= y) {
         if (filled) {
-            rgb_display_draw_hline(cx - x, cy + y, 2 * x + 1, color);
-            rgb_display_draw_hline(cx - x, cy - y, 2 * x + 1, color);
-            rgb_display_draw_hline(cx - y, cy + x, 2 * y + 1, color);
-            rgb_display_draw_hline(cx - y, cy - x, 2 * y + 1, color);
+            draw_hline(cx - x, cy + y, 2 * x + 1, color);
+            draw_hline(cx - x, cy - y, 2 * x + 1, color);
+            draw_hline(cx - y, cy + x, 2 * y + 1, color);
+            draw_hline(cx - y, cy - x, 2 * y + 1, color);
         } else {
-            rgb_display_draw_pixel(cx + x, cy + y, color);
-            rgb_display_draw_pixel(cx - x, cy + y, color);
-            rgb_display_draw_pixel(cx + x, cy - y, color);
-            rgb_display_draw_pixel(cx - x, cy - y, color);
-            rgb_display_draw_pixel(cx + y, cy + x, color);
-            rgb_display_draw_pixel(cx - y, cy + x, color);
-            rgb_display_draw_pixel(cx + y, cy - x, color);
-            rgb_display_draw_pixel(cx - y, cy - x, color);
+            draw_pixel(cx + x, cy + y, color);
+            draw_pixel(cx - x, cy + y, color);
+            draw_pixel(cx + x, cy - y, color);
+            draw_pixel(cx - x, cy - y, color);
+            draw_pixel(cx + y, cy + x, color);
+            draw_pixel(cx - y, cy + x, color);
+            draw_pixel(cx + y, cy - x, color);
+            draw_pixel(cx - y, cy - x, color);
         }
         
         if (d < 0) {
@@ -453,18 +579,11 @@ void rgb_display_draw_circle(int cx, int cy, int r, uint16_t color, bool filled)
         }
         x++;
     }
+    RGB_STATS_END(RGB_STATS_CIRCLE);
 }
 
-void rgb_display_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, 
-                                uint16_t color, bool filled)
+static void fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color)
 {
-    if (!filled) {
-        rgb_display_draw_line(x0, y0, x1, y1, color);
-        rgb_display_draw_line(x1, y1, x2, y2, color);
-        rgb_display_draw_line(x2, y2, x0, y0, color);
-        return;
-    }
-    
     // Sort vertices by Y coordinate
     if (y0 > y1) { swap_int(&x0, &x1); swap_int(&y0, &y1); }
     if (y1 > y2) { swap_int(&x1, &x2); swap_int(&y1, &y2); }
@@ -472,8 +591,8 @@ void rgb_display_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2,
     
     int total_height = y2 - y0;
     if (total_height == 0) {
-        rgb_display_draw_hline(min_int(min_int(x0, x1), x2), y0, 
-                                max_int(max_int(x0, x1), x2) - min_int(min_int(x0, x1), x2) + 1, color);
+        draw_hline(min_int(min_int(x0, x1), x2), y0, 
+                   max_int(max_int(x0, x1), x2) - min_int(min_int(x0, x1), x2) + 1, color);
         return;
     }
     
@@ -491,8 +610,79 @@ void rgb_display_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2,
         int bx = second_half ? x1 + (x2 - x1) * beta : x0 + (x1 - x0) * beta;
         
         if (ax > bx) swap_int(&ax, &bx);
-        rgb_display_draw_hline(ax, y0 + i, bx - ax + 1, color);
+        draw_hline(ax, y0 + i, bx - ax + 1, color);
+    }
+}
+
+void rgb_display_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, 
+                                uint16_t color, bool filled)
+{
+    RGB_STATS_BEGIN();
+    if (filled) {
+        fill_triangle(x0, y0, x1, y1, x2, y2, color);
+    } else {
+        draw_line(x0, y0, x1, y1, color);
+        draw_line(x1, y1, x2, y2, color);
+        draw_line(x2, y2, x0, y0, color);
     }
+    RGB_STATS_END(RGB_STATS_TRIANGLE);
+}
+
+void rgb_display_draw_polyline(const int16_t *points, int count, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    if (count == 1) {
+        draw_pixel(points[0], points[1], color);
+    }
+    
+    for (int i = 1; i < count; i++, points += 2) {
+        int x0 = points[0], y0 = points[1];
+        int x1 = points[2], y1 = points[3];
+        
+        // Segments outside the clip (another strip, say) cost nothing
+        if (max_int(x0, x1) < s_clip.x0 || min_int(x0, x1) >= s_clip.x1 ||
+            max_int(y0, y1) < s_clip.y0 || min_int(y0, y1) >= s_clip.y1) {
+            continue;
+        }
+        draw_line(x0, y0, x1, y1, color);
+    }
+    RGB_STATS_END(RGB_STATS_POLYLINE);
+}
+
+void rgb_display_fill_under(const int16_t *points, int count, int baseline, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    for (int i = 0; i < count; i++) {
+        int x0 = points[2 * i], y0 = points[2 * i + 1];
+        int x1 = x0, y1 = y0;
+        if (i + 1 < count) {
+            x1 = points[2 * i + 2];
+            y1 = points[2 * i + 3];
+        } else if (count > 1) {
+            break;
+        }
+        if (x0 > x1) { swap_int(&x0, &x1); swap_int(&y0, &y1); }
+        
+        // Each column belongs to one segment; the last one includes its end
+        int dx = x1 - x0;
+        int end = (i + 2 >= count) ? x1 : x1 - 1;
+        int start = max_int(x0, s_clip.x0);
+        end = min_int(end, s_clip.x1 - 1);
+        
+        for (int x = start; x <= end; x++) {
+            int y = y0;
+            if (dx) {
+                int num = (y1 - y0) * (x - x0);
+                y += num >= 0 ? (num + dx / 2) / dx : -((-num + dx / 2) / dx);
+            }
+            if (y <= baseline) {
+                draw_vline(x, y, baseline - y + 1, color);
+            } else {
+                draw_vline(x, baseline, y - baseline + 1, color);
+            }
+        }
+    }
+    RGB_STATS_END(RGB_STATS_FILL_UNDER);
 }
 
 static void draw_char(int x, int y, char c, uint16_t fg_color, uint16_t bg_color, bool use_bg)
@@ -501,6 +691,7 @@ static void draw_char(int x, int y, char c, uint16_t fg_color, uint16_t bg_color
     
     int char_index = c - 32;
     const uint8_t *char_data = &font8x16[char_index * FONT_HEIGHT];
+    RGB_STATS_GLYPHS(1);
     
     for (int row = 0; row < FONT_HEIGHT; row++) {
         uint8_t row_data = char_data[row];
@@ -508,11 +699,11 @@ static void draw_char(int x, int y, char c, uint16_t fg_color, uint16_t bg_color
             int px = x + col;
             int py = y + row;
             
-            if (px >= 0 && px < RGB_DISPLAY_WIDTH && py >= 0 && py < RGB_DISPLAY_HEIGHT) {
+            if (px >= s_clip.x0 && px < s_clip.x1 && py >= s_clip.y0 && py < s_clip.y1) {
                 if (row_data & (0x80 >> col)) {
-                    rgb_display_draw_pixel(px, py, fg_color);
+                    draw_pixel(px, py, fg_color);
                 } else if (use_bg) {
-                    rgb_display_draw_pixel(px, py, bg_color);
+                    draw_pixel(px, py, bg_color);
                 }
             }
         }
@@ -523,6 +714,7 @@ void rgb_display_draw_text(int x, int y, const char *text, uint16_t color)
 {
     if (!text) return;
     
+    RGB_STATS_BEGIN();
     int cur_x = x;
     while (*text) {
         if (*text == '\n') {
@@ -536,6 +728,7 @@ void rgb_display_draw_text(int x, int y, const char *text, uint16_t color)
         }
         text++;
     }
+    RGB_STATS_END(RGB_STATS_TEXT);
 }
 
 void rgb_display_draw_text_bg(int x, int y, const char *text, 
@@ -543,6 +736,7 @@ void rgb_display_draw_text_bg(int x, int y, const char *text,
 {
     if (!text) return;
     
+    RGB_STATS_BEGIN();
     int cur_x = x;
     while (*text) {
         if (*text == '\n') {
@@ -556,24 +750,28 @@ void rgb_display_draw_text_bg(int x, int y, const char *text,
         }
         text++;
     }
+    RGB_STATS_END(RGB_STATS_TEXT);
 }
 
 void rgb_display_draw_image(int x, int y, int w, int h, const uint16_t *data)
 {
     if (!data) return;
     
-    uint16_t *fb = rgb_display_get_framebuffer();
+    const rgb_surface_t *target = rgb_display_get_target();
+    uint16_t *fb = target->pixels;
     if (!fb) return;
     
-    for (int row = 0; row < h; row++) {
+    RGB_STATS_BEGIN();
+    int x0 = max_int(x, s_clip.x0);
+    int x1 = min_int(x + w, s_clip.x1);
+    
+    for (int row = 0; row < h && x1 > x0; row++) {
         int py = y + row;
-        if (py < 0 || py >= RGB_DISPLAY_HEIGHT) continue;
+        if (py < s_clip.y0 || py >= s_clip.y1) continue;
         
-        for (int col = 0; col < w; col++) {
-            int px = x + col;
-            if (px < 0 || px >= RGB_DISPLAY_WIDTH) continue;
-            
-            fb[py * RGB_DISPLAY_WIDTH + px] = data[row * w + col];
-        }
+        memcpy(&fb[py * target->width + x0], &data[row * w + (x0 - x)],
+               (x1 - x0) * sizeof(uint16_t));
+        RGB_STATS_PIXELS(x1 - x0);
     }
+    RGB_STATS_END(RGB_STATS_BLIT);
 }
@@ -0,0 +1,200 @@
+/*
+ * Retained Images
+ *
+ * Pixels are drawn straight from the image's buffer into the drawing
+ * target: RGB565 rows with memcpy, indexed pixels through the palette
+ * (or a tint palette given at draw time) and A8 coverage blended in the
+ * draw color. Indexed images always carry a full 16 or 256 entry palette
+ * so pixel values need no range check.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "rgb_image.h"
+#include "rgb_display.h"
+#include "rgb_stats.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "RGB_IMAGE";
+
+_Static_assert(sizeof(rgb_image_header_t) == 16, "rgb_image_header_t must match the asset header");
+
+static int palette_entries(rgb_image_format_t format)
+{
+    switch (format) {
+        case RGB_IMAGE_INDEXED4: return 16;
+        case RGB_IMAGE_INDEXED8: return 256;
+        default:                 return 0;
+    }
+}
+
+size_t rgb_image_stride(rgb_image_format_t format, int width)
+{
+    switch (format) {
+        case RGB_IMAGE_RGB565:   return (size_t)width * 2;
+        case RGB_IMAGE_INDEXED4: return ((size_t)width + 1) / 2;
+        default:                 return (size_t)width;
+    }
+}
+
+// Allocate the descriptor and a zeroed full-size palette
+static rgb_image_t *image_alloc(rgb_image_format_t format, int width, int height, int key)
+{
+    if (format >= RGB_IMAGE_FORMAT_COUNT || width <= 0 || height <= 0 ||
+        width > UINT16_MAX || height > UINT16_MAX ||
+        rgb_image_stride(format, width) > UINT16_MAX) {
+        return NULL;
+    }
+
+    rgb_image_t *image = calloc(1, sizeof(rgb_image_t));
+    if (!image) return NULL;
+
+    image->format = format;
+    image->width = width;
+    image->height = height;
+    image->stride = rgb_image_stride(format, width);
+    image->palette_size = palette_entries(format);
+    image->key = key;
+
+    if (image->palette_size) {
+        image->palette = heap_caps_calloc(image->palette_size, sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+        if (!image->palette) {
+            free(image);
+            return NULL;
+        }
+    }
+    return image;
+}
+
+rgb_image_t* rgb_image_create(rgb_image_format_t format, int width, int height,
+                              const void *data, const uint16_t *palette, int palette_size)
+{
+    rgb_image_t *image = image_alloc(format, width, height, RGB_IMAGE_NO_KEY);
+    if (!image) return NULL;
+
+    size_t size = (size_t)image->stride * height;
+    image->pixels = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (!image->pixels) {
+        ESP_LOGE(TAG, "Failed to allocate %dx%d image", width, height);
+        rgb_image_free(image);
+        return NULL;
+    }
+    if (data) {
+        memcpy(image->pixels, data, size);
+    }
+    if (palette) {
+        rgb_image_set_palette(image, 0, palette, palette_size);
+    }
+    return image;
+}
+
+rgb_image_t* rgb_image_map(const char *name)
+{
+    assets_map_t map;
+    if (assets_map(name, &map) != ESP_OK) return NULL;
+
+    const rgb_image_header_t *hdr = map.data;
+    rgb_image_t *image = NULL;
+    if (map.size >= sizeof(*hdr) && memcmp(hdr->magic, RGB_IMAGE_MAGIC, 4) == 0 &&
+        hdr->version == RGB_IMAGE_VERSION) {
+        image = image_alloc(hdr->format, hdr->width, hdr->height, hdr->key);
+    }
+    if (!image || hdr->palette_size > image->palette_size ||
+        sizeof(*hdr) + hdr->palette_size * sizeof(uint16_t) + (size_t)image->stride * image->height > map.size) {
+        ESP_LOGE(TAG, "Invalid image asset: %s", name);
+        rgb_image_free(image);
+        assets_unmap(&map);
+        return NULL;
+    }
+
+    const uint16_t *palette = (const uint16_t *)(hdr + 1);
+    rgb_image_set_palette(image, 0, palette, hdr->palette_size);
+    image->pixels = (uint8_t *)(palette + hdr->palette_size);
+    image->mapped = true;
+    image->map = map;
+    return image;
+}
+
+void rgb_image_free(rgb_image_t *image)
+{
+    if (!image) return;
+    if (image->mapped) {
+        assets_unmap(&image->map);
+    } else {
+        heap_caps_free(image->pixels);
+    }
+    heap_caps_free(image->palette);
+    free(image);
+}
+
+void rgb_image_set_palette(rgb_image_t *image, int first, const uint16_t *colors, int count)
+{
+    if (first < 0) return;
+    if (count > image->palette_size - first) count = image->palette_size - first;
+    if (count <= 0) return;
+    memcpy(&image->palette[first], colors, count * sizeof(uint16_t));
+    image->generation++;
+}
+
+static void draw_image(const rgb_image_t *image, int x, int y, const uint16_t *palette, uint16_t color)
+{
+    if (!image || !image->pixels) return;
+
+    const rgb_surface_t *target = rgb_display_get_target();
+    if (!target->pixels) return;
+
+    const rgb_display_clip_t *clip = rgb_display_get_clip();
+    int x0 = x > clip->x0 ? x : clip->x0;
+    int y0 = y > clip->y0 ? y : clip->y0;
+    int x1 = x + image->width < clip->x1 ? x + image->width : clip->x1;
+    int y1 = y + image->height < clip->y1 ? y + image->height : clip->y1;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    if (!palette) palette = image->palette;
+    const int key = image->key;
+    const int first = x0 - x;
+    const int count = x1 - x0;
+
+    for (int py = y0; py < y1; py++) {
+        const uint8_t *src = image->pixels + (size_t)(py - y) * image->stride;
+        uint16_t *dst = &target->pixels[py * target->width + x0];
+
+        switch (image->format) {
+            case RGB_IMAGE_RGB565:
+                memcpy(dst, src + first * 2, count * sizeof(uint16_t));
+                break;
+            case RGB_IMAGE_INDEXED8:
+                src += first;
+                for (int i = 0; i < count; i++) {
+                    if (src[i] != key) dst[i] = palette[src[i]];
+                }
+                break;
+            case RGB_IMAGE_INDEXED4:
+                for (int i = 0, sx = first; i < count; i++, sx++) {
+                    int index = (sx & 1) ? src[sx >> 1] & 0x0F : src[sx >> 1] >> 4;
+                    if (index != key) dst[i] = palette[index];
+                }
+                break;
+            case RGB_IMAGE_A8:
+                src += first;
+                for (int i = 0; i < count; i++) {
+                    uint32_t alpha = (src[i] + 4) >> 3;
+                    if (alpha >= 32) {
+                        dst[i] = color;
+                    } else if (alpha) {
+                        dst[i] = rgb565_blend(color, dst[i], alpha);
+                    }
+                }
+                break;
+        }
+    }
+    RGB_STATS_PIXELS((y1 - y0) * count);
+}
+
+void rgb_image_draw(const rgb_image_t *image, int x, int y, const uint16_t *palette, uint16_t color)
+{
+    RGB_STATS_BEGIN();
+    draw_image(image, x, y, palette, color);
+    RGB_STATS_END(RGB_STATS_IMAGE);
+}
@@ -0,0 +1,627 @@
+/*
+ * Retained Scene Graph
+ *
+ * Dirty state is kept in per-node flags that are always propagated to the
+ * root, so a render only descends into subtrees that changed: MEASURE and
+ * LAYOUT when a node's size can have changed (every ancestor's size and
+ * child placement may depend on it), PAINT when a node must be redrawn,
+ * and DESCEND on the ancestors of a PAINT node.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "rgb_scene.h"
+#include "rgb_display.h"
+
+#define NODE_MEASURE  0x01   // Measured size is stale
+#define NODE_LAYOUT   0x02   // Children must be placed again
+#define NODE_PAINT    0x04   // Repaint the node's bounds
+#define NODE_DESCEND  0x08   // A descendant has dirty flags
+#define NODE_PLACED   0x10   // box and bounds are from a render
+
+// Render state of a node used as a root
+typedef struct {
+    rgb_scene_rect_t damage[RGB_SCENE_MAX_DAMAGE];
+    int count;
+    bool full;
+    bool rendered;
+    const rgb_surface_t *target;
+    uint32_t clear_count;
+} scene_root_t;
+
+struct rgb_scene_node {
+    rgb_scene_type_t type;
+    uint8_t flags;
+    rgb_scene_node_t *parent;
+    rgb_scene_node_t *first, *last;     // Children
+    rgb_scene_node_t *prev, *next;      // Siblings
+    rgb_scene_props_t props;
+    char *text;
+    const rgb_image_t *image;
+    uint32_t image_generation;
+    int16_t content_w, content_h;       // Size of the content alone
+    int16_t measured_w, measured_h;     // With a fixed width or height applied
+    rgb_scene_rect_t box;               // Where the last layout put it
+    rgb_scene_rect_t bounds;            // box and the bounds of its children
+    scene_root_t *root;                 // Allocated when rendered as a root
+};
+
+static inline int min_int(int a, int b) { return a < b ? a : b; }
+static inline int max_int(int a, int b) { return a > b ? a : b; }
+
+static bool rect_empty(rgb_scene_rect_t r)
+{
+    return r.width <= 0 || r.height <= 0;
+}
+
+static bool rect_equal(rgb_scene_rect_t a, rgb_scene_rect_t b)
+{
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+static bool rect_overlap(rgb_scene_rect_t a, rgb_scene_rect_t b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+static bool rect_contains(rgb_scene_rect_t r, int x, int y)
+{
+    return x >= r.x && x < r.x + r.width && y >= r.y && y < r.y + r.height;
+}
+
+static rgb_scene_rect_t rect_union(rgb_scene_rect_t a, rgb_scene_rect_t b)
+{
+    if (rect_empty(a)) return b;
+    if (rect_empty(b)) return a;
+    int x0 = min_int(a.x, b.x), y0 = min_int(a.y, b.y);
+    int x1 = max_int(a.x + a.width, b.x + b.width);
+    int y1 = max_int(a.y + a.height, b.y + b.height);
+    return (rgb_scene_rect_t) { x0, y0, x1 - x0, y1 - y0 };
+}
+
+// ===================== Dirty flags =====================
+
+static void mark_layout(rgb_scene_node_t *node)
+{
+    node->flags |= NODE_MEASURE | NODE_LAYOUT | NODE_PAINT;
+    for (rgb_scene_node_t *p = node->parent; p; p = p->parent) {
+        p->flags |= NODE_MEASURE | NODE_LAYOUT | NODE_DESCEND;
+    }
+}
+
+static void mark_paint(rgb_scene_node_t *node)
+{
+    node->flags |= NODE_PAINT;
+    for (rgb_scene_node_t *p = node->parent; p; p = p->parent) {
+        p->flags |= NODE_DESCEND;
+    }
+}
+
+// Add a damaged rectangle, merging it with those it overlaps; when the
+// list is full it is merged into the one that grows least
+static void add_damage(scene_root_t *root, rgb_scene_rect_t r)
+{
+    if (rect_empty(r)) return;
+
+    for (int i = 0; i < root->count; ) {
+        if (rect_overlap(root->damage[i], r)) {
+            r = rect_union(r, root->damage[i]);
+            root->damage[i] = root->damage[--root->count];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    if (root->count < RGB_SCENE_MAX_DAMAGE) {
+        root->damage[root->count++] = r;
+        return;
+    }
+
+    int best = 0;
+    long best_growth = -1;
+    for (int i = 0; i < root->count; i++) {
+        rgb_scene_rect_t u = rect_union(root->damage[i], r);
+        long growth = (long)u.width * u.height - (long)root->damage[i].width * root->damage[i].height;
+        if (best_growth < 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    root->damage[best] = rect_union(root->damage[best], r);
+}
+
+// Damage where a node was drawn, if its tree has been rendered
+static void damage_drawn(rgb_scene_node_t *node)
+{
+    if (!(node->flags & NODE_PLACED)) return;
+    rgb_scene_node_t *top = node;
+    while (top->parent) top = top->parent;
+    if (top->root && top->root->rendered) add_damage(top->root, node->bounds);
+}
+
+// ===================== Nodes =====================
+
+rgb_scene_node_t* rgb_scene_node_create(rgb_scene_type_t type)
+{
+    rgb_scene_node_t *node = calloc(1, sizeof(rgb_scene_node_t));
+    if (!node) return NULL;
+
+    node->type = type;
+    node->flags = NODE_MEASURE | NODE_LAYOUT | NODE_PAINT;
+    node->props = (rgb_scene_props_t) {
+        .width = RGB_SCENE_AUTO,
+        .height = RGB_SCENE_AUTO,
+        .visible = true,
+        .color = RGB565_WHITE,
+        .filled = true,
+        .layout = RGB_SCENE_STACK,
+        .font = FONT_DEFAULT,
+    };
+    return node;
+}
+
+void rgb_scene_node_free(rgb_scene_node_t *node)
+{
+    if (!node) return;
+    rgb_scene_detach(node);
+    while (node->first) {
+        rgb_scene_detach(node->first);
+    }
+    free(node->text);
+    free(node->root);
+    free(node);
+}
+
+rgb_scene_type_t rgb_scene_node_type(const rgb_scene_node_t *node)
+{
+    return node->type;
+}
+
+const rgb_scene_props_t* rgb_scene_get_props(const rgb_scene_node_t *node)
+{
+    return &node->props;
+}
+
+void rgb_scene_set_props(rgb_scene_node_t *node, const rgb_scene_props_t *props)
+{
+    const rgb_scene_props_t *old = &node->props;
+    bool layout = old->x != props->x || old->y != props->y ||
+                  old->width != props->width || old->height != props->height ||
+                  old->visible != props->visible;
+    if (node->type == RGB_SCENE_GROUP) {
+        layout |= old->layout != props->layout || old->gap != props->gap ||
+                  old->padding != props->padding || old->align != props->align ||
+                  old->justify != props->justify;
+    }
+    if (node->type == RGB_SCENE_TEXT) {
+        // Alignment moves the text, and with it the node's bounds
+        layout |= old->font != props->font || old->align != props->align;
+    }
+    bool paint = old->color != props->color || old->filled != props->filled ||
+                 old->has_bg != props->has_bg || old->bg != props->bg ||
+                 old->has_border != props->has_border || old->border != props->border;
+
+    node->props = *props;
+    if (layout) {
+        mark_layout(node);
+    } else if (paint) {
+        mark_paint(node);
+    }
+}
+
+bool rgb_scene_set_text(rgb_scene_node_t *node, const char *text)
+{
+    if (node->text && strcmp(node->text, text) == 0) return true;
+
+    char *copy = strdup(text);
+    if (!copy) return false;
+    free(node->text);
+    node->text = copy;
+    mark_layout(node);
+    return true;
+}
+
+const char* rgb_scene_get_text(const rgb_scene_node_t *node)
+{
+    return node->text ? node->text : "";
+}
+
+void rgb_scene_set_image(rgb_scene_node_t *node, const rgb_image_t *image)
+{
+    uint32_t generation = image ? image->generation : 0;
+    if (node->image == image && node->image_generation == generation) return;
+
+    node->image = image;
+    node->image_generation = generation;
+    mark_layout(node);
+}
+
+bool rgb_scene_append(rgb_scene_node_t *parent, rgb_scene_node_t *child)
+{
+    for (rgb_scene_node_t *p = parent; p; p = p->parent) {
+        if (p == child) return false;
+    }
+    rgb_scene_detach(child);
+
+    child->parent = parent;
+    child->prev = parent->last;
+    child->next = NULL;
+    if (parent->last) {
+        parent->last->next = child;
+    } else {
+        parent->first = child;
+    }
+    parent->last = child;
+    mark_layout(child);
+    return true;
+}
+
+void rgb_scene_detach(rgb_scene_node_t *node)
+{
+    rgb_scene_node_t *parent = node->parent;
+    if (!parent) return;
+
+    damage_drawn(node);
+    if (node->prev) node->prev->next = node->next; else parent->first = node->next;
+    if (node->next) node->next->prev = node->prev; else parent->last = node->prev;
+    node->parent = node->prev = node->next = NULL;
+    // Its old box was damaged here, not when it is placed somewhere else
+    node->flags &= ~NODE_PLACED;
+    mark_layout(parent);
+}
+
+rgb_scene_node_t* rgb_scene_parent(const rgb_scene_node_t *node)
+{
+    return node->parent;
+}
+
+rgb_scene_node_t* rgb_scene_first_child(const rgb_scene_node_t *node)
+{
+    return node->first;
+}
+
+rgb_scene_node_t* rgb_scene_next_sibling(const rgb_scene_node_t *node)
+{
+    return node->next;
+}
+
+rgb_scene_rect_t rgb_scene_get_box(const rgb_scene_node_t *node)
+{
+    return node->box;
+}
+
+// ===================== Layout =====================
+
+static void measure(rgb_scene_node_t *node)
+{
+    if (!(node->flags & NODE_MEASURE)) return;
+
+    const rgb_scene_props_t *p = &node->props;
+    int w = 0, h = 0;
+
+    switch (node->type) {
+        case RGB_SCENE_RECT:
+            break;
+        case RGB_SCENE_TEXT: {
+            font_metrics_t metrics;
+            font_measure(font_get(p->font), node->text, &metrics);
+            w = metrics.width;
+            h = metrics.height;
+            break;
+        }
+        case RGB_SCENE_IMAGE:
+            if (node->image) {
+                w = node->image->width;
+                h = node->image->height;
+            }
+            break;
+        case RGB_SCENE_GROUP: {
+            int n = 0;
+            for (rgb_scene_node_t *c = node->first; c; c = c->next) {
+                if (!c->props.visible) continue;
+                measure(c);
+                n++;
+                if (p->layout == RGB_SCENE_ROW) {
+                    w += c->measured_w;
+                    h = max_int(h, c->measured_h);
+                } else if (p->layout == RGB_SCENE_COLUMN) {
+                    w = max_int(w, c->measured_w);
+                    h += c->measured_h;
+                } else {
+                    w = max_int(w, c->props.x + c->measured_w);
+                    h = max_int(h, c->props.y + c->measured_h);
+                }
+            }
+            if (n > 1 && p->layout == RGB_SCENE_ROW) w += p->gap * (n - 1);
+            if (n > 1 && p->layout == RGB_SCENE_COLUMN) h += p->gap * (n - 1);
+            w += 2 * p->padding;
+            h += 2 * p->padding;
+            break;
+        }
+    }
+
+    node->content_w = w;
+    node->content_h = h;
+    node->measured_w = p->width >= 0 ? p->width : w;
+    node->measured_h = p->height >= 0 ? p->height : h;
+    node->flags &= ~NODE_MEASURE;
+}
+
+static void place(scene_root_t *root, rgb_scene_node_t *node, rgb_scene_rect_t box);
+
+// Where a text or image node draws its content, which can spill out of a
+// fixed-size box
+static rgb_scene_rect_t content_rect(const rgb_scene_node_t *node)
+{
+    rgb_scene_rect_t r = { node->box.x, node->box.y, node->content_w, node->content_h };
+    if (node->type == RGB_SCENE_TEXT) {
+        if (node->props.align == RGB_SCENE_ALIGN_CENTER) r.x += (node->box.width - node->content_w) / 2;
+        if (node->props.align == RGB_SCENE_ALIGN_END) r.x += node->box.width - node->content_w;
+    }
+    return r;
+}
+
+// Size of a child along the cross axis, and its offset in the space
+static void cross_axis(const rgb_scene_props_t *p, int fixed, int measured, int space,
+                       int *size, int *offset)
+{
+    *size = measured;
+    if (p->align == RGB_SCENE_ALIGN_STRETCH && fixed < 0) *size = space;
+
+    switch (p->align) {
+        case RGB_SCENE_ALIGN_CENTER: *offset = (space - *size) / 2; break;
+        case RGB_SCENE_ALIGN_END:    *offset = space - *size;       break;
+        default:                     *offset = 0;                   break;
+    }
+}
+
+static void place_children(scene_root_t *root, rgb_scene_node_t *node)
+{
+    const rgb_scene_props_t *p = &node->props;
+    int cx = node->box.x + p->padding;
+    int cy = node->box.y + p->padding;
+    int cw = max_int(node->box.width - 2 * p->padding, 0);
+    int ch = max_int(node->box.height - 2 * p->padding, 0);
+
+    if (p->layout == RGB_SCENE_STACK) {
+        for (rgb_scene_node_t *c = node->first; c; c = c->next) {
+            if (!c->props.visible) {
+                place(root, c, (rgb_scene_rect_t) { 0 });
+                continue;
+            }
+            measure(c);
+            int w = c->measured_w, h = c->measured_h;
+            if (p->align == RGB_SCENE_ALIGN_STRETCH) {
+                if (c->props.width < 0) w = cw - c->props.x;
+                if (c->props.height < 0) h = ch - c->props.y;
+            }
+            place(root, c, (rgb_scene_rect_t) { cx + c->props.x, cy + c->props.y, w, h });
+        }
+        return;
+    }
+
+    // Rows and columns: main axis along x or y
+    bool row = p->layout == RGB_SCENE_ROW;
+    int start = row ? cx : cy;
+    int space = row ? cw : ch;
+    int total = 0;
+    int n = 0;
+    for (rgb_scene_node_t *c = node->first; c; c = c->next) {
+        if (!c->props.visible) continue;
+        measure(c);
+        total += row ? c->measured_w : c->measured_h;
+        n++;
+    }
+
+    int pos = start;
+    int spacing = p->gap;
+    int gaps = n > 1 ? p->gap * (n - 1) : 0;
+    switch (p->justify) {
+        case RGB_SCENE_JUSTIFY_CENTER:
+            pos = start + (space - total - gaps) / 2;
+            break;
+        case RGB_SCENE_JUSTIFY_END:
+            pos = start + space - total - gaps;
+            break;
+        case RGB_SCENE_JUSTIFY_BETWEEN:
+            if (n > 1) spacing = (space - total) / (n - 1);
+            break;
+        case RGB_SCENE_JUSTIFY_AROUND:
+            // Equal space around each child, so half of it at the ends
+            if (n > 0) {
+                spacing = (space - total) / n;
+                pos = start + spacing / 2;
+            }
+            break;
+        default:
+            break;
+    }
+
+    for (rgb_scene_node_t *c = node->first; c; c = c->next) {
+        if (!c->props.visible) {
+            place(root, c, (rgb_scene_rect_t) { 0 });
+            continue;
+        }
+        int size, offset;
+        if (row) {
+            cross_axis(p, c->props.height, c->measured_h, ch, &size, &offset);
+            place(root, c, (rgb_scene_rect_t) { pos, cy + offset, c->measured_w, size });
+            pos += c->measured_w + spacing;
+        } else {
+            cross_axis(p, c->props.width, c->measured_w, cw, &size, &offset);
+            place(root, c, (rgb_scene_rect_t) { cx + offset, pos, size, c->measured_h });
+            pos += c->measured_h + spacing;
+        }
+    }
+}
+
+// Give a node its box; unchanged nodes with nothing to lay out below them
+// are skipped. Moved nodes damage where they were and where they are now.
+static void place(scene_root_t *root, rgb_scene_node_t *node, rgb_scene_rect_t box)
+{
+    bool placed = node->flags & NODE_PLACED;
+    bool moved = !placed || !rect_equal(box, node->box);
+    if (!moved && !(node->flags & NODE_LAYOUT)) return;
+
+    rgb_scene_rect_t old_bounds = node->bounds;
+    node->box = box;
+    node->bounds = box;
+    if (rect_empty(box)) {
+        // Hidden: nothing drawn, children keep their boxes
+    } else if (node->type == RGB_SCENE_GROUP) {
+        place_children(root, node);
+        for (rgb_scene_node_t *c = node->first; c; c = c->next) {
+            node->bounds = rect_union(node->bounds, c->bounds);
+        }
+    } else if (node->type == RGB_SCENE_TEXT || node->type == RGB_SCENE_IMAGE) {
+        node->bounds = rect_union(box, content_rect(node));
+    }
+    node->flags = (node->flags & ~NODE_LAYOUT) | NODE_PLACED;
+
+    if (moved || !rect_equal(old_bounds, node->bounds)) {
+        if (placed) add_damage(root, old_bounds);
+        add_damage(root, node->bounds);
+    }
+}
+
+// Damage the bounds of nodes marked for painting and clear the marks
+static void collect_paint(scene_root_t *root, rgb_scene_node_t *node)
+{
+    if (node->flags & NODE_PAINT) add_damage(root, node->bounds);
+    if (node->flags & NODE_DESCEND) {
+        for (rgb_scene_node_t *c = node->first; c; c = c->next) {
+            collect_paint(root, c);
+        }
+    }
+    node->flags &= ~(NODE_PAINT | NODE_DESCEND);
+}
+
+// ===================== Painting =====================
+
+static void draw_node(const rgb_scene_node_t *node)
+{
+    const rgb_scene_props_t *p = &node->props;
+    rgb_scene_rect_t b = node->box;
+
+    switch (node->type) {
+        case RGB_SCENE_GROUP:
+            if (p->has_bg) rgb_display_draw_rect(b.x, b.y, b.width, b.height, p->bg, true);
+            break;
+        case RGB_SCENE_RECT:
+            rgb_display_draw_rect(b.x, b.y, b.width, b.height, p->color, p->filled);
+            break;
+        case RGB_SCENE_TEXT:
+            if (node->text) {
+                rgb_display_draw_text_font(content_rect(node).x, b.y, node->text, p->color, p->font);
+            }
+            break;
+        case RGB_SCENE_IMAGE:
+            rgb_image_draw(node->image, b.x, b.y, NULL, p->color);
+            break;
+    }
+    if (p->has_border && node->type != RGB_SCENE_TEXT && node->type != RGB_SCENE_IMAGE) {
+        rgb_display_draw_rect(b.x, b.y, b.width, b.height, p->border, false);
+    }
+}
+
+// Draw the nodes meeting area, in tree order (the clip is set to area)
+static void paint(const rgb_scene_node_t *node, rgb_scene_rect_t area)
+{
+    if (!node->props.visible || !rect_overlap(node->bounds, area)) return;
+
+    if (rect_overlap(node->type == RGB_SCENE_GROUP ? node->box : node->bounds, area)) {
+        draw_node(node);
+    }
+    for (const rgb_scene_node_t *c = node->first; c; c = c->next) {
+        paint(c, area);
+    }
+}
+
+// Whether what the root drew into target may be gone: screen clears only
+// erase the screen, so canvases keep their content across them
+static bool stale(const scene_root_t *root, const rgb_surface_t *target, uint32_t clear_count)
+{
+    if (!root->rendered || root->full || root->target != target) return true;
+    return target->pixels == rgb_display_get_framebuffer() && root->clear_count != clear_count;
+}
+
+bool rgb_scene_needs_render(const rgb_scene_node_t *root_node, const rgb_surface_t *target)
+{
+    if (!root_node->root) return true;
+    const rgb_surface_t *t = target ? target : rgb_display_get_target();
+    return stale(root_node->root, t, rgb_display_get_clear_count()) ||
+           (root_node->flags & (NODE_MEASURE | NODE_LAYOUT | NODE_PAINT | NODE_DESCEND));
+}
+
+int rgb_scene_render(rgb_scene_node_t *root_node, int *pixels)
+{
+    if (pixels) *pixels = 0;
+    if (!root_node->root) {
+        root_node->root = calloc(1, sizeof(scene_root_t));
+        if (!root_node->root) return 0;
+    }
+    scene_root_t *root = root_node->root;
+
+    const rgb_surface_t *target = rgb_display_get_target();
+    uint32_t clear_count = rgb_display_get_clear_count();
+    if (stale(root, target, clear_count)) {
+        root->full = true;
+    }
+
+    rgb_scene_rect_t box = { 0 };
+    if (root_node->props.visible) {
+        measure(root_node);
+        box = (rgb_scene_rect_t) {
+            root_node->props.x, root_node->props.y, root_node->measured_w, root_node->measured_h
+        };
+    }
+    place(root, root_node, box);
+    collect_paint(root, root_node);
+    if (root->full) add_damage(root, root_node->bounds);
+
+    // Repaint each damaged rectangle within the caller's clip
+    rgb_display_clip_t clip = *rgb_display_get_clip();
+    int painted = 0;
+    for (int i = 0; i < root->count; i++) {
+        rgb_scene_rect_t r = root->damage[i];
+        int x0 = max_int(r.x, clip.x0), y0 = max_int(r.y, clip.y0);
+        int x1 = min_int(r.x + r.width, clip.x1), y1 = min_int(r.y + r.height, clip.y1);
+        if (x1 <= x0 || y1 <= y0) continue;
+
+        rgb_display_set_clip(x0, y0, x1 - x0, y1 - y0);
+        paint(root_node, (rgb_scene_rect_t) { x0, y0, x1 - x0, y1 - y0 });
+        painted++;
+        if (pixels) *pixels += (x1 - x0) * (y1 - y0);
+    }
+    rgb_display_set_clip(clip.x0, clip.y0, clip.x1 - clip.x0, clip.y1 - clip.y0);
+
+    root->count = 0;
+    root->full = false;
+    root->rendered = true;
+    root->target = target;
+    root->clear_count = clear_count;
+    return painted;
+}
+
+void rgb_scene_invalidate(rgb_scene_node_t *root_node)
+{
+    if (root_node->root) root_node->root->full = true;
+}
+
+static rgb_scene_node_t* hit(rgb_scene_node_t *node, int x, int y)
+{
+    if (!node->props.visible || !(node->flags & NODE_PLACED) || !rect_contains(node->bounds, x, y)) {
+        return NULL;
+    }
+    for (rgb_scene_node_t *c = node->last; c; c = c->prev) {
+        rgb_scene_node_t *found = hit(c, x, y);
+        if (found) return found;
+    }
+    return rect_contains(node->box, x, y) ? node : NULL;
+}
+
+rgb_scene_node_t* rgb_scene_hit_test(rgb_scene_node_t *root, int x, int y)
+{
+    return hit(root, x, y);
+}
@@ -0,0 +1,91 @@
+/*
+ * Render Statistics
+ */
+
+#include <string.h>
+#include "rgb_stats.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+
+static const char *const s_names[RGB_STATS_COUNT] = {
+    [RGB_STATS_CLEAR]      = "clear",
+    [RGB_STATS_PIXEL]      = "pixel",
+    [RGB_STATS_HLINE]      = "hline",
+    [RGB_STATS_VLINE]      = "vline",
+    [RGB_STATS_LINE]       = "line",
+    [RGB_STATS_RECT]       = "rect",
+    [RGB_STATS_CIRCLE]     = "circle",
+    [RGB_STATS_TRIANGLE]   = "triangle",
+    [RGB_STATS_POLYLINE]   = "polyline",
+    [RGB_STATS_FILL_UNDER] = "fill_under",
+    [RGB_STATS_TEXT]       = "text",
+    [RGB_STATS_TEXT_FONT]  = "text_font",
+    [RGB_STATS_BLIT]       = "blit",
+    [RGB_STATS_IMAGE]      = "image",
+    [RGB_STATS_NUMERALS]   = "numerals",
+};
+
+// Start of the current counting window
+static int64_t s_since = 0;
+
+const char* rgb_stats_name(rgb_stats_prim_t prim)
+{
+    return prim < RGB_STATS_COUNT ? s_names[prim] : "?";
+}
+
+#if RGB_DISPLAY_STATS
+
+uint32_t rgb_stats_pixels = 0;
+uint32_t rgb_stats_glyphs = 0;
+
+static rgb_stats_entry_t s_entries[RGB_STATS_COUNT];
+
+// Nesting depth of instrumented calls; only the outermost one is charged
+static int s_depth = 0;
+
+void rgb_stats_begin(rgb_stats_mark_t *mark)
+{
+    if (s_depth++) return;
+    mark->pixels = rgb_stats_pixels;
+    mark->glyphs = rgb_stats_glyphs;
+    mark->cycles = esp_cpu_get_cycle_count();
+}
+
+void rgb_stats_end(rgb_stats_prim_t prim, const rgb_stats_mark_t *mark)
+{
+    if (--s_depth) return;
+    // The cycle counter wraps every ~18 s at 240 MHz; one call never spans that
+    uint32_t cycles = esp_cpu_get_cycle_count() - mark->cycles;
+    rgb_stats_entry_t *entry = &s_entries[prim];
+    entry->calls++;
+    entry->pixels += rgb_stats_pixels - mark->pixels;
+    entry->glyphs += rgb_stats_glyphs - mark->glyphs;
+    entry->cycles += cycles;
+}
+
+void rgb_stats_get(rgb_stats_entry_t out[RGB_STATS_COUNT], int64_t *window_us)
+{
+    memcpy(out, s_entries, sizeof(s_entries));
+    *window_us = esp_timer_get_time() - s_since;
+}
+
+void rgb_stats_reset(void)
+{
+    memset(s_entries, 0, sizeof(s_entries));
+    s_since = esp_timer_get_time();
+}
+
+#else
+
+void rgb_stats_get(rgb_stats_entry_t out[RGB_STATS_COUNT], int64_t *window_us)
+{
+    memset(out, 0, sizeof(rgb_stats_entry_t) * RGB_STATS_COUNT);
+    *window_us = esp_timer_get_time() - s_since;
+}
+
+void rgb_stats_reset(void)
+{
+    s_since = esp_timer_get_time();
+}
+
+#endif // RGB_DISPLAY_STATS
@@ -20,6 +20,20 @@ config.display = {
 	refresh_interval = tonumber(get_env("DISPLAY_REFRESH_INTERVAL", "300")),
 }
 
+-- Plugin fetches run at once on each refresh; plugins can set their own
+-- fetch_timeout (seconds) in their config
+config.fetch_concurrency = 3
+
+-- DNS answers are cached for their TTL, held to min_ttl..max_ttl
+-- (seconds); missing names for negative_ttl, and expired addresses are
+-- still used for stale_ttl while no DNS server answers
+config.dns = {
+	min_ttl = 60,
+	max_ttl = 3600,
+	negative_ttl = 30,
+	stale_ttl = 600,
+}
+
 config.theme = "minimal"
 config.layout = "default"
 
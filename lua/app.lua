@@ -16,6 +16,7 @@ local ui = nil
 
 app.running = false
 app.last_refresh = 0
+app.last_tick = 0
 app.refresh_interval = 300
 
 function app.load_config()
@@ -118,6 +119,10 @@ function app.connect_wifi()
 		return false
 	end
 
+	if dns and config.dns then
+		dns.config(config.dns)
+	end
+
 	print("Connecting to WiFi: " .. config.wifi.ssid)
 	local ok = wifi.connect(config.wifi.ssid, config.wifi.password)
 
@@ -143,16 +148,37 @@ function app.fetch_data()
 	print("Data fetch complete")
 end
 
-function app.draw_current_screen()
-	if not screen_manager or not theme then
+-- Start a refresh in the background. The fetches run in a coroutine that
+-- the main loop resumes; plugins_manager.fetch_all yields inside it while
+-- requests are on the HTTP workers, so touch and ticks keep running
+-- meanwhile.
+function app.start_fetch()
+	if app.fetching or not plugins_manager then
 		return
 	end
+	print("Fetching data...")
+	app.fetching = coroutine.create(plugins_manager.fetch_all)
+end
 
-	local screen = screen_manager.get_current()
-	if not screen then
-		return
+-- Resume a background refresh; true when it finished on this call
+function app.step_fetch()
+	if not app.fetching then
+		return false
+	end
+	local ok, err = coroutine.resume(app.fetching)
+	if not ok then
+		print("Fetch error: " .. tostring(err))
+	end
+	if coroutine.status(app.fetching) ~= "dead" then
+		return false
 	end
+	app.fetching = nil
+	app.last_refresh = os.time()
+	print("Data fetch complete")
+	return true
+end
 
+local function draw_screen(screen)
 	-- Clear display
 	display.clear(theme.colors.bg_primary)
 
@@ -160,13 +186,7 @@ function app.draw_current_screen()
 	app.draw_header(screen.name:upper())
 
 	-- Get layout for this screen
-	local screen_layout = layout
-	if screen.layout then
-		local ok, l = pcall(require, "config.layouts." .. screen.layout)
-		if ok then
-			screen_layout = l
-		end
-	end
+	local screen_layout = app.get_screen_layout(screen)
 
 	-- Draw widgets in slots
 	if screen.widgets and screen_layout and plugins_manager then
@@ -185,6 +205,74 @@ function app.draw_current_screen()
 	app.draw_status_bar()
 end
 
+function app.draw_current_screen()
+	if not screen_manager or not theme then
+		return
+	end
+
+	local screen = screen_manager.get_current()
+	if not screen then
+		return
+	end
+
+	-- Record the screen as a frame so only what changed since the last
+	-- one is drawn
+	display.begin_frame()
+	local ok, err = pcall(draw_screen, screen)
+	display.end_frame()
+	if not ok then
+		print("Screen draw error: " .. tostring(err))
+	end
+end
+
+function app.get_screen_layout(screen)
+	if screen.layout then
+		local ok, l = pcall(require, "config.layouts." .. screen.layout)
+		if ok then
+			return l
+		end
+	end
+	return layout
+end
+
+-- Content area of a widget panel (inside the border and title)
+local function panel_content(slot)
+	return slot.x + 10, slot.y + 25, slot.width - 20, slot.height - 30
+end
+
+-- Let widgets on the current screen update in place without a full redraw
+function app.tick_current_screen()
+	if not screen_manager or not theme or not plugins_manager then
+		return
+	end
+
+	local screen = screen_manager.get_current()
+	if not screen or not screen.widgets then
+		return
+	end
+
+	local screen_layout = app.get_screen_layout(screen)
+	if not screen_layout then
+		return
+	end
+
+	local ticked = false
+	for _, widget in ipairs(screen.widgets) do
+		local slot = screen_layout.slots[widget.slot]
+		if slot then
+			local x, y, w, h = panel_content(slot)
+			if plugins_manager.tick_slot(widget.name, x, y, w, h, theme, slot.size) then
+				ticked = true
+			end
+		end
+	end
+
+	-- Ticks draw outside frames, so the next frame can't trust its diff
+	if ticked then
+		display.invalidate()
+	end
+end
+
 function app.draw_header(title)
 	if not theme then
 		return
@@ -213,14 +301,13 @@ function app.draw_widget_panel(plugin_name, slot)
 
 	-- Draw plugin title
 	local title = plugin_name:upper()
-	local title_w = #title * 10 + 10
+	local title_w = display.measure(title, display.FONT_INTER_20) + 10
 	display.rect(slot.x + 5, slot.y - 2, title_w, 20, t.bg_panel, true)
 	display.text_font(slot.x + 10, slot.y + 2, title, t.accent_secondary, display.FONT_INTER_20)
 
 	-- Render plugin content
-	local content_y = slot.y + 25
-	local content_h = slot.height - 30
-	plugins_manager.render_slot(plugin_name, slot.x + 10, content_y, slot.width - 20, content_h, theme, slot.size)
+	local x, y, w, h = panel_content(slot)
+	plugins_manager.render_slot(plugin_name, x, y, w, h, theme, slot.size)
 end
 
 function app.draw_screen_indicator()
@@ -380,16 +467,24 @@ function app.run()
 			end
 		end
 
-		-- Check for refresh
+		-- Tick widgets once per second
 		local now = os.time()
+		if now ~= app.last_tick then
+			app.last_tick = now
+			app.tick_current_screen()
+		end
+
+		-- Check for refresh
 		if now - last_refresh_check >= app.refresh_interval then
 			last_refresh_check = now
 			if wifi and wifi.is_connected() then
 				print("Refreshing...")
-				app.fetch_data()
-				app.draw_current_screen()
+				app.start_fetch()
 			end
 		end
+		if app.step_fetch() then
+			app.draw_current_screen()
+		end
 	end
 end
 
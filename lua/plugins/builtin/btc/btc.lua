@@ -1,6 +1,9 @@
 local Plugin = require("plugins.base")
 local api = require("plugins.builtin.btc.api")
 
+-- Numeral cell height for the price per widget size
+local PRICE_SIZES = { full = 96, half_v = 64, half_h = 64, quarter = 56 }
+
 return Plugin.new({
 	name = "btc",
 	version = "1.0.0",
@@ -47,21 +50,22 @@ return Plugin.new({
 		local symbol = { USD = "$", EUR = "€", GBP = "£" }
 		local prefix = symbol[data.currency] or "$"
 
+		local price_str = string.format("%s%s", prefix, api.format_number(data.price))
+		local digits = PRICE_SIZES[size] or 64
+
 		if size == "quarter" then
 			display.text_font(x, y, "BTC", theme.colors.accent_tertiary, theme.fonts.title)
-			local price_str = string.format("%s%s", prefix, api.format_number(data.price))
-			display.text_font(x, y + 25, price_str, theme.colors.text_primary, theme.fonts.body)
+			display.numerals(x, y + 25, price_str, digits, theme.colors.text_primary, theme.colors.bg_panel)
 		else
 			display.text_font(x, y, "Bitcoin", theme.colors.accent_tertiary, theme.fonts.heading)
-
-			local price_str = string.format("%s%s", prefix, api.format_number(data.price))
-			display.text_font(x, y + 40, price_str, theme.colors.text_primary, theme.fonts.title)
+			display.numerals(x, y + 28, price_str, digits, theme.colors.text_primary, theme.colors.bg_panel)
+			local below = y + 28 + digits
 
 			if self.config.show_24h_change and data.change_24h then
 				local change_color = data.change_24h >= 0 and theme.colors.accent_success or theme.colors.accent_error
 				local arrow = data.change_24h >= 0 and "↑" or "↓"
 				local change_str = string.format("%s %.2f%%", arrow, math.abs(data.change_24h))
-				display.text_font(x, y + 70, change_str, change_color, theme.fonts.body)
+				display.text_font(x, below + 4, change_str, change_color, theme.fonts.body)
 			end
 
 			if data.high_24h and data.low_24h then
@@ -72,7 +76,7 @@ return Plugin.new({
 					prefix,
 					api.format_number(data.low_24h)
 				)
-				display.text_font(x, y + 95, range_str, theme.colors.text_muted, theme.fonts.small)
+				display.text_font(x, below + 29, range_str, theme.colors.text_muted, theme.fonts.small)
 			end
 		end
 	end,
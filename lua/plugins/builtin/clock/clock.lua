@@ -1,5 +1,57 @@
 local Plugin = require("plugins.base")
 
+-- Numeral cell height per widget size
+local DIGIT_SIZES = { full = 96, half_v = 64, half_h = 64, quarter = 56 }
+
+local function format_time(config, now)
+	local hour = now.hour
+	local period = ""
+
+	if not config.format_24h then
+		period = hour >= 12 and "PM" or "AM"
+		hour = hour % 12
+		if hour == 0 then
+			hour = 12
+		end
+	end
+
+	local time_str
+	if config.show_seconds then
+		time_str = string.format("%d:%02d:%02d", hour, now.min, now.sec)
+	else
+		time_str = string.format("%d:%02d", hour, now.min)
+	end
+	return time_str, period
+end
+
+-- Draws the current time; returns the numeral cell height
+local function draw_time(self, x, y, theme, size)
+	local digits = DIGIT_SIZES[size] or 64
+	local bg = theme.colors.bg_panel
+	local time_str, period = format_time(self.config, os.date("*t"))
+
+	local w = display.numerals(x, y, time_str, digits, theme.colors.accent_primary, bg)
+
+	-- AM/PM sits beside the digit tops and moves when the time gets narrower
+	local period_x = x + w + 8
+	if period ~= "" and (period ~= self.period or period_x ~= self.period_x) then
+		local period_y = y + math.floor(digits / 10)
+		-- Only the part of the old period beyond the digits: wider digits have
+		-- been drawn over the rest, and their cells are not repainted later
+		if self.period_x then
+			local erase_x = math.max(self.period_x, x + w)
+			local erase_w = self.period_x + 40 - erase_x
+			if erase_w > 0 then
+				display.rect(erase_x, period_y, erase_w, 24, bg, true)
+			end
+		end
+		display.text_font(period_x, period_y, period, theme.colors.accent_primary, theme.fonts.heading)
+		self.period = period
+		self.period_x = period_x
+	end
+	return digits
+end
+
 return Plugin.new({
 	name = "clock",
 	version = "1.0.0",
@@ -44,37 +96,21 @@ return Plugin.new({
 			data = os.date("*t")
 		end
 
-		local hour = data.hour
-		local period = ""
+		self.period_x = nil
+		local digits = draw_time(self, x, y, theme, size)
 
-		if not self.config.format_24h then
-			period = hour >= 12 and " PM" or " AM"
-			hour = hour % 12
-			if hour == 0 then
-				hour = 12
-			end
-		end
+		if size ~= "quarter" and self.config.show_date then
+			local weekdays = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" }
+			local months = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" }
 
-		local time_str
-		if self.config.show_seconds then
-			time_str = string.format("%d:%02d:%02d%s", hour, data.min, data.sec, period)
-		else
-			time_str = string.format("%d:%02d%s", hour, data.min, period)
+			local date_str =
+				string.format("%s, %s %d, %d", weekdays[data.wday], months[data.month], data.day, data.year)
+			display.text_font(x, y + digits + 8, date_str, theme.colors.text_secondary, theme.fonts.body)
 		end
+	end,
 
-		if size == "quarter" then
-			display.text_font(x, y, time_str, theme.colors.accent_primary, theme.fonts.title)
-		else
-			display.text_font(x, y, time_str, theme.colors.accent_primary, theme.fonts.heading)
-
-			if self.config.show_date then
-				local weekdays = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" }
-				local months = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" }
-
-				local date_str =
-					string.format("%s, %s %d, %d", weekdays[data.wday], months[data.month], data.day, data.year)
-				display.text_font(x, y + 40, date_str, theme.colors.text_secondary, theme.fonts.body)
-			end
-		end
+	-- Only the digit cells that changed since the last second are redrawn
+	on_tick = function(self, x, y, w, h, theme, size)
+		draw_time(self, x, y, theme, size)
 	end,
 })
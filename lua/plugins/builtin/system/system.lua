@@ -26,10 +26,30 @@ local function format_uptime(seconds)
 	end
 end
 
+-- Share of CPU time spent drawing since the last call, and the primitive
+-- that cost the most
+local function render_cost()
+	if not (display and display.stats) then
+		return nil
+	end
+	local stats = display.stats(true)
+	if not stats.enabled or stats.window_us <= 0 then
+		return nil
+	end
+
+	local top, top_us = nil, 0
+	for name, entry in pairs(stats) do
+		if type(entry) == "table" and name ~= "total" and entry.us > top_us then
+			top, top_us = name, entry.us
+		end
+	end
+	return stats.total.us * 100 / stats.window_us, top, top_us * 100 / stats.window_us
+end
+
 return Plugin.new({
 	name = "system",
 	version = "1.0.0",
-	description = "System information (memory, WiFi, battery)",
+	description = "System information (memory, WiFi, battery, render cost)",
 	author = "Moondeck",
 
 	config_schema = {
@@ -37,6 +57,7 @@ return Plugin.new({
 		show_wifi = { type = "boolean", default = true },
 		show_battery = { type = "boolean", default = true },
 		show_uptime = { type = "boolean", default = true },
+		show_render = { type = "boolean", default = true },
 	},
 
 	default_config = {
@@ -44,6 +65,7 @@ return Plugin.new({
 		show_wifi = true,
 		show_battery = true,
 		show_uptime = true,
+		show_render = true,
 	},
 
 	fetch_interval = 10,
@@ -87,6 +109,8 @@ return Plugin.new({
 			data.uptime = os.time() % 86400
 		end
 
+		data.render_load, data.render_top, data.render_top_load = render_cost()
+
 		return data
 	end,
 
@@ -163,6 +187,19 @@ return Plugin.new({
 
 				local uptime_str = format_uptime(data.uptime)
 				display.text_font(x, line_y, uptime_str, theme.colors.text_primary, theme.fonts.body)
+				line_y = line_y + line_height
+			end
+
+			if self.config.show_render and data.render_load and line_y + 18 + line_height <= y + h then
+				display.text_font(x, line_y, "Render", theme.colors.text_muted, theme.fonts.small)
+				line_y = line_y + 18
+
+				local render_str = string.format("%.1f%% CPU", data.render_load)
+				display.text_font(x, line_y, render_str, theme.colors.text_primary, theme.fonts.body)
+				if data.render_top then
+					local top_str = string.format("(%s %.1f%%)", data.render_top, data.render_top_load)
+					display.text_font(x + 100, line_y, top_str, theme.colors.text_secondary, theme.fonts.small)
+				end
 			end
 		end
 	end,
@@ -1,5 +1,65 @@
 local Plugin = require("plugins.base")
 
+-- The list is a retained scene rendered into a canvas: frames only blit
+-- the canvas, and the nodes are rebuilt when the data or theme change
+local function build_list(self, list, theme)
+	local data = self.data
+	local root = list.root
+	root:clear()
+	root.bg = theme.colors.bg_panel
+
+	root:add(scene.text({ text = "Todo", color = theme.colors.accent_primary, font = theme.fonts.title }))
+	root:add(scene.text({
+		x = 60,
+		y = 3,
+		text = string.format("(%d items)", data.total),
+		color = theme.colors.text_muted,
+		font = theme.fonts.small,
+	}))
+
+	local line_y = 35
+	local line_height = 25
+	local max_items = math.min(self.config.max_items, #data.items)
+
+	local priority_colors = {
+		[1] = theme.colors.accent_error,
+		[2] = theme.colors.accent_warning,
+		[3] = theme.colors.text_muted,
+	}
+
+	for i = 1, max_items do
+		local item = data.items[i]
+		if not item then
+			break
+		end
+
+		local checkbox = item.completed and "☑" or "☐"
+		local text_color = item.completed and theme.colors.text_muted or theme.colors.text_primary
+		local priority_color = priority_colors[item.priority] or theme.colors.text_muted
+
+		root:add(scene.text({ y = line_y, text = checkbox, color = priority_color, font = theme.fonts.body }))
+
+		local text = item.text
+		local max_chars = math.floor((list.w - 30) / 8)
+		if #text > max_chars then
+			text = text:sub(1, max_chars - 3) .. "..."
+		end
+
+		root:add(scene.text({ x = 25, y = line_y, text = text, color = text_color, font = theme.fonts.body }))
+
+		line_y = line_y + line_height
+	end
+
+	if #data.items > max_items then
+		local more_str = string.format("+%d more", #data.items - max_items)
+		root:add(scene.text({ y = line_y, text = more_str, color = theme.colors.text_muted, font = theme.fonts.small }))
+	end
+
+	list.data = data
+	list.theme = theme
+	list.max_items = self.config.max_items
+end
+
 return Plugin.new({
 	name = "todo",
 	version = "1.0.0",
@@ -73,47 +133,16 @@ return Plugin.new({
 			return
 		end
 
-		display.text_font(x, y, "Todo", theme.colors.accent_primary, theme.fonts.title)
-
-		local count_str = string.format("(%d items)", data.total)
-		display.text_font(x + 60, y + 3, count_str, theme.colors.text_muted, theme.fonts.small)
-
-		local line_y = y + 35
-		local line_height = 25
-		local max_items = math.min(self.config.max_items, #data.items)
-
-		local priority_colors = {
-			[1] = theme.colors.accent_error,
-			[2] = theme.colors.accent_warning,
-			[3] = theme.colors.text_muted,
-		}
-
-		for i = 1, max_items do
-			local item = data.items[i]
-			if not item then
-				break
-			end
-
-			local checkbox = item.completed and "☑" or "☐"
-			local text_color = item.completed and theme.colors.text_muted or theme.colors.text_primary
-			local priority_color = priority_colors[item.priority] or theme.colors.text_muted
-
-			display.text_font(x, line_y, checkbox, priority_color, theme.fonts.body)
-
-			local text = item.text
-			local max_chars = math.floor((w - 30) / 8)
-			if #text > max_chars then
-				text = text:sub(1, max_chars - 3) .. "..."
-			end
-
-			display.text_font(x + 25, line_y, text, text_color, theme.fonts.body)
-
-			line_y = line_y + line_height
+		local list = self.list
+		if not list or list.w ~= w or list.h ~= h then
+			list = { w = w, h = h, canvas = display.canvas(w, h), root = scene.group({ w = w, h = h }) }
+			self.list = list
 		end
-
-		if #data.items > max_items then
-			local more_str = string.format("+%d more", #data.items - max_items)
-			display.text_font(x, line_y, more_str, theme.colors.text_muted, theme.fonts.small)
+		if list.data ~= data or list.theme ~= theme or list.max_items ~= self.config.max_items then
+			build_list(self, list, theme)
 		end
+
+		list.root:render(list.canvas)
+		display.blit(list.canvas, x, y)
 	end,
 })
@@ -9,7 +9,27 @@ local icon_chars = {
     fog = "🌫",
 }
 
+-- Decoded image assets ("weather_<condition>" and "weather_<condition>_small",
+-- QOI or PNG) blended onto the panel background, keyed by name and that
+-- background; false when missing
+local images = {}
+
+local function get_image(condition, size, bg)
+    local name = "weather_" .. condition .. (size == "small" and "_small" or "")
+    local key = name .. ":" .. bg
+    if images[key] == nil then
+        images[key] = image and image.load_asset(name, bg) or false
+    end
+    return images[key]
+end
+
 function icons.draw(x, y, condition, theme, size)
+    local img = get_image(condition or "clear", size, theme.colors.bg_panel or 0)
+    if img then
+        display.image(x, y, img)
+        return
+    end
+
     local icon = icon_chars[condition] or icon_chars.clear
     local font = size == "small" and theme.fonts.body or theme.fonts.heading
     local color = theme.colors.accent_tertiary
@@ -13,12 +13,14 @@ function Plugin.new(spec)
 	self.data = nil
 	self.last_fetch = 0
 	self.fetch_interval = spec.fetch_interval or 300
+	self.fetch_timeout = spec.fetch_timeout or 15
 	self.error = nil
 	self.on_init = spec.on_init or function() end
 	self.on_fetch = spec.on_fetch or function()
 		return nil
 	end
 	self.on_render = spec.on_render or function() end
+	self.on_tick = spec.on_tick
 	self.on_destroy = spec.on_destroy or function() end
 	self.sizes = spec.sizes or { "full", "half_v", "half_h", "quarter" }
 	return self
@@ -32,6 +34,7 @@ function Plugin:init(config)
 	for k, v in pairs(config or {}) do
 		self.config[k] = v
 	end
+	self.fetch_timeout = self.config.fetch_timeout or self.fetch_timeout
 	self:on_init()
 end
 
@@ -39,11 +42,8 @@ function Plugin:should_fetch()
 	return (os.time() - self.last_fetch) >= self.fetch_interval
 end
 
-function Plugin:fetch()
-	if not self:should_fetch() then
-		return self.data
-	end
-	local ok, result = pcall(self.on_fetch, self)
+-- Take the outcome of on_fetch: true and its result, or false and an error
+function Plugin:fetched(ok, result)
 	if ok then
 		self.data = result
 		self.last_fetch = os.time()
@@ -54,6 +54,13 @@ function Plugin:fetch()
 	return self.data
 end
 
+function Plugin:fetch()
+	if not self:should_fetch() then
+		return self.data
+	end
+	return self:fetched(pcall(self.on_fetch, self))
+end
+
 function Plugin:render(x, y, w, h, theme, size)
 	if self.error then
 		display.text_font(x + 10, y + 20, "Error", theme.colors.accent_error, theme.fonts.body)
@@ -63,6 +70,16 @@ function Plugin:render(x, y, w, h, theme, size)
 	self:on_render(x, y, w, h, theme, size)
 end
 
+-- Called once per second between full renders; plugins that define
+-- on_tick redraw only what changed in their content area; true when on_tick ran
+function Plugin:tick(x, y, w, h, theme, size)
+	if self.error or not self.on_tick then
+		return false
+	end
+	self:on_tick(x, y, w, h, theme, size)
+	return true
+end
+
 function Plugin:destroy()
 	self:on_destroy()
 end
@@ -4,8 +4,12 @@ local manager = {}
 
 manager.active_plugins = {}
 
+-- Plugin fetches in flight at once (config.fetch_concurrency)
+manager.max_in_flight = 3
+
 function manager.init(config)
 	print("Plugins manager initializing...")
+	manager.max_in_flight = config.fetch_concurrency or manager.max_in_flight
 	registry.discover()
 	print("Discovered plugins: " .. table.concat(registry.list(), ", "))
 
@@ -36,13 +40,67 @@ function manager.init(config)
 	end
 end
 
+local function millis()
+	if sys and sys.millis then
+		return sys.millis()
+	end
+	return os.time() * 1000
+end
+
+-- Fetch every plugin that is due, up to max_in_flight at a time. Each
+-- on_fetch runs in its own coroutine, which http.get yields while the
+-- request is on an HTTP worker, so the requests overlap. A plugin takes
+-- its result as soon as its own fetch finishes, or an error once its
+-- fetch_timeout (seconds) has passed. Yields between rounds when called
+-- from a coroutine, else blocks until all are done.
 function manager.fetch_all()
+	local due = {}
 	for _, entry in pairs(manager.active_plugins) do
-		entry.plugin:fetch()
+		if entry.plugin:should_fetch() then
+			table.insert(due, entry.plugin)
+		end
+	end
+
+	local running = {}
+	local next_due = 1
+	while next_due <= #due or #running > 0 do
+		while #running < manager.max_in_flight and next_due <= #due do
+			local plugin = due[next_due]
+			next_due = next_due + 1
+			table.insert(running, {
+				plugin = plugin,
+				co = coroutine.create(function()
+					return plugin.on_fetch(plugin)
+				end),
+				deadline = millis() + plugin.fetch_timeout * 1000,
+			})
+		end
+
+		for i = #running, 1, -1 do
+			local job = running[i]
+			local ok, result = coroutine.resume(job.co)
+			if coroutine.status(job.co) == "dead" then
+				job.plugin:fetched(ok, result)
+				table.remove(running, i)
+			elseif millis() >= job.deadline then
+				-- Its request is dropped once the handle is collected
+				coroutine.close(job.co)
+				job.plugin:fetched(false, "Fetch timed out")
+				table.remove(running, i)
+			end
+		end
+
+		if #running > 0 then
+			if coroutine.isyieldable() then
+				coroutine.yield()
+			elseif http then
+				http.wait_any(50)
+			end
+		end
 	end
 end
 
-function manager.render_slot(slot_or_name, x, y, w, h, theme, size)
+local function find_entry(slot_or_name)
 	-- Try direct slot lookup first
 	local entry = manager.active_plugins[slot_or_name]
 	-- Fall back to name lookup
@@ -54,11 +112,24 @@ function manager.render_slot(slot_or_name, x, y, w, h, theme, size)
 			end
 		end
 	end
+	return entry
+end
+
+function manager.render_slot(slot_or_name, x, y, w, h, theme, size)
+	local entry = find_entry(slot_or_name)
 	if entry then
 		entry.plugin:render(x, y, w, h, theme, size)
 	end
 end
 
+function manager.tick_slot(slot_or_name, x, y, w, h, theme, size)
+	local entry = find_entry(slot_or_name)
+	if entry then
+		return entry.plugin:tick(x, y, w, h, theme, size)
+	end
+	return false
+end
+
 function manager.get_plugin(slot_or_name)
 	if manager.active_plugins[slot_or_name] then
 		return manager.active_plugins[slot_or_name].plugin
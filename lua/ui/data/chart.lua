@@ -56,20 +56,11 @@ function Chart:draw(theme)
 
     -- Draw data
     local step = w / (#data - 1)
-    local prev_px, prev_py
 
-    for i, v in ipairs(data) do
-        local px = x + (i - 1) * step
-        local py = y + h - ((v - min_val) / range * h)
-
-        if self.type == "line" and prev_px then
-            display.line(
-                math.floor(prev_px), math.floor(prev_py),
-                math.floor(px), math.floor(py),
-                color
-            )
-        elseif self.type == "bar" then
-            local bar_w = math.floor(step * 0.8)
+    if self.type == "bar" then
+        local bar_w = math.floor(step * 0.8)
+        for i, v in ipairs(data) do
+            local px = x + (i - 1) * step
             local bar_h = math.floor((v - min_val) / range * h)
             display.rect(
                 math.floor(px - bar_w/2),
@@ -77,21 +68,24 @@ function Chart:draw(theme)
                 bar_w, bar_h,
                 color, true
             )
-        elseif self.type == "area" and prev_px then
-            display.line(
-                math.floor(prev_px), math.floor(prev_py),
-                math.floor(px), math.floor(py),
-                color
-            )
-            -- Fill area below line
-            for fx = math.floor(prev_px), math.floor(px) do
-                local t = (fx - prev_px) / (px - prev_px)
-                local fy = prev_py + t * (py - prev_py)
-                display.line(fx, math.floor(fy), fx, math.floor(y + h), theme.colors.bg_secondary)
-            end
+        end
+    else
+        -- Point arrays are reused between frames; the display functions
+        -- floor the coordinates and draw the whole series in one call
+        local xs, ys = self._xs or {}, self._ys or {}
+        self._xs, self._ys = xs, ys
+        for i, v in ipairs(data) do
+            xs[i] = x + (i - 1) * step
+            ys[i] = y + h - ((v - min_val) / range * h)
+        end
+        for i = #data + 1, #xs do
+            xs[i], ys[i] = nil, nil
         end
 
-        prev_px, prev_py = px, py
+        if self.type == "area" then
+            display.fill_under(xs, ys, math.floor(y + h), theme.colors.bg_secondary)
+        end
+        display.polyline(xs, ys, color)
     end
 
     -- Draw labels
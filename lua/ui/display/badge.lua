@@ -17,11 +17,10 @@ function Badge.new(props)
 end
 
 function Badge:measure(max_width, max_height)
-    local char_width = self.size == "small" and 6 or 8
-    local padding = self.size == "small" and 8 or 12
+    local padding = self.size == "small" and 4 or 6
     local height = self.size == "small" and 18 or 24
 
-    local text_width = #self.content * char_width + padding * 2
+    local text_width = display.measure(self.content, display.FONT_DEFAULT) + padding * 2
     return math.min(text_width, max_width), height
 end
 
@@ -40,9 +39,9 @@ function Badge:draw(theme)
     local char_width = self.size == "small" and 6 or 8
     local padding = self.size == "small" and 4 or 6
     local badge_height = self.size == "small" and 18 or 24
-    local badge_width = #self.content * char_width + padding * 2
 
     local font = self.size == "small" and theme.fonts.small or theme.fonts.body
+    local badge_width = display.measure(self.content, font) + padding * 2
 
     if self.variant == "filled" then
         display.rect(
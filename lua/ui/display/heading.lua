@@ -2,12 +2,12 @@ local Heading = {}
 Heading.__index = Heading
 
 local HEADING_SIZES = {
-    h1 = { char_width = 14, line_height = 32 },
-    h2 = { char_width = 12, line_height = 28 },
-    h3 = { char_width = 10, line_height = 24 },
-    h4 = { char_width = 9, line_height = 22 },
-    h5 = { char_width = 8, line_height = 20 },
-    h6 = { char_width = 7, line_height = 18 },
+    h1 = { line_height = 32 },
+    h2 = { line_height = 28 },
+    h3 = { line_height = 24 },
+    h4 = { line_height = 22 },
+    h5 = { line_height = 20 },
+    h6 = { line_height = 18 },
 }
 
 function Heading.new(props)
@@ -27,9 +27,24 @@ function Heading:get_size_key()
     return "h" .. math.max(1, math.min(6, self.level))
 end
 
+-- Font for this level; without a theme, the built-in fonts the themes map to
+function Heading:get_font(theme)
+    local fonts = theme and theme.fonts or {
+        heading = display.FONT_GARAMOND_20,
+        title = display.FONT_GARAMOND_20,
+        body = display.FONT_DEFAULT,
+    }
+    if self.level <= 2 then
+        return fonts.heading
+    elseif self.level <= 4 then
+        return fonts.title
+    end
+    return fonts.body
+end
+
 function Heading:measure(max_width, max_height)
     local size = HEADING_SIZES[self:get_size_key()]
-    local text_width = #self.content * size.char_width
+    local text_width = display.measure(self.content, self:get_font())
     return math.min(text_width, max_width), size.line_height
 end
 
@@ -42,24 +57,14 @@ end
 
 function Heading:draw(theme)
     local color = self.color or theme.colors.text_primary
-    local size = HEADING_SIZES[self:get_size_key()]
-
-    -- Select font based on level
-    local font
-    if self.level <= 2 then
-        font = theme.fonts.heading
-    elseif self.level <= 4 then
-        font = theme.fonts.title
-    else
-        font = theme.fonts.body
-    end
+    local font = self:get_font(theme)
 
     local text_x = self.x
     if self.align == "center" then
-        local text_width = #self.content * size.char_width
+        local text_width = display.measure(self.content, font)
         text_x = self.x + (self.width - text_width) / 2
     elseif self.align == "right" then
-        local text_width = #self.content * size.char_width
+        local text_width = display.measure(self.content, font)
         text_x = self.x + self.width - text_width
     end
 
@@ -17,20 +17,19 @@ function Text.new(props)
 end
 
 function Text:measure(max_width, max_height)
-    -- Approximate: 8px per character for default font
-    local char_width = 8
-    local line_height = 20
-    local text_width = #self.content * char_width
+    -- Theme fonts are only known at draw time; all themes use Inter for body
+    local text_width, text_height, lines = display.measure(self.content, self.font or display.FONT_DEFAULT)
 
     if self.wrap and text_width > max_width then
-        local lines = math.ceil(text_width / max_width)
+        local line_height = text_height / lines
+        local wrapped = lines * math.ceil(text_width / max_width)
         if self.max_lines then
-            lines = math.min(lines, self.max_lines)
+            wrapped = math.min(wrapped, self.max_lines)
         end
-        return max_width, lines * line_height
+        return max_width, wrapped * line_height
     end
 
-    return math.min(text_width, max_width), line_height
+    return math.min(text_width, max_width), text_height
 end
 
 function Text:layout(x, y, width, height)
@@ -46,10 +45,10 @@ function Text:draw(theme)
 
     local text_x = self.x
     if self.align == "center" then
-        local text_width = #self.content * 8
+        local text_width = display.measure(self.content, font)
         text_x = self.x + (self.width - text_width) / 2
     elseif self.align == "right" then
-        local text_width = #self.content * 8
+        local text_width = display.measure(self.content, font)
         text_x = self.x + self.width - text_width
     end
 
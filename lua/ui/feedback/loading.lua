@@ -91,7 +91,7 @@ function Loading:draw(theme)
 
     if self.message then
         local text_y = self.y + self.size + 8
-        local text_width = #self.message * 8
+        local text_width = display.measure(self.message, theme.fonts.small)
         local text_x = center_x - text_width / 2
 
         display.text_font(
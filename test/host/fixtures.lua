@@ -0,0 +1,136 @@
+--[[
+Render Test Fixtures
+Loads the app's Lua modules from the source tree under the names main.c
+registers them with, pins the clock, and provides canned plugin data so
+screens render the same on every run.
+--]]
+
+local fixtures = {}
+
+-- Module name -> path from the repository root (as in main.c)
+local modules = {
+	["app"] = "lua/app.lua",
+	["config.screens"] = "config/screens.lua",
+	["config.themes.cyberpunk"] = "config/themes/cyberpunk.lua",
+	["config.themes.minimal"] = "config/themes/minimal.lua",
+	["config.themes.retro"] = "config/themes/retro.lua",
+	["config.layouts.default"] = "config/layouts/default.lua",
+	["config.layouts.focus"] = "config/layouts/focus.lua",
+	["config.layouts.grid"] = "config/layouts/layout_grid.lua",
+	["ui"] = "lua/ui/ui_init.lua",
+	["ui.base"] = "lua/ui/ui_base.lua",
+	["ui.layout.container"] = "lua/ui/layout/container.lua",
+	["ui.layout.row"] = "lua/ui/layout/row.lua",
+	["ui.layout.column"] = "lua/ui/layout/column.lua",
+	["ui.layout.grid"] = "lua/ui/layout/ui_grid.lua",
+	["ui.layout.spacer"] = "lua/ui/layout/spacer.lua",
+	["ui.display.text"] = "lua/ui/display/text.lua",
+	["ui.display.heading"] = "lua/ui/display/heading.lua",
+	["ui.display.badge"] = "lua/ui/display/badge.lua",
+	["ui.display.divider"] = "lua/ui/display/divider.lua",
+	["ui.display.icon"] = "lua/ui/display/icon.lua",
+	["ui.data.value"] = "lua/ui/data/value.lua",
+	["ui.data.progress"] = "lua/ui/data/progress.lua",
+	["ui.data.chart"] = "lua/ui/data/chart.lua",
+	["ui.data.table"] = "lua/ui/data/table.lua",
+	["ui.data.list"] = "lua/ui/data/list.lua",
+	["ui.feedback.loading"] = "lua/ui/feedback/loading.lua",
+	["ui.feedback.error"] = "lua/ui/feedback/error.lua",
+	["ui.composite.panel"] = "lua/ui/composite/panel.lua",
+	["ui.composite.card"] = "lua/ui/composite/card.lua",
+	["ui.composite.stat"] = "lua/ui/composite/stat.lua",
+	["ui.composite.header"] = "lua/ui/composite/header.lua",
+	["ui.composite.screen_indicator"] = "lua/ui/composite/screen_indicator.lua",
+	["plugins"] = "lua/plugins/plugins_init.lua",
+	["plugins.base"] = "lua/plugins/plugin_base.lua",
+	["plugins.registry"] = "lua/plugins/registry.lua",
+	["plugins.builtin.weather"] = "lua/plugins/builtin/weather/weather.lua",
+	["plugins.builtin.weather.api"] = "lua/plugins/builtin/weather/weather_api.lua",
+	["plugins.builtin.weather.icons"] = "lua/plugins/builtin/weather/icons.lua",
+	["plugins.builtin.btc"] = "lua/plugins/builtin/btc/btc.lua",
+	["plugins.builtin.btc.api"] = "lua/plugins/builtin/btc/btc_api.lua",
+	["plugins.builtin.verse"] = "lua/plugins/builtin/verse/verse.lua",
+	["plugins.builtin.calendar"] = "lua/plugins/builtin/calendar/calendar.lua",
+	["plugins.builtin.clock"] = "lua/plugins/builtin/clock/clock.lua",
+	["plugins.builtin.system"] = "lua/plugins/builtin/system/system.lua",
+	["plugins.builtin.todo"] = "lua/plugins/builtin/todo/todo.lua",
+	["screen_manager"] = "lua/screen_manager/screen_manager.lua",
+	["touch.swipe"] = "lua/touch/swipe.lua",
+	["touch.handler"] = "lua/touch/handler.lua",
+}
+
+-- Thursday 9 October 2025, 14:35:20 UTC
+fixtures.now = 1760020520
+
+-- Config in place of config.lua (whose plugin configs are not in the tree);
+-- plugins are slotted under their own names, as screens refer to them
+fixtures.config = {
+	display = { width = 800, height = 480, refresh_interval = 300 },
+	theme = "cyberpunk",
+	layout = "default",
+	plugins = {
+		{ name = "weather", slot = "weather", config = { city = "Lisbon", units = "metric" } },
+		{ name = "btc", slot = "btc" },
+		{ name = "verse", slot = "verse" },
+		{ name = "calendar", slot = "calendar" },
+		{ name = "todo", slot = "todo" },
+		{ name = "clock", slot = "clock" },
+		-- Render cost depends on timing, so it is left out
+		{ name = "system", slot = "system", config = { show_render = false } },
+	},
+}
+
+-- Data for plugins that would fetch it over the network
+fixtures.plugin_data = {
+	weather = {
+		temp = 21,
+		feels_like = 20,
+		humidity = 64,
+		condition = "cloudy",
+		description = "scattered clouds",
+		city = "Lisbon",
+		units = "metric",
+	},
+	btc = {
+		price = 97532,
+		change_24h = -1.87,
+		high_24h = 99410,
+		low_24h = 96275,
+		currency = "USD",
+	},
+}
+
+-- Make modules loadable from the tree and the clock fixed
+function fixtures.install(root)
+	for name, path in pairs(modules) do
+		package.preload[name] = function()
+			return dofile(root .. "/" .. path)
+		end
+	end
+	package.preload["config"] = function()
+		return fixtures.config
+	end
+
+	-- Dates are read in the local zone, which ctest sets to UTC
+	local real_time, real_date = os.time, os.date
+	os.time = function(t)
+		if t then
+			return real_time(t)
+		end
+		return fixtures.now
+	end
+	os.date = function(format, t)
+		return real_date(format, t or fixtures.now)
+	end
+
+	-- Heap use shows in the status bar
+	local real_collectgarbage = collectgarbage
+	collectgarbage = function(opt, ...)
+		if opt == "count" then
+			return 128.0
+		end
+		return real_collectgarbage(opt, ...)
+	end
+end
+
+return fixtures
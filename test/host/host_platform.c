@@ -0,0 +1,143 @@
+/*
+ * Host Platform for the Render Tests
+ *
+ * Stands in for rgb_display.c (the panel driver) and the few ESP-IDF
+ * services the drawing code uses: an in-memory framebuffer, heap_caps on
+ * malloc, the clocks on CLOCK_MONOTONIC (scaled to a 240 MHz cycle
+ * counter) and no asset partition.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "rgb_display.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_partition.h"
+
+#define HOST_CPU_MHZ 240
+
+static uint16_t s_framebuffer[RGB_DISPLAY_WIDTH * RGB_DISPLAY_HEIGHT];
+
+// Display driver
+
+esp_err_t rgb_display_init(void)
+{
+    return ESP_OK;
+}
+
+void rgb_display_deinit(void)
+{
+}
+
+uint16_t* rgb_display_get_framebuffer(void)
+{
+    return s_framebuffer;
+}
+
+void rgb_display_set_backlight(uint8_t brightness)
+{
+    (void)brightness;
+}
+
+// Heap
+
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return calloc(n, size);
+}
+
+void* heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return realloc(ptr, size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    (void)caps;
+    return 8 * 1024 * 1024;
+}
+
+// Clocks
+
+static int64_t monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return monotonic_ns() / 1000;
+}
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void)
+{
+    return (esp_cpu_cycle_count_t)(monotonic_ns() * HOST_CPU_MHZ / 1000);
+}
+
+uint32_t esp_rom_get_cpu_ticks_per_us(void)
+{
+    return HOST_CPU_MHZ;
+}
+
+// Partitions: none, so assets and font packs report themselves missing
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype, const char *label)
+{
+    (void)type;
+    (void)subtype;
+    (void)label;
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t offset, void *dst, size_t size)
+{
+    (void)partition;
+    (void)offset;
+    (void)dst;
+    (void)size;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle)
+{
+    (void)partition;
+    (void)offset;
+    (void)size;
+    (void)memory;
+    (void)out_ptr;
+    (void)out_handle;
+    return ESP_ERR_NOT_FOUND;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+    (void)handle;
+}
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    static char buf[16];
+    snprintf(buf, sizeof(buf), "0x%x", code);
+    return buf;
+}
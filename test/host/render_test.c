@@ -0,0 +1,116 @@
+/*
+ * Host Render Test Driver
+ *
+ * Runs a Lua script with the display and scene modules drawing into the
+ * in-memory framebuffer of host_platform.c, plus a small host module:
+ *
+ *   sum = host.checksum()        -- FNV-1a of the framebuffer, as hex
+ *   t = host.clock()             -- Monotonic seconds
+ *   host.write_ppm(path)         -- Framebuffer as a binary PPM
+ *
+ * Usage: render_test script.lua [args...]
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "rgb_display.h"
+#include "lua_modules.h"
+
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+
+// host.checksum() -> "0123456789abcdef"
+static int l_host_checksum(lua_State *L)
+{
+    const uint16_t *fb = rgb_display_get_framebuffer();
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < RGB_DISPLAY_WIDTH * RGB_DISPLAY_HEIGHT; i++) {
+        hash = (hash ^ (fb[i] & 0xFF)) * 0x100000001b3ULL;
+        hash = (hash ^ (fb[i] >> 8)) * 0x100000001b3ULL;
+    }
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+    lua_pushstring(L, hex);
+    return 1;
+}
+
+// host.clock() -> seconds
+static int l_host_clock(lua_State *L)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    lua_pushnumber(L, ts.tv_sec + ts.tv_nsec / 1e9);
+    return 1;
+}
+
+// host.write_ppm(path) -> true, or nil, err
+static int l_host_write_ppm(lua_State *L)
+{
+    const char *path = luaL_checkstring(L, 1);
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "Cannot write %s", path);
+        return 2;
+    }
+
+    const uint16_t *fb = rgb_display_get_framebuffer();
+    fprintf(f, "P6\n%d %d\n255\n", RGB_DISPLAY_WIDTH, RGB_DISPLAY_HEIGHT);
+    for (int i = 0; i < RGB_DISPLAY_WIDTH * RGB_DISPLAY_HEIGHT; i++) {
+        uint16_t c = fb[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static const luaL_Reg host_funcs[] = {
+    {"checksum",  l_host_checksum},
+    {"clock",     l_host_clock},
+    {"write_ppm", l_host_write_ppm},
+    {NULL, NULL}
+};
+
+static int luaopen_host(lua_State *L)
+{
+    luaL_newlib(L, host_funcs);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s script.lua [args...]\n", argv[0]);
+        return 2;
+    }
+
+    lua_State *L = luaL_newstate();
+    luaL_openlibs(L);
+    luaL_requiref(L, "display", luaopen_display, 1);
+    luaL_requiref(L, "scene", luaopen_scene, 1);
+    luaL_requiref(L, "host", luaopen_host, 1);
+    lua_pop(L, 3);
+
+    // arg as in the standalone interpreter: script at 0, its arguments from 1
+    lua_createtable(L, argc - 2, 1);
+    for (int i = 1; i < argc; i++) {
+        lua_pushstring(L, argv[i]);
+        lua_rawseti(L, -2, i - 1);
+    }
+    lua_setglobal(L, "arg");
+
+    int status = luaL_dofile(L, argv[1]);
+    if (status != LUA_OK) {
+        fprintf(stderr, "%s\n", lua_tostring(L, -1));
+    }
+    lua_close(L);
+    return status == LUA_OK ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+--[[
+Host Render Tests
+Renders each scene from scenes.lua, compares a checksum of the frame with
+golden_frames.txt and reports the time per scene.
+
+  render_test render_test.lua [check]  -- Fail on any frame that changed
+  render_test render_test.lua update   -- Rewrite golden_frames.txt
+  render_test render_test.lua bench    -- Longer timing runs, no checks
+
+RENDER_TEST_DUMP=dir writes frames as PPM: the mismatches when checking,
+every frame when updating. RENDER_TEST_ONLY=pattern runs matching scenes.
+--]]
+
+local dir = arg[0]:match("^(.*[/\\])") or "./"
+package.path = dir .. "?.lua;" .. package.path
+
+local fixtures = require("fixtures")
+fixtures.install(os.getenv("MOONSHOT_ROOT") or (dir .. "../.."))
+
+local scenes = require("scenes")
+
+local mode = arg[1] or "check"
+local golden_path = dir .. "golden_frames.txt"
+local dump_dir = os.getenv("RENDER_TEST_DUMP")
+local only = os.getenv("RENDER_TEST_ONLY")
+
+-- Seconds of repeated renders per scene when timing
+local TIME_BUDGET = { check = 0.02, update = 0.02, bench = 0.3 }
+
+if not TIME_BUDGET[mode] then
+	error("Unknown mode '" .. mode .. "' (check, update or bench)")
+end
+
+local function load_golden()
+	local golden = {}
+	local f = io.open(golden_path, "r")
+	if not f then
+		return golden
+	end
+	for line in f:lines() do
+		local name, sum = line:match("^(%S+)%s+(%x+)$")
+		if name then
+			golden[name] = sum
+		end
+	end
+	f:close()
+	return golden
+end
+
+-- Draw a scene from a black screen; returns the time the scene itself
+-- took (not the clear before it)
+local function render(s)
+	display.clip()
+	display.clear(0x0000)
+	local t0 = host.clock()
+	s.draw()
+	return host.clock() - t0
+end
+
+-- Best time per render in microseconds over at least three runs and the
+-- budget, and the checksum after the last run
+local function time_scene(s, budget)
+	local best = math.huge
+	local runs = 0
+	local start = host.clock()
+	while runs < 3 or host.clock() - start < budget do
+		best = math.min(best, render(s))
+		runs = runs + 1
+	end
+	return best * 1e6, host.checksum(), runs
+end
+
+local golden = load_golden()
+local results = {}
+local failures = 0
+
+print(string.format("%-28s %-16s %-8s %10s %6s", "scene", "checksum", "status", "us/frame", "runs"))
+for _, s in ipairs(scenes) do
+	if not only or s.name:find(only) then
+		render(s)
+		local sum = host.checksum()
+		local status = mode == "bench" and "-" or "ok"
+		if mode == "update" then
+			status = golden[s.name] == sum and "same" or (golden[s.name] and "changed" or "new")
+			if dump_dir then
+				host.write_ppm(dump_dir .. "/" .. s.name .. ".ppm")
+			end
+		elseif mode == "check" then
+			if not golden[s.name] then
+				status = "MISSING"
+			elseif golden[s.name] ~= sum then
+				status = "CHANGED"
+			end
+			if status ~= "ok" then
+				failures = failures + 1
+				if dump_dir then
+					host.write_ppm(dump_dir .. "/" .. s.name .. ".ppm")
+				end
+			end
+		end
+
+		local us, again, runs = time_scene(s, TIME_BUDGET[mode])
+		if again ~= sum and mode ~= "bench" then
+			-- State left by one render changed the next one
+			status = "UNSTABLE"
+			failures = failures + 1
+		end
+		print(string.format("%-28s %-16s %-8s %10.1f %6d", s.name, sum, status, us, runs))
+		results[#results + 1] = { name = s.name, sum = sum }
+	end
+end
+
+if mode == "update" then
+	if only then
+		-- Keep the scenes that were not rendered
+		for _, r in ipairs(results) do
+			golden[r.name] = r.sum
+		end
+		results = {}
+		for _, s in ipairs(scenes) do
+			if golden[s.name] then
+				results[#results + 1] = { name = s.name, sum = golden[s.name] }
+			end
+		end
+	end
+	local f = assert(io.open(golden_path, "w"))
+	f:write("# Frame checksums of the host render test scenes (render_test.lua update)\n")
+	for _, r in ipairs(results) do
+		f:write(string.format("%-28s %s\n", r.name, r.sum))
+	end
+	f:close()
+	print("Wrote " .. golden_path)
+elseif failures > 0 then
+	error(string.format("%d scene(s) differ from the golden frames", failures), 0)
+end
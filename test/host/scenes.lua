@@ -0,0 +1,365 @@
+--[[
+Render Test Scenes
+Each scene draws onto a screen cleared to black with no clip, outside any
+frame. Primitive scenes cover each drawing call, font and image format;
+layout scenes draw the app's screens with fixture data.
+--]]
+
+local fixtures = require("fixtures")
+
+local scenes = {}
+
+local function add(name, draw)
+	table.insert(scenes, { name = name, draw = draw })
+end
+
+-- Deterministic pseudo-random numbers (LCG), restarted by each scene
+local seed = 1
+local function reseed()
+	seed = 1
+end
+local function rand(lo, hi)
+	seed = (seed * 1103515245 + 12345) % 2147483648
+	return lo + seed % (hi - lo + 1)
+end
+
+local PALETTE = { 0xF800, 0x07E0, 0x001F, 0xFFE0, 0x07FF, 0xF81F, 0xFD20, 0xFFFF, 0x8410, 0x4A69 }
+
+local function color(i)
+	return PALETTE[(i - 1) % #PALETTE + 1]
+end
+
+-- Primitives
+
+add("clear", function()
+	display.clear(0x1082)
+end)
+
+add("pixels", function()
+	reseed()
+	for i = 1, 5000 do
+		display.pixel(rand(-10, 809), rand(-10, 489), color(i))
+	end
+end)
+
+add("hline_vline", function()
+	for i = 0, 79 do
+		display.hline(i * 3 - 40, i * 6, 200 + i * 5, color(i + 1))
+		display.vline(i * 10 + 5, i * 3 - 20, 150 + i * 4, color(i + 3))
+	end
+end)
+
+add("lines", function()
+	-- Every octant from the center, then random (partly clipped) segments
+	for a = 0, 359, 5 do
+		local r = math.rad(a)
+		display.line(400, 240, math.floor(400 + math.cos(r) * 230), math.floor(240 + math.sin(r) * 230), color(a // 5 + 1))
+	end
+	reseed()
+	for i = 1, 200 do
+		display.line(rand(-100, 900), rand(-100, 580), rand(-100, 900), rand(-100, 580), color(i))
+	end
+end)
+
+add("rects", function()
+	reseed()
+	for i = 1, 60 do
+		local w, h = rand(1, 200), rand(1, 150)
+		display.rect(rand(-50, 799), rand(-50, 479), w, h, color(i), i % 2 == 0)
+	end
+	display.rect(0, 0, 800, 480, 0xFFFF, false)
+end)
+
+add("circles", function()
+	for i = 0, 11 do
+		display.fill_circle(60 + i * 65, 120, 5 + i * 3, color(i + 1))
+		display.circle(60 + i * 65, 330, 5 + i * 5, color(i + 2))
+	end
+	display.fill_circle(0, 479, 120, 0x4A69)
+	display.circle(799, 0, 150, 0xFFFF)
+end)
+
+add("triangles", function()
+	reseed()
+	for i = 1, 40 do
+		display.triangle(rand(-50, 850), rand(-50, 530), rand(-50, 850), rand(-50, 530),
+			rand(-50, 850), rand(-50, 530), color(i), i % 3 ~= 0)
+	end
+	-- Degenerate: flat top, flat bottom, a single point
+	display.triangle(100, 400, 300, 400, 200, 470, 0xFFFF, true)
+	display.triangle(400, 470, 600, 470, 500, 400, 0xFFFF, true)
+	display.triangle(700, 450, 700, 450, 700, 450, 0xFFFF, true)
+end)
+
+local function series(n, x0, step, mid, amp)
+	local xs, ys = {}, {}
+	for i = 1, n do
+		xs[i] = x0 + (i - 1) * step
+		ys[i] = mid + math.sin(i / 7) * amp + (i % 5) * 2.5
+	end
+	return xs, ys
+end
+
+add("polyline_fill_under", function()
+	local xs, ys = series(160, 10, 4.9, 150, 90)
+	display.fill_under(xs, ys, 300, 0x0841)
+	display.polyline(xs, ys, 0x07FF)
+	xs, ys = series(80, -20, 11, 380, 120)
+	display.fill_under(xs, ys, 479, 0x4A69)
+	display.polyline(xs, ys, 0xFFE0)
+end)
+
+add("text_builtin", function()
+	for i = 0, 21 do
+		local line = {}
+		for c = 32 + i * 4, 35 + i * 4 do
+			line[#line + 1] = string.char(c)
+		end
+		display.text(10 + (i % 2) * 400, 10 + (i // 2) * 20, table.concat(line, " "), color(i + 1))
+	end
+	display.text(10, 300, "The quick brown fox jumps over the lazy dog 0123456789", 0xFFFF)
+	display.text(760, 470, "clipped at the edge", 0xFFFF)
+end)
+
+local SAMPLE = {
+	"The quick brown fox jumps over the lazy dog",
+	"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG",
+	"0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~",
+	"21° Feels: 20° — ↑ 1.87% ↓ £ € Café naïve",
+}
+
+for _, font in ipairs({ "FONT_DEFAULT", "FONT_INTER_20", "FONT_GARAMOND_20" }) do
+	add("text_" .. font:lower(), function()
+		local id = display[font]
+		local y = 10
+		for i, s in ipairs(SAMPLE) do
+			display.text_font(10, y, s, color(i + 6), id)
+			y = y + 30
+		end
+		-- Right-aligned from measure(), and over a filled background
+		for i, s in ipairs(SAMPLE) do
+			local w = display.measure(s, id)
+			display.rect(790 - w, y, w, 24, 0x1082, true)
+			display.text_font(790 - w, y, s, 0xFFFF, id)
+			y = y + 30
+		end
+		display.text_font(700, 460, "Clipped at the edge", 0xFFE0, id)
+	end)
+end
+
+add("numerals", function()
+	local y = 0
+	for _, size in ipairs({ 24, 48, 56, 64, 96 }) do
+		local w = display.numerals(10, y, "$97,532.10", size, 0xFFFF, 0x0000)
+		display.numerals(20 + w, y, "12:34", size, 0x07FF, 0x1082)
+		y = y + size + 4
+	end
+end)
+
+add("clip", function()
+	display.clip(100, 80, 600, 320)
+	display.clear(0x0841)
+	for i = 0, 30 do
+		display.line(0, i * 16, 799, 479 - i * 16, color(i + 1))
+	end
+	display.fill_circle(100, 80, 90, 0xF800)
+	display.text_font(640, 380, "Clipped text runs past the edge", 0xFFFF, display.FONT_INTER_20)
+	display.clip()
+	display.rect(100, 80, 600, 320, 0xFFFF, false)
+end)
+
+add("canvas_blit", function()
+	local c = display.canvas(200, 120)
+	c:clear(0x1082)
+	c:rect(10, 10, 180, 100, 0x07FF, false)
+	c:fill_circle(100, 60, 40, 0xF81F)
+	c:text_font(20, 45, "Canvas", 0xFFFF, display.FONT_GARAMOND_20)
+	c:line(0, 0, 199, 119, 0xFFE0)
+	for i = 0, 4 do
+		display.blit(c, -60 + i * 190, 40 + i * 70)
+	end
+end)
+
+add("images", function()
+	-- RGB565 gradient
+	local px = {}
+	for y = 0, 63 do
+		for x = 0, 63 do
+			px[#px + 1] = string.pack("<I2", ((x // 2) << 11) | (y << 5) | ((63 - x) // 2))
+		end
+	end
+	local rgb = display.new_image(64, 64, table.concat(px))
+	-- 4-bit indexed with a transparent key, and an 8-bit ramp
+	local nib = {}
+	for y = 0, 31 do
+		for x = 0, 15 do
+			nib[#nib + 1] = string.char(((x + y) % 16) << 4 | ((x * y) % 16))
+		end
+	end
+	local ind4 = display.new_image(32, 32, table.concat(nib), display.IMAGE_INDEXED4, PALETTE, 0)
+	local ramp = {}
+	for i = 0, 48 * 48 - 1 do
+		ramp[#ramp + 1] = string.char(i % 256)
+	end
+	local ind8 = display.new_image(48, 48, table.concat(ramp), display.IMAGE_INDEXED8,
+		{ 0x0000, 0x2104, 0x4208, 0x630C, 0x8410, 0xA514, 0xC618, 0xE71C })
+	-- A8 coverage disc, blended in a tint
+	local a8 = {}
+	for y = 0, 39 do
+		for x = 0, 39 do
+			local d = math.sqrt((x - 19.5) ^ 2 + (y - 19.5) ^ 2)
+			a8[#a8 + 1] = string.char(math.max(0, math.min(255, math.floor((20 - d) * 128))))
+		end
+	end
+	local disc = display.new_image(40, 40, table.concat(a8), display.IMAGE_A8)
+
+	display.clear(0x1082)
+	for i = 0, 5 do
+		display.image(10 + i * 130, 10, rgb)
+		display.image(10 + i * 130, 90, ind4)
+		display.image(10 + i * 130, 140, ind8)
+		display.image(10 + i * 130, 200, disc, color(i + 1))
+	end
+	display.image(-32, 300, rgb)
+	display.image(770, 440, rgb)
+end)
+
+add("batch", function()
+	local b = display.batch()
+	for i = 0, 19 do
+		b:rect(i * 40, 0, 36, 480, color(i + 1), true)
+		b:text(i * 40 + 2, 240, tostring(i), 0x0000)
+	end
+	b:line(0, 0, 799, 479, 0xFFFF)
+	b:circle(400, 240, 100, 0xFFFF)
+	display.submit(b)
+	display.submit(b, true)
+end)
+
+add("frame_diff", function()
+	-- Two frames: the second only redraws what differs from the first
+	local function frame(n)
+		display.begin_frame()
+		display.clear(0x0000)
+		for i = 1, 12 do
+			display.rect(20 + i * 60, 100, 50, 50 + ((i + n) % 4) * 30, color(i), true)
+		end
+		display.text_font(20, 20, "Frame " .. n, 0xFFFF, display.FONT_INTER_20)
+		display.end_frame()
+	end
+	display.invalidate()
+	frame(1)
+	frame(2)
+end)
+
+add("numerals_frame_diff", function()
+	-- Rects over a readout go away: the regions they leave must get the
+	-- digits back, though the readout itself did not change
+	local function frame(rects)
+		display.begin_frame()
+		display.clear(0x0000)
+		display.numerals(100, 100, "12:45", 96, 0xFFFF, 0x0000)
+		if rects then
+			display.rect(90, 90, 40, 40, 0xF800, true)
+			display.rect(250, 150, 40, 40, 0x07E0, true)
+		end
+		display.end_frame()
+	end
+	display.invalidate()
+	frame(true)
+	frame(false)
+	-- Drawn under a clip first, then in full
+	display.clip(0, 300, 150, 180)
+	display.numerals(100, 320, "09:30", 64, 0x07FF, 0x0000)
+	display.clip()
+	display.numerals(100, 320, "09:30", 64, 0x07FF, 0x0000)
+end)
+
+add("scene_graph", function()
+	local root = scene.group({ x = 20, y = 20, w = 760, h = 440, layout = "column", gap = 10, align = "stretch",
+		padding = 12, bg = 0x0841, border = 0x4A69 })
+	local header = scene.group({ layout = "row", justify = "between", align = "center" })
+	header:add(scene.text({ text = "Scene", font = display.FONT_GARAMOND_20, color = 0x07FF }),
+		scene.text({ text = "14:35", font = display.FONT_INTER_20, color = 0xFFFF }))
+	local bars = scene.group({ layout = "row", gap = 8, align = "end", h = 200, bg = 0x1082 })
+	for i = 1, 12 do
+		bars:add(scene.rect({ w = 40, h = 20 + i * 14, color = color(i) }))
+	end
+	local row = scene.group({ layout = "row", justify = "around", align = "center", padding = 6, border = 0xFFFF })
+	for i = 1, 4 do
+		row:add(scene.text({ text = "Item " .. i, color = color(i + 4) }))
+	end
+	root:add(header, bars, row)
+	root:render()
+	-- Partial repaint after a change
+	bars:children()[5].h = 40
+	row:children()[2].text = "Changed"
+	root:render()
+end)
+
+-- Layouts with fixture data
+
+local app
+local function setup_app()
+	if app then
+		return app
+	end
+	app = require("app")
+	-- Keep the app's progress messages out of the report
+	local real_print = print
+	print = function() end
+	app.init()
+	print = real_print
+
+	local plugins = require("plugins")
+	for _, entry in ipairs(fixtures.config.plugins) do
+		local plugin = plugins.get_plugin(entry.name)
+		if fixtures.plugin_data[entry.name] then
+			plugin.data = fixtures.plugin_data[entry.name]
+		else
+			plugin:fetch()
+		end
+	end
+	app.last_refresh = fixtures.now
+	return app
+end
+
+local function draw_screen(index, theme)
+	setup_app()
+	fixtures.config.theme = theme
+	app.load_config()
+	require("screen_manager").go_to(index)
+	display.invalidate()
+	app.draw_current_screen()
+end
+
+for index, screen in ipairs(require("config.screens")) do
+	add("layout_" .. screen.name, function()
+		draw_screen(index, "cyberpunk")
+	end)
+end
+
+for _, theme in ipairs({ "minimal", "retro" }) do
+	add("layout_main_" .. theme, function()
+		draw_screen(1, theme)
+	end)
+end
+
+add("layout_productivity_tick", function()
+	draw_screen(3, "cyberpunk")
+	app.tick_current_screen()
+end)
+
+add("ui_chart", function()
+	local Chart = require("ui.data.chart")
+	local theme = require("config.themes.cyberpunk")
+	local data = {}
+	for i = 1, 120 do
+		data[i] = 50 + math.sin(i / 9) * 30 + (i % 7)
+	end
+	local chart = Chart.new({ data = data, type = "area", fill = true, show_labels = true })
+	chart:layout(40, 40, 720, 400)
+	chart:draw(theme)
+end)
+
+return scenes
@@ -0,0 +1,8 @@
+// Host stand-in for the ESP-IDF header of the same name (test/host only)
+#pragma once
+
+#include <stdint.h>
+
+typedef uint32_t esp_cpu_cycle_count_t;
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void);
@@ -0,0 +1,6 @@
+// Host stand-in for the ESP-IDF header of the same name (test/host only)
+#pragma once
+
+#include <stdint.h>
+
+uint32_t esp_rom_get_cpu_ticks_per_us(void);
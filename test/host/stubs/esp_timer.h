@@ -0,0 +1,6 @@
+// Host stand-in for the ESP-IDF header of the same name (test/host only)
+#pragma once
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
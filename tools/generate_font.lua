@@ -3,8 +3,15 @@
   Font Bitmap Generator
   Converts TTF fonts to C bitmap arrays for the RGB display font system.
   
-  Usage: luajit generate_font.lua <ttf_file> <font_name> <pixel_size>
+  Usage: luajit generate_font.lua <ttf_file> <font_name> <pixel_size> [--pack] [--raw]
   Example: luajit generate_font.lua EBGaramond-Regular.ttf garamond 16
+
+  Bitmaps are run-length encoded (FONT_FLAG_RLE) unless --raw is given,
+  which keeps the plain 1 bit per pixel column format.
+
+  With --pack, writes a binary font pack (see font_pack_header_t in fonts.h)
+  instead of C source. Bundle packs with tools/pack_assets.lua and flash the
+  image to the "spiffs" partition; load them with display.load_font(name).
   
   Requires: LuaJIT with FFI, FreeType library installed
 ]]
@@ -99,6 +106,11 @@ ffi.cdef[[
   FT_Error FT_Done_Face(FT_FacePtr face);
   FT_Error FT_Set_Pixel_Sizes(FT_FacePtr face, FT_UInt pixel_width, FT_UInt pixel_height);
   FT_Error FT_Load_Char(FT_FacePtr face, FT_ULong char_code, int load_flags);
+  FT_UInt FT_Get_Char_Index(FT_FacePtr face, FT_ULong charcode);
+  FT_Error FT_Get_Kerning(FT_FacePtr face, FT_UInt left_glyph, FT_UInt right_glyph,
+                          FT_UInt kern_mode, FT_Vector* akerning);
+  FT_Error FT_Load_Sfnt_Table(FT_FacePtr face, FT_ULong tag, FT_Long offset,
+                              unsigned char* buffer, FT_ULong* length);
 ]]
 
 -- Load FreeType
@@ -116,9 +128,15 @@ end
 local ttf_file = arg[1]
 local font_name = arg[2]
 local pixel_size = tonumber(arg[3])
+local pack_mode = false
+local raw_mode = false
+for i = 4, #arg do
+  if arg[i] == "--pack" then pack_mode = true end
+  if arg[i] == "--raw" then raw_mode = true end
+end
 
 if not ttf_file or not font_name or not pixel_size then
-  print("Usage: luajit generate_font.lua <ttf_file> <font_name> <pixel_size>")
+  print("Usage: luajit generate_font.lua <ttf_file> <font_name> <pixel_size> [--pack] [--raw]")
   os.exit(1)
 end
 
@@ -222,20 +240,319 @@ for charcode = first_char, last_char do
   table.insert(glyphs, glyph)
 end
 
--- Generate C code
+-- Kerning
+-- FT_Get_Kerning only reads the legacy 'kern' table; most current fonts
+-- (Inter, EB Garamond) only ship GPOS kerning, so PairPos lookups of the
+-- 'kern' feature are read directly as a fallback.
+
+local function sfnt_table(tag)
+  local tag_num = 0
+  for i = 1, 4 do tag_num = tag_num * 256 + tag:byte(i) end
+  local len = ffi.new("FT_ULong[1]", 0)
+  if ft.FT_Load_Sfnt_Table(face[0], tag_num, 0, nil, len) ~= 0 or len[0] == 0 then
+    return nil
+  end
+  local buf = ffi.new("unsigned char[?]", len[0])
+  if ft.FT_Load_Sfnt_Table(face[0], tag_num, 0, buf, len) ~= 0 then
+    return nil
+  end
+  return buf, tonumber(len[0])
+end
+
+local function gpos_kerning(wanted_glyphs)
+  local buf, len = sfnt_table("GPOS")
+  if not buf then return {} end
+
+  local function u16(o) return buf[o] * 256 + buf[o + 1] end
+  local function s16(o) local v = u16(o); return v >= 0x8000 and v - 0x10000 or v end
+  local function u32(o) return u16(o) * 65536 + u16(o + 2) end
+
+  local function value_size(format)
+    local n = 0
+    for b = 0, 7 do if bit.band(format, bit.lshift(1, b)) ~= 0 then n = n + 2 end end
+    return n
+  end
+
+  -- XAdvance is the third optional field of a ValueRecord
+  local function x_advance(o, format)
+    if bit.band(format, 0x4) == 0 then return 0 end
+    local skip = 0
+    if bit.band(format, 0x1) ~= 0 then skip = skip + 2 end
+    if bit.band(format, 0x2) ~= 0 then skip = skip + 2 end
+    return s16(o + skip)
+  end
+
+  local function coverage_index(o, gid)
+    local format = u16(o)
+    if format == 1 then
+      for i = 0, u16(o + 2) - 1 do
+        if u16(o + 4 + i * 2) == gid then return i end
+      end
+    elseif format == 2 then
+      for i = 0, u16(o + 2) - 1 do
+        local r = o + 4 + i * 6
+        if gid >= u16(r) and gid <= u16(r + 2) then return u16(r + 4) + gid - u16(r) end
+      end
+    end
+    return nil
+  end
+
+  local function class_of(o, gid)
+    local format = u16(o)
+    if format == 1 then
+      local start = u16(o + 2)
+      if gid >= start and gid < start + u16(o + 4) then return u16(o + 6 + (gid - start) * 2) end
+    elseif format == 2 then
+      for i = 0, u16(o + 2) - 1 do
+        local r = o + 4 + i * 6
+        if gid >= u16(r) and gid <= u16(r + 2) then return u16(r + 4) end
+      end
+    end
+    return 0
+  end
+
+  -- Value for one pair from a PairPos subtable, or nil if not covered
+  local function pair_value(st, left, right)
+    local cov = coverage_index(st + u16(st + 2), left)
+    if not cov then return nil end
+    local vf1, vf2 = u16(st + 4), u16(st + 6)
+    local size1, size2 = value_size(vf1), value_size(vf2)
+
+    if u16(st) == 1 then
+      if cov >= u16(st + 8) then return nil end
+      local set = st + u16(st + 10 + cov * 2)
+      for i = 0, u16(set) - 1 do
+        local rec = set + 2 + i * (2 + size1 + size2)
+        if u16(rec) == right then return x_advance(rec + 2, vf1) end
+      end
+      return nil
+    elseif u16(st) == 2 then
+      local c1 = class_of(st + u16(st + 8), left)
+      local c2 = class_of(st + u16(st + 10), right)
+      local class2_count = u16(st + 14)
+      local rec = st + 16 + (c1 * class2_count + c2) * (size1 + size2)
+      return x_advance(rec, vf1)
+    end
+    return nil
+  end
+
+  -- Lookups referenced by 'kern' features
+  local feature_list = u16(6)
+  local lookup_ids = {}
+  for i = 0, u16(feature_list) - 1 do
+    local rec = feature_list + 2 + i * 6
+    if ffi.string(buf + rec, 4) == "kern" then
+      local feature = feature_list + u16(rec + 4)
+      for j = 0, u16(feature + 2) - 1 do
+        lookup_ids[u16(feature + 4 + j * 2)] = true
+      end
+    end
+  end
+
+  -- Pair adjustment subtables, following Extension (type 9) lookups
+  local lookup_list = u16(8)
+  local lookups = {}
+  for id = 0, u16(lookup_list) - 1 do
+    if lookup_ids[id] then
+      local lookup = lookup_list + u16(lookup_list + 2 + id * 2)
+      local subtables = {}
+      for j = 0, u16(lookup + 4) - 1 do
+        local st = lookup + u16(lookup + 6 + j * 2)
+        local lookup_type = u16(lookup)
+        if lookup_type == 9 then
+          lookup_type = u16(st + 2)
+          st = st + u32(st + 4)
+        end
+        if lookup_type == 2 then table.insert(subtables, st) end
+      end
+      table.insert(lookups, subtables)
+    end
+  end
+
+  -- First matching subtable wins within a lookup; lookups accumulate
+  local kerning = {}
+  for _, left in ipairs(wanted_glyphs) do
+    for _, right in ipairs(wanted_glyphs) do
+      local total = 0
+      for _, subtables in ipairs(lookups) do
+        for _, st in ipairs(subtables) do
+          local v = pair_value(st, left.gid, right.gid)
+          if v then total = total + v; break end
+        end
+      end
+      if total ~= 0 then
+        kerning[left.charcode * 256 + right.charcode] = total
+      end
+    end
+  end
+  return kerning
+end
+
+local kern_pairs = {}
+do
+  local wanted = {}
+  for _, glyph in ipairs(glyphs) do
+    local gid = tonumber(ft.FT_Get_Char_Index(face[0], glyph.charcode))
+    if gid ~= 0 then table.insert(wanted, { charcode = glyph.charcode, gid = gid }) end
+  end
+
+  local x_scale = tonumber(size_metrics.x_scale)
+  local vec = ffi.new("FT_Vector")
+  local units = {}
+  local legacy = false
+  for _, left in ipairs(wanted) do
+    for _, right in ipairs(wanted) do
+      if ft.FT_Get_Kerning(face[0], left.gid, right.gid, 0, vec) == 0 and tonumber(vec.x) ~= 0 then
+        kern_pairs[#kern_pairs + 1] = { left = left.charcode, right = right.charcode,
+          adjust = math.floor(tonumber(vec.x) / 64 + 0.5) }
+        legacy = true
+      end
+    end
+  end
+
+  if not legacy then
+    units = gpos_kerning(wanted)
+    for key, value in pairs(units) do
+      -- Font units -> 26.6 pixels via the size's 16.16 x_scale
+      local px = math.floor(value * x_scale / 65536 / 64 + 0.5)
+      if px ~= 0 then
+        table.insert(kern_pairs, { left = math.floor(key / 256), right = key % 256, adjust = px })
+      end
+    end
+  end
+
+  table.sort(kern_pairs, function(a, b)
+    if a.left ~= b.left then return a.left < b.left end
+    return a.right < b.right
+  end)
+  for _, pair in ipairs(kern_pairs) do
+    pair.adjust = math.max(-128, math.min(127, pair.adjust))
+  end
+end
+
+-- kern_index[i] .. kern_index[i + 1] - 1 are the pairs whose left char is first_char + i
+local kern_index = {}
+do
+  local p = 1
+  for charcode = first_char, last_char + 1 do
+    while kern_pairs[p] and kern_pairs[p].left < charcode do p = p + 1 end
+    table.insert(kern_index, p - 1)
+  end
+end
+
+io.stderr:write(string.format("Kerning: %d pairs\n", #kern_pairs))
+
+-- RLE bitmap encoding
+-- Pixels are read column by column, top to bottom, and coded as one byte
+-- per run pair: high 5 bits = clear pixels (0-31), low 3 bits = set pixels
+-- (0-7). Longer runs continue in the next byte as (31, 0) or (0, 7),
+-- trailing clear pixels are dropped and 0x00 ends the glyph.
+local function rle_encode(glyph)
+  local pixels = {}
+  for _, col in ipairs(glyph.columns) do
+    for row = 0, font_height - 1 do
+      local byte = col[math.floor(row / 8) + 1]
+      pixels[#pixels + 1] = bit.band(bit.rshift(byte, row % 8), 1)
+    end
+  end
+  while #pixels > 0 and pixels[#pixels] == 0 do pixels[#pixels] = nil end
+
+  local bytes = {}
+  local i, n = 1, #pixels
+  while i <= n do
+    local zeros, ones = 0, 0
+    while i <= n and pixels[i] == 0 do zeros = zeros + 1; i = i + 1 end
+    while i <= n and pixels[i] == 1 do ones = ones + 1; i = i + 1 end
+    while zeros > 31 do table.insert(bytes, 31 * 8); zeros = zeros - 31 end
+    while ones > 7 do table.insert(bytes, zeros * 8 + 7); zeros = 0; ones = ones - 7 end
+    table.insert(bytes, zeros * 8 + ones)
+  end
+  table.insert(bytes, 0)
+  return bytes
+end
+
+local raw_size = #bitmap_data
+if not raw_mode then
+  bitmap_data = {}
+  for _, glyph in ipairs(glyphs) do
+    glyph.bitmap_offset = #bitmap_data
+    glyph.bytes = {}
+    if glyph.width > 0 then
+      glyph.bytes = rle_encode(glyph)
+      for _, byte in ipairs(glyph.bytes) do table.insert(bitmap_data, byte) end
+    end
+  end
+  io.stderr:write(string.format("RLE: %d -> %d bytes (%.0f%%)\n",
+    raw_size, #bitmap_data, 100 * #bitmap_data / raw_size))
+else
+  for _, glyph in ipairs(glyphs) do
+    glyph.bytes = {}
+    for _, col in ipairs(glyph.columns) do
+      for b = 1, bytes_per_col do table.insert(glyph.bytes, col[b]) end
+    end
+  end
+end
+local font_flags = raw_mode and 0 or 1  -- FONT_FLAG_RLE
+
 local out = io.stdout
 
+-- Little-endian encoders for the binary pack format
+local function u8(v) return string.char(bit.band(v, 0xFF)) end
+local function u16(v) return u8(v) .. u8(bit.rshift(v, 8)) end
+local function u32(v) return u16(bit.band(v, 0xFFFF)) .. u16(bit.rshift(v, 16)) end
+
+-- Generate binary font pack
+if pack_mode then
+  local header_size = 32
+  local glyph_size = 12
+  local glyphs_offset = header_size
+  local kern_offset = glyphs_offset + #glyphs * glyph_size
+  local bitmap_start = kern_offset + #kern_index * 2 + #kern_pairs * 3
+
+  local parts = {
+    "MDFP", u16(2),
+    u8(first_char), u8(last_char), u8(line_height), u8(ascender),
+    u16(#glyphs), u32(glyphs_offset), u32(bitmap_start), u32(#bitmap_data),
+    u32(#kern_pairs > 0 and kern_offset or 0), u16(#kern_pairs), u16(font_flags),
+  }
+  for _, glyph in ipairs(glyphs) do
+    -- Matches font_glyph_t: offset, width, height, x_offset, y_offset, x_advance, padding
+    table.insert(parts, u32(glyph.bitmap_offset) .. u8(glyph.width) .. u8(font_height) ..
+      u8(glyph.x_offset) .. u8(glyph.y_offset) .. u8(glyph.x_advance) .. "\0\0\0")
+  end
+  if #kern_pairs > 0 then
+    for _, index in ipairs(kern_index) do
+      table.insert(parts, u16(index))
+    end
+    for _, pair in ipairs(kern_pairs) do
+      table.insert(parts, u8(pair.left) .. u8(pair.right) .. u8(pair.adjust))
+    end
+  end
+  for _, byte in ipairs(bitmap_data) do
+    table.insert(parts, u8(byte))
+  end
+  out:write(table.concat(parts))
+
+  ft.FT_Done_Face(face[0])
+  ft.FT_Done_FreeType(library[0])
+  io.stderr:write(string.format("Generated %d glyphs, %d bytes of bitmap data (pack)\n", #glyphs, #bitmap_data))
+  os.exit(0)
+end
+
+-- Generate C code
+
+local format_desc = raw_mode and string.format("%d bytes per column", bytes_per_col) or "RLE encoded"
 out:write(string.format([[
 /*
  * %s Font - Bitmap data
  * Generated from: %s
  * Pixel size: %d
- * Height: %d pixels (%d bytes per column)
+ * Height: %d pixels (%s)
  */
 
 #include "fonts.h"
 
-]], font_name, ttf_file, pixel_size, font_height, bytes_per_col))
+]], font_name, ttf_file, pixel_size, font_height, format_desc))
 
 -- Bitmap array
 out:write(string.format("static const uint8_t %s%d_bitmap[] = {\n", font_name, pixel_size))
@@ -247,12 +564,10 @@ for i, glyph in ipairs(glyphs) do
       char_display, glyph.charcode, glyph.width, glyph.bitmap_offset))
     out:write("    ")
     local items = 0
-    for _, col in ipairs(glyph.columns) do
-      for b = 1, bytes_per_col do
-        out:write(string.format("0x%02X, ", col[b]))
-        items = items + 1
-        if items >= 12 then out:write("\n    "); items = 0 end
-      end
+    for _, byte in ipairs(glyph.bytes) do
+      out:write(string.format("0x%02X, ", byte))
+      items = items + 1
+      if items >= 12 then out:write("\n    "); items = 0 end
     end
     if items > 0 then out:write("\n") end
   end
@@ -272,6 +587,32 @@ for _, glyph in ipairs(glyphs) do
 end
 out:write("};\n\n")
 
+-- Kerning tables
+local kern_fields = ""
+if #kern_pairs > 0 then
+  out:write(string.format("static const uint16_t %s%d_kern_index[] = {\n    ", font_name, pixel_size))
+  for i, index in ipairs(kern_index) do
+    out:write(string.format("%d, ", index))
+    if i % 12 == 0 and i < #kern_index then out:write("\n    ") end
+  end
+  out:write("\n};\n\n")
+
+  out:write(string.format("static const font_kern_pair_t %s%d_kern_pairs[] = {\n", font_name, pixel_size))
+  for _, pair in ipairs(kern_pairs) do
+    local l, r = string.char(pair.left), string.char(pair.right)
+    if pair.left == 92 then l = "backslash" end
+    if pair.right == 92 then r = "backslash" end
+    out:write(string.format("    {%d, %d, %d},  // %s %s\n", pair.left, pair.right, pair.adjust, l, r))
+  end
+  out:write("};\n\n")
+
+  kern_fields = string.format([[
+    .kern_index = %s%d_kern_index,
+    .kern_pairs = %s%d_kern_pairs,
+    .kern_count = %d,
+]], font_name, pixel_size, font_name, pixel_size, #kern_pairs)
+end
+
 -- Font struct
 out:write(string.format([[
 const font_t font_%s_%d = {
@@ -281,9 +622,10 @@ const font_t font_%s_%d = {
     .last_char = %d,
     .line_height = %d,
     .baseline = %d,
-};
+%s%s};
 ]], font_name, pixel_size, font_name, pixel_size, font_name, pixel_size,
-    first_char, last_char, line_height, ascender))
+    first_char, last_char, line_height, ascender, kern_fields,
+    raw_mode and "" or "    .flags = FONT_FLAG_RLE,\n"))
 
 ft.FT_Done_Face(face[0])
 ft.FT_Done_FreeType(library[0])
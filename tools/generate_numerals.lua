@@ -0,0 +1,297 @@
+#!/usr/bin/env luajit
+--[[
+  Large Numeral Outline Generator
+  Converts the numerals of a TTF font to run-length outlines for the
+  display.numerals() renderer (see numerals.h).
+
+  Usage: luajit generate_numerals.lua <ttf_file> <name> [master_size]
+  Example: luajit generate_numerals.lua Inter24-SemiBold.ttf inter 120 > numerals_inter.c
+
+  Each glyph is rendered once at master_size and stored as one row of
+  (start, length) runs per scanline, with identical consecutive rows
+  collapsed. The device scales the outline to any cell height, so a
+  single master covers every readout size.
+
+  Requires: LuaJIT with FFI, FreeType library installed
+]]
+
+local ffi = require("ffi")
+
+ffi.cdef[[
+  typedef int FT_Error;
+  typedef void* FT_Library;
+  typedef signed long FT_Long;
+  typedef unsigned long FT_ULong;
+  typedef unsigned int FT_UInt;
+  typedef signed long FT_Pos;
+  typedef signed long FT_Fixed;
+
+  typedef struct { FT_Pos x, y; } FT_Vector;
+  typedef struct { FT_Pos xMin, yMin, xMax, yMax; } FT_BBox;
+
+  typedef struct {
+    unsigned int rows;
+    unsigned int width;
+    int pitch;
+    unsigned char* buffer;
+    unsigned short num_grays;
+    unsigned char pixel_mode;
+    char palette_mode;
+    void* palette;
+  } FT_Bitmap;
+
+  typedef struct {
+    FT_Pos width, height;
+    FT_Pos horiBearingX, horiBearingY, horiAdvance;
+    FT_Pos vertBearingX, vertBearingY, vertAdvance;
+  } FT_Glyph_Metrics;
+
+  typedef struct FT_GlyphSlotRec_* FT_GlyphSlot;
+  typedef struct FT_GlyphSlotRec_ {
+    FT_Library library;
+    void* face;
+    FT_GlyphSlot next;
+    FT_UInt glyph_index;
+    void* generic_data;
+    void* generic_finalizer;
+    FT_Glyph_Metrics metrics;
+    FT_Fixed linearHoriAdvance;
+    FT_Fixed linearVertAdvance;
+    FT_Vector advance;
+    int format;
+    FT_Bitmap bitmap;
+    int bitmap_left;
+    int bitmap_top;
+  } FT_GlyphSlotRec;
+
+  typedef struct FT_FaceRec_* FT_FacePtr;
+  typedef struct FT_FaceRec_ {
+    FT_Long num_faces, face_index, face_flags, style_flags, num_glyphs;
+    char* family_name;
+    char* style_name;
+    int num_fixed_sizes;
+    void* available_sizes;
+    int num_charmaps;
+    void* charmaps;
+    void* generic_data;
+    void* generic_finalizer;
+    FT_BBox bbox;
+    unsigned short units_per_EM;
+    short ascender, descender, height;
+    short max_advance_width, max_advance_height;
+    short underline_position, underline_thickness;
+    FT_GlyphSlot glyph;
+    void* size;
+  } FT_FaceRec;
+
+  FT_Error FT_Init_FreeType(FT_Library* alibrary);
+  FT_Error FT_Done_FreeType(FT_Library library);
+  FT_Error FT_New_Face(FT_Library library, const char* path, FT_Long idx, FT_FacePtr* aface);
+  FT_Error FT_Done_Face(FT_FacePtr face);
+  FT_Error FT_Set_Pixel_Sizes(FT_FacePtr face, FT_UInt pixel_width, FT_UInt pixel_height);
+  FT_Error FT_Load_Char(FT_FacePtr face, FT_ULong char_code, int load_flags);
+]]
+
+-- Load FreeType
+local ft
+for _, name in ipairs({"libfreetype.so.6", "libfreetype.so", "libfreetype.dylib", "freetype"}) do
+  local ok, lib = pcall(ffi.load, name)
+  if ok then ft = lib; break end
+end
+if not ft then
+  io.stderr:write("Error: Could not load FreeType library.\n")
+  os.exit(1)
+end
+
+-- Parse arguments
+local ttf_file = arg[1]
+local name = arg[2]
+local master_size = tonumber(arg[3] or 120)
+
+if not ttf_file or not name or not master_size then
+  print("Usage: luajit generate_numerals.lua <ttf_file> <name> [master_size]")
+  os.exit(1)
+end
+
+-- Digits, separators and currency signs (codepoints)
+local charset = {
+  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3A,   -- :
+  0x2E,   -- .
+  0x2C,   -- ,
+  0x2D,   -- -
+  0x24,   -- $
+  0xA3,   -- £
+  0x20AC, -- €
+}
+
+local library = ffi.new("FT_Library[1]")
+assert(ft.FT_Init_FreeType(library) == 0, "FT_Init_FreeType failed")
+
+local face = ffi.new("FT_FacePtr[1]")
+local err = ft.FT_New_Face(library[0], ttf_file, 0, face)
+assert(err == 0, "Could not load font: " .. ttf_file)
+
+err = ft.FT_Set_Pixel_Sizes(face[0], 0, master_size)
+assert(err == 0, "FT_Set_Pixel_Sizes failed")
+
+local face_rec = ffi.cast("FT_FaceRec*", face[0])
+io.stderr:write(string.format("Loaded font: %s %s\n",
+  ffi.string(face_rec.family_name),
+  ffi.string(face_rec.style_name)))
+
+-- Render every glyph and record its set pixels as runs per bitmap row
+local FT_LOAD_RENDER = 4
+local glyphs = {}
+local top, bottom = -math.huge, math.huge
+local digit_advance = 0
+
+for _, cp in ipairs(charset) do
+  err = ft.FT_Load_Char(face[0], cp, FT_LOAD_RENDER)
+  assert(err == 0, string.format("Glyph U+%04X missing from %s", cp, ttf_file))
+
+  local slot = face_rec.glyph
+  local bitmap = slot.bitmap
+  local glyph = {
+    codepoint = cp,
+    advance = math.floor(tonumber(slot.metrics.horiAdvance) / 64 + 0.5),
+    left = tonumber(slot.bitmap_left),
+    top = tonumber(slot.bitmap_top),
+    rows = {},
+  }
+
+  for row = 0, tonumber(bitmap.rows) - 1 do
+    local runs = {}
+    local start = nil
+    for col = 0, tonumber(bitmap.width) do
+      local on = col < bitmap.width and bitmap.buffer[row * bitmap.pitch + col] >= 128
+      if on and not start then
+        start = col
+      elseif not on and start then
+        table.insert(runs, { start, col - start })
+        start = nil
+      end
+    end
+    glyph.rows[row + 1] = runs
+  end
+
+  top = math.max(top, glyph.top)
+  bottom = math.min(bottom, glyph.top - tonumber(bitmap.rows))
+  if cp >= 0x30 and cp <= 0x39 then
+    digit_advance = math.max(digit_advance, glyph.advance)
+  end
+  table.insert(glyphs, glyph)
+end
+
+local height = top - bottom
+assert(height <= 255, "master_size too large for 8-bit outlines")
+
+-- Digits share one advance (tabular figures) so readouts keep a fixed cell grid
+for _, glyph in ipairs(glyphs) do
+  if glyph.codepoint >= 0x30 and glyph.codepoint <= 0x39 then
+    glyph.left = glyph.left + math.floor((digit_advance - glyph.advance) / 2)
+    glyph.advance = digit_advance
+  end
+end
+
+-- Encode one outline row per cell scanline:
+--   0x00-0x7F  run count, followed by (start, length) byte pairs
+--   0x80 | n   previous row repeated n more times
+local function same_runs(a, b)
+  if #a ~= #b then return false end
+  for i = 1, #a do
+    if a[i][1] ~= b[i][1] or a[i][2] ~= b[i][2] then return false end
+  end
+  return true
+end
+
+local runs_data = {}
+for _, glyph in ipairs(glyphs) do
+  glyph.offset = #runs_data
+  glyph.bytes = {}
+  local prev = nil
+  local repeat_at = nil
+  for y = 0, height - 1 do
+    local src = glyph.rows[y - (top - glyph.top) + 1] or {}
+    local runs = {}
+    for _, run in ipairs(src) do
+      local x0 = math.max(0, math.min(255, run[1] + glyph.left))
+      local x1 = math.max(0, math.min(255, run[1] + run[2] + glyph.left))
+      if x1 > x0 then table.insert(runs, { x0, x1 - x0 }) end
+    end
+    assert(#runs < 0x80, "too many runs in one row")
+
+    if prev and same_runs(prev, runs) and repeat_at and glyph.bytes[repeat_at] < 0xFF then
+      glyph.bytes[repeat_at] = glyph.bytes[repeat_at] + 1
+    elseif prev and same_runs(prev, runs) then
+      table.insert(glyph.bytes, 0x81)
+      repeat_at = #glyph.bytes
+    else
+      table.insert(glyph.bytes, #runs)
+      for _, run in ipairs(runs) do
+        table.insert(glyph.bytes, run[1])
+        table.insert(glyph.bytes, run[2])
+      end
+      repeat_at = nil
+    end
+    prev = runs
+  end
+  for _, b in ipairs(glyph.bytes) do table.insert(runs_data, b) end
+end
+
+local function utf8_char(cp)
+  if cp < 0x80 then return string.char(cp) end
+  if cp < 0x800 then
+    return string.char(0xC0 + math.floor(cp / 64), 0x80 + cp % 64)
+  end
+  return string.char(0xE0 + math.floor(cp / 4096), 0x80 + math.floor(cp / 64) % 64, 0x80 + cp % 64)
+end
+
+-- Output C file
+local out = io.stdout
+
+out:write(string.format([[
+/*
+ * Large Numerals - Run-length outlines
+ * Generated from: %s
+ * Master size: %d (cell height %d, baseline %d)
+ */
+
+#include "numerals.h"
+
+static const uint8_t numerals_%s_runs[] = {
+]], ttf_file, master_size, height, top, name))
+
+for _, glyph in ipairs(glyphs) do
+  out:write(string.format("    // %s (U+%04X) - %d bytes\n", utf8_char(glyph.codepoint), glyph.codepoint, #glyph.bytes))
+  for i = 1, #glyph.bytes, 12 do
+    out:write("    ")
+    for j = i, math.min(i + 11, #glyph.bytes) do
+      out:write(string.format("0x%02X, ", glyph.bytes[j]))
+    end
+    out:write("\n")
+  end
+end
+out:write("};\n\n")
+
+out:write(string.format("static const numeral_glyph_t numerals_%s_glyphs[] = {\n", name))
+for _, glyph in ipairs(glyphs) do
+  out:write(string.format("    {0x%04X, %d, %d},  // %s\n",
+    glyph.codepoint, glyph.advance, glyph.offset, utf8_char(glyph.codepoint)))
+end
+out:write("};\n\n")
+
+out:write(string.format([[
+const numeral_outline_t numerals_%s = {
+    .runs = numerals_%s_runs,
+    .glyphs = numerals_%s_glyphs,
+    .glyph_count = %d,
+    .height = %d,
+    .baseline = %d,
+};
+]], name, name, name, #glyphs, height, top))
+
+ft.FT_Done_Face(face[0])
+ft.FT_Done_FreeType(library[0])
+
+io.stderr:write(string.format("Generated %d numerals, %d bytes of outline data\n", #glyphs, #runs_data))
@@ -0,0 +1,80 @@
+#!/usr/bin/env luajit
+--[[
+  Asset Partition Builder
+  Bundles binary assets (font packs, images, ...) into an image for the "spiffs"
+  data partition, read at runtime by components/rgb_display/assets.c.
+
+  Usage: luajit pack_assets.lua <output.bin> <[name=]file> ...
+  Example:
+    luajit generate_font.lua Inter24-Bold.ttf inter 48 --pack > inter_48.mdf
+    luajit pack_assets.lua assets.bin inter_48.mdf
+    parttool.py write_partition --partition-name spiffs --input assets.bin
+
+  The asset name defaults to the file name without extension.
+]]
+
+local NAME_LEN = 24
+local ENTRY_SIZE = NAME_LEN + 8
+local HEADER_SIZE = 8
+local ALIGN = 16
+local PARTITION_SIZE = 0x200000
+
+local output = arg[1]
+if not output or not arg[2] then
+  print("Usage: luajit pack_assets.lua <output.bin> <[name=]file> ...")
+  os.exit(1)
+end
+
+local function u8(v) return string.char(v % 256) end
+local function u16(v) return u8(v) .. u8(math.floor(v / 256)) end
+local function u32(v) return u16(v % 65536) .. u16(math.floor(v / 65536)) end
+
+local function align(v) return math.ceil(v / ALIGN) * ALIGN end
+
+local assets = {}
+for i = 2, #arg do
+  local name, path = arg[i]:match("^([^=]+)=(.+)$")
+  if not name then
+    path = arg[i]
+    name = path:match("([^/]+)$"):gsub("%.[^.]*$", "")
+  end
+  if #name >= NAME_LEN then
+    io.stderr:write(string.format("Error: asset name '%s' longer than %d chars\n", name, NAME_LEN - 1))
+    os.exit(1)
+  end
+
+  local f = assert(io.open(path, "rb"), "Could not open " .. path)
+  local data = f:read("*a")
+  f:close()
+  table.insert(assets, { name = name, data = data })
+end
+
+local offset = align(HEADER_SIZE + #assets * ENTRY_SIZE)
+local directory = { "MDAS", u16(1), u16(#assets) }
+local blobs = {}
+
+for _, asset in ipairs(assets) do
+  asset.offset = offset
+  table.insert(directory, asset.name .. string.rep("\0", NAME_LEN - #asset.name))
+  table.insert(directory, u32(offset) .. u32(#asset.data))
+  offset = align(offset + #asset.data)
+end
+
+local image = table.concat(directory)
+for _, asset in ipairs(assets) do
+  image = image .. string.rep("\0", asset.offset - #image) .. asset.data
+end
+
+if #image > PARTITION_SIZE then
+  io.stderr:write(string.format("Error: image is %d bytes, partition holds %d\n", #image, PARTITION_SIZE))
+  os.exit(1)
+end
+
+local f = assert(io.open(output, "wb"))
+f:write(image)
+f:close()
+
+for _, asset in ipairs(assets) do
+  io.stderr:write(string.format("  %-24s %8d bytes @ 0x%06X\n", asset.name, #asset.data, asset.offset))
+end
+io.stderr:write(string.format("Wrote %s: %d assets, %d bytes\n", output, #assets, #image))